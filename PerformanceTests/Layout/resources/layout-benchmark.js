@@ -0,0 +1,147 @@
+// Minimal driver for layout microbenchmarks. Builds parameterized DOM, forces
+// synchronous layout, and reports per-phase timings. When window.internals is
+// available (run-perf-tests / MiniBrowser with internals exposed), each test is
+// run twice — once with the LFC inline integration enabled and once with the
+// legacy line layout path — so the two engines can be compared per construct.
+
+const LayoutBenchmark = (() => {
+    const defaultIterations = 20;
+
+    function forceLayout(element)
+    {
+        return element.offsetHeight;
+    }
+
+    function median(values)
+    {
+        const sorted = values.slice().sort((a, b) => a - b);
+        return sorted[Math.floor(sorted.length / 2)];
+    }
+
+    function measureOnce(test, container)
+    {
+        const timings = { };
+
+        let start = performance.now();
+        const subtree = test.build(test.params);
+        timings.build = performance.now() - start;
+
+        start = performance.now();
+        container.appendChild(subtree);
+        forceLayout(container);
+        timings.initialLayout = performance.now() - start;
+
+        // Perturb available width to force full relayout of existing boxes.
+        start = performance.now();
+        container.style.width = "90%";
+        forceLayout(container);
+        container.style.width = "";
+        forceLayout(container);
+        timings.relayout = performance.now() - start;
+
+        container.textContent = "";
+        return timings;
+    }
+
+    function runWithCurrentEngine(test, container)
+    {
+        const iterations = test.iterations || defaultIterations;
+        const samples = { build: [], initialLayout: [], relayout: [] };
+        for (let i = 0; i < iterations; ++i) {
+            const timings = measureOnce(test, container);
+            for (const phase of Object.keys(samples))
+                samples[phase].push(timings[phase]);
+        }
+        const result = { };
+        for (const phase of Object.keys(samples))
+            result[phase] = median(samples[phase]);
+        return result;
+    }
+
+    function engines()
+    {
+        if (!window.internals)
+            return [{ name: "current", setUp: () => { } }];
+        return [
+            { name: "legacy", setUp: () => internals.settings.setInlineFormattingContextIntegrationEnabled(false) },
+            { name: "lfc", setUp: () => internals.settings.setInlineFormattingContextIntegrationEnabled(true) },
+        ];
+    }
+
+    function report(lines)
+    {
+        let output = document.getElementById("results");
+        if (!output) {
+            output = document.createElement("pre");
+            output.id = "results";
+            document.body.appendChild(output);
+        }
+        output.textContent += lines.join("\n") + "\n";
+        if (window.testRunner)
+            testRunner.notifyDone();
+    }
+
+    // test: { name, params, build(params) -> Element, iterations? }
+    function run(test)
+    {
+        if (window.testRunner) {
+            testRunner.dumpAsText();
+            testRunner.waitUntilDone();
+        }
+
+        const container = document.createElement("div");
+        document.body.appendChild(container);
+
+        const lines = [`${test.name} ${JSON.stringify(test.params)}`];
+        for (const engine of engines()) {
+            engine.setUp();
+            // Rebuild from scratch under each engine so the line layout path is chosen afresh.
+            const result = runWithCurrentEngine(test, container);
+            lines.push(`  ${engine.name}: build ${result.build.toFixed(2)}ms, initial layout ${result.initialLayout.toFixed(2)}ms, relayout ${result.relayout.toFixed(2)}ms`);
+        }
+
+        container.remove();
+        report(lines);
+    }
+
+    // Shared DOM generators.
+    function inlineRuns(params)
+    {
+        const root = document.createElement("div");
+        for (let row = 0; row < params.rows; ++row) {
+            const paragraph = document.createElement("p");
+            for (let run = 0; run < params.runsPerRow; ++run) {
+                const span = document.createElement("span");
+                span.textContent = `run ${run} of row ${row} with enough text to wrap `;
+                if (run % 3 == 1)
+                    span.style.fontWeight = "bold";
+                paragraph.appendChild(span);
+            }
+            root.appendChild(paragraph);
+        }
+        return root;
+    }
+
+    function nestedFlex(params)
+    {
+        const root = document.createElement("div");
+        root.style.display = "flex";
+        let parent = root;
+        for (let depth = 0; depth < params.depth; ++depth) {
+            const flexBox = document.createElement("div");
+            flexBox.style.display = "flex";
+            flexBox.style.flex = "1 1 auto";
+            for (let item = 0; item < params.itemsPerLevel; ++item) {
+                const flexItem = document.createElement("div");
+                flexItem.style.flex = `${1 + item % 2} 1 0`;
+                flexItem.textContent = "item";
+                flexBox.appendChild(flexItem);
+            }
+            parent.appendChild(flexBox);
+            parent = flexBox;
+        }
+        return root;
+    }
+
+    return { run, generators: { inlineRuns, nestedFlex } };
+})();
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2022 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+
+#include "atom_string.h"
+#include "hash_table.h"
+#include "lock.h"
+#include "vector.h"
+#include <algorithm>
+#include <iostream>
+#include <stdio.h>
+#include <wtf/MonotonicTime.h>
+
+using namespace std;
+
+struct BenchmarkPair {
+    const char* const name;
+    const BenchmarkFunction function;
+};
+
+static const BenchmarkPair benchmarkPairs[] = {
+    { "atom_string", benchmark_atom_string },
+    { "hash_table", benchmark_hash_table },
+    { "lock", benchmark_lock },
+    { "vector", benchmark_vector },
+};
+
+static const size_t benchmarksPairsCount = sizeof(benchmarkPairs) / sizeof(BenchmarkPair);
+
+double Benchmark::Result::mean() const
+{
+    double sum = 0;
+    for (double runTimeMS : runTimesMS)
+        sum += runTimeMS;
+    return sum / runTimesMS.size();
+}
+
+Benchmark::Benchmark(CommandLine& commandLine)
+    : m_commandLine(commandLine)
+{
+    if (m_commandLine.benchmarkName() == "all") {
+        for (size_t i = 0; i < benchmarksPairsCount; ++i)
+            m_benchmarks.push_back(&benchmarkPairs[i]);
+        return;
+    }
+
+    for (size_t i = 0; i < benchmarksPairsCount; ++i) {
+        if (m_commandLine.benchmarkName() == benchmarkPairs[i].name)
+            m_benchmarks.push_back(&benchmarkPairs[i]);
+    }
+}
+
+void Benchmark::printBenchmarks()
+{
+    cout << "Benchmarks: " << endl;
+    cout << "\tall" << endl;
+    for (size_t i = 0; i < benchmarksPairsCount; ++i)
+        cout << "\t" << benchmarkPairs[i].name << endl;
+}
+
+void Benchmark::run()
+{
+    for (const BenchmarkPair* benchmark : m_benchmarks) {
+        Result result { benchmark, { } };
+
+        if (m_commandLine.warmUp())
+            benchmark->function(m_commandLine);
+
+        for (size_t i = 0; i < m_commandLine.runs(); ++i) {
+            WTF::MonotonicTime start = WTF::MonotonicTime::now();
+            benchmark->function(m_commandLine);
+            result.runTimesMS.push_back((WTF::MonotonicTime::now() - start).milliseconds());
+        }
+
+        m_results.push_back(result);
+    }
+}
+
+void Benchmark::printReport()
+{
+    if (!m_commandLine.jsonOutput()) {
+        for (const Result& result : m_results) {
+            double min = *min_element(result.runTimesMS.begin(), result.runTimesMS.end());
+            double max = *max_element(result.runTimesMS.begin(), result.runTimesMS.end());
+            printf("%-16s %10.3fms (min %.3fms, max %.3fms, %zu runs, scale %zu)\n",
+                result.benchmark->name, result.mean(), min, max, result.runTimesMS.size(), m_commandLine.scale());
+        }
+        return;
+    }
+
+    // One object per benchmark with the raw per-run samples, so results from
+    // different builds can be compared with a significance test rather than
+    // just by their means.
+    printf("[\n");
+    for (size_t i = 0; i < m_results.size(); ++i) {
+        const Result& result = m_results[i];
+        printf("    {\n");
+        printf("        \"benchmark\": \"%s\",\n", result.benchmark->name);
+        printf("        \"scale\": %zu,\n", m_commandLine.scale());
+        printf("        \"unit\": \"ms\",\n");
+        printf("        \"values\": [");
+        for (size_t j = 0; j < result.runTimesMS.size(); ++j)
+            printf("%s%.3f", j ? ", " : "", result.runTimesMS[j]);
+        printf("],\n");
+        printf("        \"mean\": %.3f\n", result.mean());
+        printf("    }%s\n", i + 1 < m_results.size() ? "," : "");
+    }
+    printf("]\n");
+}
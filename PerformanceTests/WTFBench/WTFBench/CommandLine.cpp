@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2022 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CommandLine.h"
+#include <getopt.h>
+#include <iostream>
+#include <stdlib.h>
+
+struct option CommandLine::longOptions[] =
+{
+    {"benchmark", required_argument, 0, 'b'},
+    {"json", no_argument, 0, 'j'},
+    {"no-warmup", no_argument, 0, 'n'},
+    {"runs", required_argument, 0, 'r'},
+    {"scale", required_argument, 0, 's'},
+    {0, 0, 0, 0}
+};
+
+CommandLine::CommandLine(int argc, char** argv)
+    : m_argv(argv)
+    , m_jsonOutput(false)
+    , m_warmUp(true)
+    , m_runs(5)
+    , m_scale(1)
+{
+    int optionIndex = 0;
+    int ch;
+    while ((ch = getopt_long(argc, argv, "b:jnr:s:", longOptions, &optionIndex)) != -1) {
+        switch (ch)
+        {
+            case 'b':
+                m_benchmarkName = optarg;
+                break;
+
+            case 'j':
+                m_jsonOutput = true;
+                break;
+
+            case 'n':
+                m_warmUp = false;
+                break;
+
+            case 'r':
+                m_runs = atoi(optarg);
+                break;
+
+            case 's':
+                m_scale = atoi(optarg);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (!m_runs)
+        m_runs = 1;
+    if (!m_scale)
+        m_scale = 1;
+}
+
+void CommandLine::printUsage()
+{
+    std::string fullPath(m_argv[0]);
+    size_t pos = fullPath.find_last_of("/") + 1;
+    std::string program = fullPath.substr(pos);
+    std::cout << "Usage: " << program << " --benchmark benchmark_name|all [--json] [--no-warmup] [--runs count] [--scale factor]" << std::endl;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2022 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "atom_string.h"
+
+#include <wtf/Vector.h>
+#include <wtf/text/AtomString.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+static volatile unsigned sink;
+
+// Atomization churn: populate the atom table from distinct strings, re-atomize
+// the same spellings through fresh String allocations (pure table hits, the
+// parser's hot case), then drop the references so the entries are removed.
+void benchmark_atom_string(CommandLine& commandLine)
+{
+    size_t rounds = 50 * commandLine.scale();
+    static const unsigned atomsPerRound = 1024;
+
+    unsigned hits = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        WTF::Vector<WTF::AtomString> atoms;
+        atoms.reserveInitialCapacity(atomsPerRound);
+        for (unsigned i = 0; i < atomsPerRound; ++i)
+            atoms.uncheckedAppend(WTF::AtomString(WTF::makeString("attribute-", i)));
+
+        for (unsigned i = 0; i < atomsPerRound; ++i) {
+            WTF::AtomString hit(WTF::makeString("attribute-", i));
+            if (hit == atoms[i])
+                ++hits;
+        }
+    }
+    sink = hits;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hash_table.h"
+
+#include <wtf/HashMap.h>
+
+static volatile unsigned sink;
+
+// Mixed add/find/remove churn on integer-keyed tables a few thousand entries
+// large, which is roughly the shape of the engine's property and registration
+// maps. The remove phase leaves deleted buckets behind so the following
+// iteration and rehash pay for them.
+void benchmark_hash_table(CommandLine& commandLine)
+{
+    size_t rounds = 400 * commandLine.scale();
+    static const unsigned keysPerRound = 4096;
+
+    unsigned found = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        WTF::HashMap<unsigned, unsigned> map;
+
+        // Linear congruential sequence, masked to avoid the empty (0) and
+        // deleted (-1) bucket values.
+        unsigned state = 0x12345678 + round;
+        for (unsigned i = 0; i < keysPerRound; ++i) {
+            state = state * 1664525 + 1013904223;
+            map.add((state & 0x7FFFFFFF) + 1, i);
+        }
+
+        state = 0x12345678 + round;
+        for (unsigned i = 0; i < keysPerRound; ++i) {
+            state = state * 1664525 + 1013904223;
+            auto it = map.find((state & 0x7FFFFFFF) + 1);
+            if (it != map.end())
+                found += it->value;
+        }
+
+        state = 0x12345678 + round;
+        for (unsigned i = 0; i < keysPerRound; ++i) {
+            state = state * 1664525 + 1013904223;
+            if (i & 1)
+                map.remove((state & 0x7FFFFFFF) + 1);
+        }
+
+        for (auto& entry : map)
+            found += entry.value;
+    }
+    sink = found;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lock.h"
+
+#include <wtf/Lock.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+
+static volatile size_t sink;
+
+// One thread per core taking the same lock around a critical section of a few
+// arithmetic operations: the short-hold, high-contention regime WTF::Lock's
+// adaptive spinning is tuned for.
+void benchmark_lock(CommandLine& commandLine)
+{
+    size_t iterationsPerThread = 100000 * commandLine.scale();
+    unsigned threadCount = WTF::numberOfProcessorCores();
+
+    WTF::Lock lock;
+    size_t counter = 0;
+
+    WTF::Vector<RefPtr<WTF::Thread>> threads;
+    for (unsigned i = 0; i < threadCount; ++i) {
+        threads.append(WTF::Thread::create("WTFBench lock", [&] {
+            for (size_t j = 0; j < iterationsPerThread; ++j) {
+                WTF::Locker locker { lock };
+                counter = counter * 3 + 1;
+            }
+        }));
+    }
+    for (auto& thread : threads)
+        thread->waitForCompletion();
+
+    sink = counter;
+}
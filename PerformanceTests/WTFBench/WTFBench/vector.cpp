@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "vector.h"
+
+#include <wtf/Vector.h>
+
+static volatile size_t sink;
+
+// Growth from empty via append (the common child-list pattern), small vectors
+// that should stay within their inline capacity, and front insertion, which
+// pays the memmove cost on every call.
+void benchmark_vector(CommandLine& commandLine)
+{
+    size_t rounds = 2000 * commandLine.scale();
+
+    size_t total = 0;
+    for (size_t round = 0; round < rounds; ++round) {
+        WTF::Vector<size_t> grown;
+        for (size_t i = 0; i < 4096; ++i)
+            grown.append(i);
+        total += grown.last();
+
+        for (size_t i = 0; i < 64; ++i) {
+            WTF::Vector<size_t, 16> inlineVector;
+            for (size_t j = 0; j < 16; ++j)
+                inlineVector.append(j);
+            total += inlineVector.last();
+        }
+
+        WTF::Vector<size_t> shifted;
+        for (size_t i = 0; i < 256; ++i)
+            shifted.insert(0, i);
+        total += shifted.last();
+    }
+    sink = total;
+}
@@ -48,6 +48,7 @@
 #include "B3ReduceDoubleToFloat.h"
 #include "B3ReduceStrength.h"
 #include "B3Validate.h"
+#include "B3VectorizeLoops.h"
 #include "CompilerTimingScope.h"
 
 namespace JSC { namespace B3 {
@@ -87,6 +88,8 @@ void generateToAir(Procedure& procedure)
         // https://bugs.webkit.org/show_bug.cgi?id=212651
         if (Options::useB3HoistLoopInvariantValues())
             hoistLoopInvariantValues(procedure);
+        if (Options::useB3LoopVectorization())
+            vectorizeLoops(procedure);
         if (eliminateCommonSubexpressions(procedure))
             eliminateCommonSubexpressions(procedure);
         eliminateDeadCode(procedure);
@@ -0,0 +1,688 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "B3VectorizeLoops.h"
+
+#if ENABLE(B3_JIT)
+
+#include "B3BasicBlockInlines.h"
+#include "B3BlockInsertionSet.h"
+#include "B3Const32Value.h"
+#include "B3Const64Value.h"
+#include "B3EnsureLoopPreHeaders.h"
+#include "B3InsertionSetInlines.h"
+#include "B3MemoryValue.h"
+#include "B3NaturalLoops.h"
+#include "B3PhaseScope.h"
+#include "B3ProcedureInlines.h"
+#include "B3SIMDValue.h"
+#include "B3UpsilonValue.h"
+#include "B3ValueInlines.h"
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+
+namespace JSC { namespace B3 {
+
+namespace {
+
+namespace B3VectorizeLoopsInternal {
+static constexpr bool verbose = false;
+}
+
+// A stride-1 memory stream: the loop accesses base + (extend(index) << shift),
+// advancing by exactly one element per iteration.
+struct MemoryStream {
+    MemoryValue* memory { nullptr };
+    Value* base { nullptr };
+    Opcode extensionOpcode { Oops };
+    int32_t shiftAmount { 0 };
+};
+
+class LoopVectorizer {
+public:
+    LoopVectorizer(Procedure& proc, const NaturalLoop& loop)
+        : m_proc(proc)
+        , m_loop(loop)
+    {
+    }
+
+    // We only handle the narrowest shape that we can prove safe: a single-block
+    // do-while loop with one Int32 induction variable incremented by 1, whose
+    // body is a pure element-wise computation from stride-1 loads to stride-1
+    // stores of a single element type. Everything else keeps the scalar loop.
+    bool analyze()
+    {
+        if (m_loop.size() != 1)
+            return false;
+        m_header = m_loop.header();
+
+        Value* terminal = m_header->last();
+        if (terminal->opcode() != Branch)
+            return false;
+        if (m_header->successorBlock(0) != m_header || m_header->successorBlock(1) == m_header)
+            return false;
+
+        BasicBlock* preHeader = nullptr;
+        for (BasicBlock* predecessor : m_header->predecessors()) {
+            if (predecessor == m_header)
+                continue;
+            if (preHeader)
+                return false;
+            preHeader = predecessor;
+        }
+        if (!preHeader)
+            return false;
+
+        // Find the unique induction Phi and its backedge Upsilon.
+        for (Value* value : *m_header) {
+            if (value->opcode() == Phi) {
+                if (m_inductionPhi)
+                    return false;
+                m_inductionPhi = value;
+            }
+        }
+        if (!m_inductionPhi || m_inductionPhi->type() != Int32)
+            return false;
+
+        UpsilonValue* backEdgeUpsilon = nullptr;
+        for (Value* value : *m_header) {
+            if (value->opcode() != Upsilon)
+                continue;
+            UpsilonValue* upsilon = value->as<UpsilonValue>();
+            if (upsilon->phi() != m_inductionPhi)
+                return false;
+            if (backEdgeUpsilon)
+                return false;
+            backEdgeUpsilon = upsilon;
+        }
+        if (!backEdgeUpsilon)
+            return false;
+
+        m_update = backEdgeUpsilon->child(0);
+        if (m_update->opcode() != Add || m_update->child(0) != m_inductionPhi || !m_update->child(1)->isInt32(1))
+            return false;
+
+        m_condition = terminal->child(0);
+        switch (m_condition->opcode()) {
+        case LessThan:
+        case Below:
+            break;
+        default:
+            return false;
+        }
+        m_comparison = m_condition->opcode();
+        if (m_condition->child(0) != m_update)
+            return false;
+        m_limit = m_condition->child(1);
+        if (!isInvariant(m_limit))
+            return false;
+
+        m_classified.add(m_inductionPhi);
+        m_classified.add(backEdgeUpsilon);
+        m_classified.add(m_update);
+        m_classified.add(m_update->child(1));
+        m_classified.add(m_condition);
+        m_classified.add(terminal);
+
+        // Match every memory access as a stride-1 stream.
+        for (Value* value : *m_header) {
+            if (value->opcode() == Load) {
+                if (value->kind() != Load)
+                    return false;
+                MemoryValue* memory = value->as<MemoryValue>();
+                if (!matchStream(memory, memory->child(0), memory->type()))
+                    return false;
+                m_loads.append(buildStream(memory, memory->child(0)));
+                m_streamValues.add(value);
+                continue;
+            }
+            if (value->opcode() == Store) {
+                if (value->kind() != Store)
+                    return false;
+                MemoryValue* memory = value->as<MemoryValue>();
+                if (!matchStream(memory, memory->child(1), memory->child(0)->type()))
+                    return false;
+                m_stores.append(buildStream(memory, memory->child(1)));
+                m_streamValues.add(value);
+                continue;
+            }
+        }
+        if (m_stores.isEmpty())
+            return false;
+        if (m_loads.size() + m_stores.size() > 4)
+            return false;
+
+        switch (m_elementType.kind()) {
+        case Int32:
+            m_lane = SIMDLane::i32x4;
+            m_vectorLength = 4;
+            break;
+        case Float:
+            m_lane = SIMDLane::f32x4;
+            m_vectorLength = 4;
+            break;
+        case Double:
+            m_lane = SIMDLane::f64x2;
+            m_vectorLength = 2;
+            break;
+        default:
+            return false;
+        }
+
+        // An unsigned exit comparison with a sign-extending address would let a
+        // wrapping index break the monotonicity our range checks rely on.
+        if (m_comparison == Below) {
+            for (const MemoryStream* stream : allStreams()) {
+                if (stream->extensionOpcode != ZExt32)
+                    return false;
+            }
+        }
+
+        // Everything else in the loop must be an element-wise computation we
+        // know how to lift to 128-bit lanes.
+        for (Value* value : *m_header) {
+            if (m_classified.contains(value) || m_streamValues.contains(value))
+                continue;
+            if (value->isConstant()) {
+                m_classified.add(value);
+                continue;
+            }
+            switch (value->opcode()) {
+            case Add:
+            case Sub:
+            case Mul:
+            case Neg:
+                if (value->type() != m_elementType)
+                    return false;
+                break;
+            case Div:
+                if (value->type() != m_elementType || m_elementType == Int32)
+                    return false;
+                break;
+            case BitAnd:
+            case BitOr:
+            case BitXor:
+                if (m_elementType != Int32 || value->type() != Int32)
+                    return false;
+                break;
+            default:
+                return false;
+            }
+            for (Value* child : value->children()) {
+                if (child == m_inductionPhi)
+                    return false;
+                if (child->owner != m_header)
+                    continue;
+                if (child->isConstant())
+                    continue;
+                // In-loop operands must themselves be vectorizable loads or
+                // computations; index and address values are lane-dependent.
+                if (!m_streamValues.contains(child) && !m_computes.contains(child))
+                    return false;
+            }
+            m_computes.add(value);
+        }
+
+        // Stored values go through the same operand rules as compute operands;
+        // in particular, storing the index itself would be lane-dependent.
+        for (const MemoryStream& store : m_stores) {
+            Value* stored = store.memory->child(0);
+            if (stored == m_inductionPhi)
+                return false;
+            if (stored->owner == m_header && !stored->isConstant()
+                && !m_streamValues.contains(stored) && !m_computes.contains(stored))
+                return false;
+        }
+
+        // Loop-defined values must not escape the loop: the vector path skips
+        // scalar iterations entirely, so nothing downstream may observe them.
+        for (BasicBlock* block : m_proc) {
+            if (block == m_header)
+                continue;
+            for (Value* value : *block) {
+                for (Value* child : value->children()) {
+                    if (child->owner == m_header)
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void transform()
+    {
+        if (B3VectorizeLoopsInternal::verbose)
+            dataLog("Vectorizing loop with header ", pointerDump(m_header), "\n");
+
+        BlockInsertionSet blockInsertionSet(m_proc);
+        double frequency = m_header->frequency();
+        m_check = blockInsertionSet.insertBefore(m_header, frequency);
+        m_vectorLoop = blockInsertionSet.insertBefore(m_header, frequency);
+        m_middle = blockInsertionSet.insertBefore(m_header, frequency);
+
+        Vector<BasicBlock*, 4> entryPredecessors;
+        for (BasicBlock* predecessor : m_header->predecessors()) {
+            if (predecessor != m_header)
+                entryPredecessors.append(predecessor);
+        }
+        for (BasicBlock* predecessor : entryPredecessors)
+            predecessor->replaceSuccessor(m_header, m_check);
+
+        Origin origin = m_inductionPhi->origin();
+
+        // The check block observes the scalar induction state through its own
+        // Phi, fed by a mirror of every Upsilon that initializes the loop Phi.
+        m_entryPhi = m_check->appendNew<Value>(m_proc, Phi, Int32, origin);
+        m_vectorPhi = m_vectorLoop->appendNew<Value>(m_proc, Phi, Int32, origin);
+        m_check->appendNew<UpsilonValue>(m_proc, origin, m_entryPhi, m_vectorPhi);
+
+        for (BasicBlock* block : m_proc) {
+            if (block == m_header || block == m_check)
+                continue;
+            InsertionSet insertionSet(m_proc);
+            for (unsigned index = 0; index < block->size(); ++index) {
+                Value* value = block->at(index);
+                if (value->opcode() != Upsilon)
+                    continue;
+                UpsilonValue* upsilon = value->as<UpsilonValue>();
+                if (upsilon->phi() != m_inductionPhi)
+                    continue;
+                insertionSet.insert<UpsilonValue>(index + 1, upsilon->origin(), upsilon->child(0), m_entryPhi);
+            }
+            insertionSet.execute(block);
+        }
+
+        // Enter the vector loop only if a full vector's worth of iterations
+        // remains and no store stream can step on another stream. A store and
+        // a load over the exact same address sequence are fine: each vector
+        // group reads all lanes before it writes them, just like the scalar
+        // iterations it replaces.
+        Opcode extend = m_comparison == Below ? ZExt32 : SExt32;
+        m_extendedLimit = m_check->appendNew<Value>(m_proc, extend, origin, m_limit);
+        Value* extendedEntry = m_check->appendNew<Value>(m_proc, extend, origin, m_entryPhi);
+        Value* lastLane = m_check->appendNew<Value>(
+            m_proc, Add, origin, extendedEntry,
+            m_check->appendNew<Const64Value>(m_proc, origin, m_vectorLength - 1));
+        Value* canRunVector = m_check->appendNew<Value>(m_proc, m_comparison, origin, lastLane, m_extendedLimit);
+
+        if (m_comparison == LessThan) {
+            bool anyUnsignedAddress = false;
+            for (const MemoryStream* stream : allStreams())
+                anyUnsignedAddress |= stream->extensionOpcode == ZExt32;
+            if (anyUnsignedAddress) {
+                // Zero-extended addresses are only monotonic over non-negative
+                // indices, and our range endpoints assume monotonicity.
+                Value* nonNegative = m_check->appendNew<Value>(
+                    m_proc, GreaterEqual, origin, m_entryPhi,
+                    m_check->appendNew<Const32Value>(m_proc, origin, 0));
+                canRunVector = m_check->appendNew<Value>(m_proc, BitAnd, origin, canRunVector, nonNegative);
+            }
+        }
+
+        for (unsigned i = 0; i < m_stores.size(); ++i) {
+            for (const MemoryStream& load : m_loads)
+                canRunVector = appendOverlapCheck(canRunVector, m_stores[i], load);
+            for (unsigned j = i + 1; j < m_stores.size(); ++j)
+                canRunVector = appendOverlapCheck(canRunVector, m_stores[i], m_stores[j]);
+        }
+
+        buildVectorBody();
+
+        m_check->appendNew<Value>(m_proc, Branch, origin, canRunVector);
+        m_check->setSuccessors(FrequentedBlock(m_vectorLoop), FrequentedBlock(m_header));
+
+        // The scalar loop doubles as the remainder loop. It is a do-while, so
+        // only re-enter it if another iteration should actually run.
+        m_middle->appendNew<UpsilonValue>(m_proc, origin, m_vectorNextIndex, m_inductionPhi);
+        Value* reenterScalar = m_middle->appendNew<Value>(m_proc, m_comparison, origin, m_vectorNextIndex, m_limit);
+        m_middle->appendNew<Value>(m_proc, Branch, origin, reenterScalar);
+        m_middle->setSuccessors(FrequentedBlock(m_header), m_header->notTaken());
+
+        blockInsertionSet.execute();
+    }
+
+private:
+    bool isInvariant(Value* value) const { return value->owner != m_header; }
+
+    Vector<const MemoryStream*, 4> allStreams() const
+    {
+        Vector<const MemoryStream*, 4> result;
+        for (const MemoryStream& stream : m_loads)
+            result.append(&stream);
+        for (const MemoryStream& stream : m_stores)
+            result.append(&stream);
+        return result;
+    }
+
+    bool matchStream(MemoryValue* memory, Value* pointer, Type accessType)
+    {
+        if (memory->hasFence())
+            return false;
+        if (m_elementType == Void)
+            m_elementType = accessType;
+        else if (m_elementType != accessType)
+            return false;
+
+        int32_t elementSize;
+        switch (accessType.kind()) {
+        case Int32:
+        case Float:
+            elementSize = 4;
+            break;
+        case Double:
+            elementSize = 8;
+            break;
+        default:
+            return false;
+        }
+
+        if (pointer->opcode() != Add || pointer->type() != pointerType())
+            return false;
+        Value* base;
+        Value* scaled;
+        if (isInvariant(pointer->child(0)) && !isInvariant(pointer->child(1))) {
+            base = pointer->child(0);
+            scaled = pointer->child(1);
+        } else if (isInvariant(pointer->child(1)) && !isInvariant(pointer->child(0))) {
+            base = pointer->child(1);
+            scaled = pointer->child(0);
+        } else
+            return false;
+
+        if (scaled->opcode() != Shl || !scaled->child(1)->hasInt32())
+            return false;
+        if ((1 << scaled->child(1)->asInt32()) != elementSize)
+            return false;
+        Value* extension = scaled->child(0);
+        if (extension->opcode() != ZExt32 && extension->opcode() != SExt32)
+            return false;
+        if (extension->child(0) != m_inductionPhi)
+            return false;
+
+        m_classified.add(pointer);
+        m_classified.add(scaled);
+        m_classified.add(scaled->child(1));
+        m_classified.add(extension);
+        UNUSED_PARAM(base);
+        return true;
+    }
+
+    MemoryStream buildStream(MemoryValue* memory, Value* pointer)
+    {
+        Value* scaled = isInvariant(pointer->child(0)) ? pointer->child(1) : pointer->child(0);
+        Value* base = isInvariant(pointer->child(0)) ? pointer->child(0) : pointer->child(1);
+        return MemoryStream { memory, base, scaled->child(0)->opcode(), scaled->child(1)->asInt32() };
+    }
+
+    // The address of stream[index], with the MemoryValue's offset folded in, so
+    // the results are directly comparable as range endpoints.
+    Value* effectiveAddress(const MemoryStream& stream, Value* index)
+    {
+        Origin origin = stream.memory->origin();
+        Value* address = streamPointer(m_check, stream, index);
+        if (stream.memory->offset()) {
+            address = m_check->appendNew<Value>(
+                m_proc, Add, origin, address,
+                m_check->appendNew<Const64Value>(m_proc, origin, stream.memory->offset()));
+        }
+        return address;
+    }
+
+    Value* streamPointer(BasicBlock* block, const MemoryStream& stream, Value* index)
+    {
+        Origin origin = stream.memory->origin();
+        Value* extended = block->appendNew<Value>(m_proc, stream.extensionOpcode, origin, index);
+        Value* scaled = block->appendNew<Value>(
+            m_proc, Shl, origin, extended,
+            block->appendNew<Const32Value>(m_proc, origin, stream.shiftAmount));
+        return block->appendNew<Value>(m_proc, Add, origin, stream.base, scaled);
+    }
+
+    Value* appendOverlapCheck(Value* canRunVector, const MemoryStream& store, const MemoryStream& other)
+    {
+        Origin origin = store.memory->origin();
+        Value* storeStart = effectiveAddress(store, m_entryPhi);
+        Value* storeEnd = effectiveAddress(store, m_limit);
+        Value* otherStart = effectiveAddress(other, m_entryPhi);
+        Value* otherEnd = effectiveAddress(other, m_limit);
+
+        Value* aligned = m_check->appendNew<Value>(m_proc, Equal, origin, storeStart, otherStart);
+        Value* storeFirst = m_check->appendNew<Value>(m_proc, BelowEqual, origin, storeEnd, otherStart);
+        Value* otherFirst = m_check->appendNew<Value>(m_proc, BelowEqual, origin, otherEnd, storeStart);
+        Value* disjoint = m_check->appendNew<Value>(m_proc, BitOr, origin, storeFirst, otherFirst);
+        Value* safe = m_check->appendNew<Value>(m_proc, BitOr, origin, aligned, disjoint);
+        return m_check->appendNew<Value>(m_proc, BitAnd, origin, canRunVector, safe);
+    }
+
+    Value* splat(Value* scalar)
+    {
+        auto result = m_splats.add(scalar, nullptr);
+        if (result.isNewEntry) {
+            Value* source = scalar;
+            if (source->owner == m_header) {
+                // In-loop constants have to be rematerialized where the splat
+                // lives, since the check block does not dominate the loop.
+                ASSERT(source->isConstant());
+                Value* cloned = m_proc.clone(source);
+                m_check->append(cloned);
+                source = cloned;
+            }
+            result.iterator->value = m_check->appendNew<SIMDValue>(
+                m_proc, source->origin(), VectorSplat, V128, m_lane, SIMDSignMode::None, source);
+        }
+        return result.iterator->value;
+    }
+
+    Value* vectorOperand(Value* scalar)
+    {
+        if (scalar->owner == m_header && !scalar->isConstant()) {
+            Value* vector = m_vectorValues.get(scalar);
+            ASSERT(vector);
+            return vector;
+        }
+        return splat(scalar);
+    }
+
+    const MemoryStream* streamFor(MemoryValue* memory) const
+    {
+        for (const MemoryStream& stream : m_loads) {
+            if (stream.memory == memory)
+                return &stream;
+        }
+        for (const MemoryStream& stream : m_stores) {
+            if (stream.memory == memory)
+                return &stream;
+        }
+        return nullptr;
+    }
+
+    void buildVectorBody()
+    {
+        Origin origin = m_inductionPhi->origin();
+
+        // Clone the body in scalar program order so that grouped loads and
+        // stores keep their relative order; the overlap checks only reason
+        // about that order.
+        for (Value* value : *m_header) {
+            if (value->opcode() == Load) {
+                const MemoryStream* stream = streamFor(value->as<MemoryValue>());
+                Value* pointer = streamPointer(m_vectorLoop, *stream, m_vectorPhi);
+                Value* load = m_vectorLoop->appendNew<MemoryValue>(
+                    m_proc, Load, V128, value->origin(), pointer, stream->memory->offset());
+                m_vectorValues.add(value, load);
+                continue;
+            }
+            if (value->opcode() == Store) {
+                const MemoryStream* stream = streamFor(value->as<MemoryValue>());
+                Value* pointer = streamPointer(m_vectorLoop, *stream, m_vectorPhi);
+                m_vectorLoop->appendNew<MemoryValue>(
+                    m_proc, Store, value->origin(), vectorOperand(value->child(0)), pointer,
+                    stream->memory->offset());
+                continue;
+            }
+            if (!m_computes.contains(value))
+                continue;
+
+            Opcode vectorOpcode;
+            SIMDInfo info { m_lane, SIMDSignMode::None };
+            switch (value->opcode()) {
+            case Add:
+                vectorOpcode = VectorAdd;
+                break;
+            case Sub:
+                vectorOpcode = VectorSub;
+                break;
+            case Mul:
+                vectorOpcode = VectorMul;
+                break;
+            case Div:
+                vectorOpcode = VectorDiv;
+                break;
+            case Neg:
+                vectorOpcode = VectorNeg;
+                break;
+            case BitAnd:
+                vectorOpcode = VectorAnd;
+                info = SIMDInfo { SIMDLane::v128, SIMDSignMode::None };
+                break;
+            case BitOr:
+                vectorOpcode = VectorOr;
+                info = SIMDInfo { SIMDLane::v128, SIMDSignMode::None };
+                break;
+            case BitXor:
+                vectorOpcode = VectorXor;
+                info = SIMDInfo { SIMDLane::v128, SIMDSignMode::None };
+                break;
+            default:
+                RELEASE_ASSERT_NOT_REACHED();
+            }
+
+            Value* vector;
+            if (value->numChildren() == 1) {
+                vector = m_vectorLoop->appendNew<SIMDValue>(
+                    m_proc, value->origin(), vectorOpcode, V128, info, vectorOperand(value->child(0)));
+            } else {
+                vector = m_vectorLoop->appendNew<SIMDValue>(
+                    m_proc, value->origin(), vectorOpcode, V128, info,
+                    vectorOperand(value->child(0)), vectorOperand(value->child(1)));
+            }
+            m_vectorValues.add(value, vector);
+        }
+
+        m_vectorNextIndex = m_vectorLoop->appendNew<Value>(
+            m_proc, Add, origin, m_vectorPhi,
+            m_vectorLoop->appendNew<Const32Value>(m_proc, origin, m_vectorLength));
+        m_vectorLoop->appendNew<UpsilonValue>(m_proc, origin, m_vectorNextIndex, m_vectorPhi);
+
+        Opcode extend = m_comparison == Below ? ZExt32 : SExt32;
+        Value* extendedNext = m_vectorLoop->appendNew<Value>(m_proc, extend, origin, m_vectorNextIndex);
+        Value* nextLastLane = m_vectorLoop->appendNew<Value>(
+            m_proc, Add, origin, extendedNext,
+            m_vectorLoop->appendNew<Const64Value>(m_proc, origin, m_vectorLength - 1));
+        Value* continueVector = m_vectorLoop->appendNew<Value>(
+            m_proc, m_comparison, origin, nextLastLane, m_extendedLimit);
+        m_vectorLoop->appendNew<Value>(m_proc, Branch, origin, continueVector);
+        m_vectorLoop->setSuccessors(FrequentedBlock(m_vectorLoop), FrequentedBlock(m_middle));
+    }
+
+    Procedure& m_proc;
+    const NaturalLoop& m_loop;
+    BasicBlock* m_header { nullptr };
+
+    Value* m_inductionPhi { nullptr };
+    Value* m_update { nullptr };
+    Value* m_condition { nullptr };
+    Value* m_limit { nullptr };
+    Opcode m_comparison { Oops };
+
+    Type m_elementType { Void };
+    SIMDLane m_lane { SIMDLane::v128 };
+    unsigned m_vectorLength { 0 };
+
+    Vector<MemoryStream, 4> m_loads;
+    Vector<MemoryStream, 4> m_stores;
+    HashSet<Value*> m_classified;
+    HashSet<Value*> m_streamValues;
+    HashSet<Value*> m_computes;
+
+    BasicBlock* m_check { nullptr };
+    BasicBlock* m_vectorLoop { nullptr };
+    BasicBlock* m_middle { nullptr };
+    Value* m_entryPhi { nullptr };
+    Value* m_vectorPhi { nullptr };
+    Value* m_vectorNextIndex { nullptr };
+    Value* m_extendedLimit { nullptr };
+    HashMap<Value*, Value*> m_vectorValues;
+    HashMap<Value*, Value*> m_splats;
+};
+
+} // anonymous namespace
+
+bool vectorizeLoops(Procedure& proc)
+{
+    PhaseScope phaseScope(proc, "vectorizeLoops");
+
+    if (!Options::useWebAssemblySIMD())
+        return false;
+    if (pointerType() != Int64)
+        return false;
+
+    ensureLoopPreHeaders(proc);
+
+    bool changed = false;
+    HashSet<BasicBlock*> vectorizedHeaders;
+    for (;;) {
+        proc.resetValueOwners();
+        NaturalLoops& loops = proc.naturalLoops();
+        bool transformedThisRound = false;
+        for (unsigned loopIndex = loops.numLoops(); loopIndex--;) {
+            const NaturalLoop& loop = loops.loop(loopIndex);
+            if (vectorizedHeaders.contains(loop.header()))
+                continue;
+            LoopVectorizer vectorizer(proc, loop);
+            if (!vectorizer.analyze())
+                continue;
+            vectorizer.transform();
+            vectorizedHeaders.add(loop.header());
+            proc.setUsessSIMD();
+            proc.invalidateCFG();
+            proc.resetReachability();
+            changed = true;
+            transformedThisRound = true;
+            // The CFG changed, so the loop analysis is stale; recompute it
+            // before looking for more candidates.
+            break;
+        }
+        if (!transformedThisRound)
+            break;
+    }
+    return changed;
+}
+
+} } // namespace JSC::B3
+
+#endif // ENABLE(B3_JIT)
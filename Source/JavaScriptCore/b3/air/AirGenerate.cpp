@@ -111,7 +111,19 @@ void prepareForGeneration(Code& code)
     eliminateDeadCode(code);
 
     size_t numTmps = code.numTmps(Bank::GP) + code.numTmps(Bank::FP);
-    if (!code.usesSIMD() && (code.optLevel() == 1 || numTmps > Options::maximumTmpsForGraphColoring())) {
+    auto isHugeFunction = [&]() -> bool {
+        if (numTmps > Options::maximumTmpsForGraphColoring())
+            return true;
+        // Tmp count alone misses long stretches of straight-line numeric code that recycle a
+        // modest set of tmps across an enormous instruction stream. Graph coloring rebuilds
+        // interference over every instruction on each iteration, so such functions still see
+        // quadratic compile times. Fall back to linear scan for those too.
+        size_t instCount = 0;
+        for (BasicBlock* block : code)
+            instCount += block->size();
+        return instCount > Options::maximumAirInstsForGraphColoring();
+    };
+    if (!code.usesSIMD() && (code.optLevel() == 1 || isHugeFunction())) {
         // When we're compiling quickly, we do register and stack allocation in one linear scan
         // phase. It's fast because it computes liveness only once.
         allocateRegistersAndStackByLinearScan(code);
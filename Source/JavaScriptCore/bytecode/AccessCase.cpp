@@ -2023,6 +2023,25 @@ void AccessCase::generate(AccessGenerationState& state)
     generateImpl(state);
 }
 
+void AccessCase::noteSharedGeneratedBody(VM& vm)
+{
+    RELEASE_ASSERT(m_state == Committed);
+    m_state = Generated;
+
+    // generateImpl() starts watching the property for replacements when it emits an
+    // offset-based load. We are reusing a body generated for a different Structure, so
+    // replay that for the Structure this case guards.
+    switch (m_type) {
+    case Load:
+    case GetGetter:
+        if (isValidOffset(m_offset))
+            structure()->startWatchingPropertyForReplacements(vm, offset());
+        break;
+    default:
+        break;
+    }
+}
+
 void AccessCase::generateImpl(AccessGenerationState& state)
 {
     SuperSamplerScope superSamplerScope(false);
@@ -3151,6 +3170,39 @@ bool AccessCase::canBeShared(const AccessCase& lhs, const AccessCase& rhs)
     return true;
 }
 
+bool AccessCase::canShareGeneratedBody(const AccessCase& lhs, const AccessCase& rhs)
+{
+    // Prototype chain conditions, poly proto, and proxying all pull Structure identity
+    // (or pointers derived from it) into the emitted code, so bodies that involve them
+    // cannot be parameterized over the guarded Structure.
+    if (lhs.m_polyProtoAccessChain || rhs.m_polyProtoAccessChain)
+        return false;
+    if (!lhs.m_conditionSet.isEmpty() || !rhs.m_conditionSet.isEmpty())
+        return false;
+    if (lhs.m_viaProxy || rhs.m_viaProxy)
+        return false;
+
+    if (lhs.m_type != rhs.m_type)
+        return false;
+    if (lhs.m_offset != rhs.m_offset)
+        return false;
+    if (lhs.m_identifier != rhs.m_identifier)
+        return false;
+
+    switch (lhs.m_type) {
+    case Load:
+    case Miss:
+    case Replace:
+    case GetGetter:
+    case InHit:
+    case InMiss:
+        // These emit only offset-based loads/stores or constants after the guard.
+        return true;
+    default:
+        return false;
+    }
+}
+
 void AccessCase::operator delete(AccessCase* accessCase, std::destroying_delete_t)
 {
     accessCase->runWithDowncast([](auto* accessCase) {
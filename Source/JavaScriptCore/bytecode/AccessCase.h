@@ -304,6 +304,12 @@ public:
 
     static bool canBeShared(const AccessCase&, const AccessCase&);
 
+    // Says whether the code emitted after the structure check would be the same for both
+    // cases, so that a binary switch can dispatch multiple Structures to one body. This is
+    // deliberately narrower than canBeShared: it only admits cases whose generated code is
+    // provably independent of the Structure being guarded.
+    static bool canShareGeneratedBody(const AccessCase&, const AccessCase&);
+
     template<typename Func>
     void runWithDowncast(const Func&);
 
@@ -375,6 +381,10 @@ private:
     // Fall through on success, add a jump to the failure list on failure.
     void generate(AccessGenerationState&);
 
+    // Called instead of generate() when this case's body is a jump to a body that another
+    // case already generated. Replays the compile-time effects of generating the body.
+    void noteSharedGeneratedBody(VM&);
+
     void generateImpl(AccessGenerationState&);
 
     bool guardedByStructureCheckSkippingConstantIdentifierCheck() const;
@@ -717,10 +717,43 @@ AccessGenerationResult PolymorphicAccess::regenerate(const GCSafeConcurrentJSLoc
         Vector<int64_t> caseValues(cases.size());
         for (unsigned i = 0; i < cases.size(); ++i)
             caseValues[i] = bitwise_cast<int32_t>(cases[i]->structure()->id());
-        
+
+        // Sites fed by object shapes that only differ in some ancestor Structure produce
+        // case lists whose entries differ only in the Structure the guard checks; the code
+        // after the guard is identical. Emit one body per such equivalence class and point
+        // every matching switch entry at it, so the stub's size tracks the number of
+        // distinct shapes rather than the number of Structures.
+        Vector<unsigned> representative(cases.size());
+        for (unsigned i = 0; i < cases.size(); ++i) {
+            representative[i] = i;
+            for (unsigned j = 0; j < i; ++j) {
+                if (representative[j] == j && AccessCase::canShareGeneratedBody(*cases[j], *cases[i])) {
+                    representative[i] = j;
+                    break;
+                }
+            }
+        }
+
+        // BinarySwitch visits cases in tree order, so a case may be visited before its
+        // representative's body exists. Collect the jumps and link them once all bodies
+        // have been emitted.
+        Vector<CCallHelpers::Label> bodyLabels(cases.size());
+        Vector<CCallHelpers::JumpList> jumpsToBody(cases.size());
         BinarySwitch binarySwitch(state.scratchGPR, caseValues, BinarySwitch::Int32);
-        while (binarySwitch.advance(jit))
-            cases[binarySwitch.caseIndex()]->generate(state);
+        while (binarySwitch.advance(jit)) {
+            unsigned caseIndex = binarySwitch.caseIndex();
+            if (representative[caseIndex] != caseIndex) {
+                cases[caseIndex]->noteSharedGeneratedBody(vm);
+                jumpsToBody[representative[caseIndex]].append(jit.jump());
+                continue;
+            }
+            bodyLabels[caseIndex] = jit.label();
+            cases[caseIndex]->generate(state);
+        }
+        for (unsigned i = 0; i < cases.size(); ++i) {
+            if (!jumpsToBody[i].empty())
+                jumpsToBody[i].linkTo(bodyLabels[i], &jit);
+        }
         state.failAndRepatch.append(binarySwitch.fallThrough());
     }
 
@@ -378,6 +378,17 @@ int32_t UnlinkedCodeBlock::thresholdForJIT(int32_t threshold)
     return threshold;
 }
 
+void UnlinkedCodeBlock::noteDidOptimizeInPreviousRun()
+{
+    // A tier-up profile replays the effect of a successful OSR entry from an
+    // earlier run: mark the block as having optimized and re-lower the LLInt
+    // threshold, which was computed in the constructor before we knew.
+    if (didOptimize() != TriState::Indeterminate)
+        return;
+    setDidOptimize(TriState::True);
+    m_llintExecuteCounter.setNewThreshold(thresholdForJIT(Options::thresholdForJITAfterWarmUp()));
+}
+
 
 void UnlinkedCodeBlock::allocateSharedProfiles(unsigned numBinaryArithProfiles, unsigned numUnaryArithProfiles)
 {
@@ -296,6 +296,7 @@ public:
 
     TriState didOptimize() const { return static_cast<TriState>(m_didOptimize); }
     void setDidOptimize(TriState didOptimize) { m_didOptimize = static_cast<unsigned>(didOptimize); }
+    void noteDidOptimizeInPreviousRun();
 
     static constexpr unsigned maxAge = 7;
 
@@ -38,6 +38,7 @@
 #include "Parser.h"
 #include "SourceProvider.h"
 #include "Structure.h"
+#include "TierUpProfile.h"
 #include "UnlinkedFunctionCodeBlock.h"
 
 namespace JSC {
@@ -220,20 +221,32 @@ UnlinkedFunctionExecutable* UnlinkedFunctionExecutable::fromGlobalCode(
     return executable;
 }
 
+static ALWAYS_INLINE void applyTierUpProfile(UnlinkedFunctionCodeBlock* codeBlock, const SourceCode& source)
+{
+    if (LIKELY(!TierUpProfile::isEnabled()))
+        return;
+    if (codeBlock->didOptimize() == TriState::Indeterminate && ensureGlobalTierUpProfile().didOptimize(source))
+        codeBlock->noteDidOptimizeInPreviousRun();
+}
+
 UnlinkedFunctionCodeBlock* UnlinkedFunctionExecutable::unlinkedCodeBlockFor(
-    VM& vm, const SourceCode& source, CodeSpecializationKind specializationKind, 
+    VM& vm, const SourceCode& source, CodeSpecializationKind specializationKind,
     OptionSet<CodeGenerationMode> codeGenerationMode, ParserError& error, SourceParseMode parseMode)
 {
     if (m_isCached)
         decodeCachedCodeBlocks(vm);
     switch (specializationKind) {
     case CodeForCall:
-        if (UnlinkedFunctionCodeBlock* codeBlock = m_unlinkedCodeBlockForCall.get())
+        if (UnlinkedFunctionCodeBlock* codeBlock = m_unlinkedCodeBlockForCall.get()) {
+            applyTierUpProfile(codeBlock, source);
             return codeBlock;
+        }
         break;
     case CodeForConstruct:
-        if (UnlinkedFunctionCodeBlock* codeBlock = m_unlinkedCodeBlockForConstruct.get())
+        if (UnlinkedFunctionCodeBlock* codeBlock = m_unlinkedCodeBlockForConstruct.get()) {
+            applyTierUpProfile(codeBlock, source);
             return codeBlock;
+        }
         break;
     }
 
@@ -255,6 +268,7 @@ UnlinkedFunctionCodeBlock* UnlinkedFunctionExecutable::unlinkedCodeBlockFor(
     }
     // FIXME GlobalGC: Need syncrhonization here for accessing the Heap server.
     vm.heap.unlinkedFunctionExecutableSpaceAndSet.set.add(this);
+    applyTierUpProfile(result, source);
     return result;
 }
 
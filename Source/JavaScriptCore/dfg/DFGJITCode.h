@@ -168,7 +168,11 @@ public:
     static ptrdiff_t offsetOfExits() { return OBJECT_OFFSETOF(JITData, m_exits); }
     static ptrdiff_t offsetOfIsInvalidated() { return OBJECT_OFFSETOF(JITData, m_isInvalidated); }
 
-    static std::unique_ptr<JITData> tryCreate(VM&, CodeBlock*, const JITCode&, ExitVector&& exits);
+    // Allocation and layout only read the JITCode, so a compile thread can do
+    // them ahead of time. tryInitialize wires the result to the CodeBlock and
+    // installs watchpoints, so it must run on the main thread.
+    static std::unique_ptr<JITData> allocate(const JITCode&, ExitVector&& exits);
+    bool tryInitialize(VM&, CodeBlock*, const JITCode&);
 
     void setExitCode(unsigned exitIndex, MacroAssemblerCodeRef<OSRExitPtrTag> code)
     {
@@ -189,8 +193,6 @@ public:
 private:
     explicit JITData(const JITCode&, ExitVector&&);
 
-    bool tryInitialize(VM&, CodeBlock*, const JITCode&);
-
     FixedVector<StructureStubInfo> m_stubInfos;
     FixedVector<OptimizingCallLinkInfo> m_callLinkInfos;
     FixedVector<CodeBlockJettisoningWatchpoint> m_watchpoints;
@@ -305,12 +307,9 @@ public:
 #endif // ENABLE(FTL_JIT)
 };
 
-inline std::unique_ptr<JITData> JITData::tryCreate(VM& vm, CodeBlock* codeBlock, const JITCode& jitCode, ExitVector&& exits)
+inline std::unique_ptr<JITData> JITData::allocate(const JITCode& jitCode, ExitVector&& exits)
 {
-    auto result = std::unique_ptr<JITData> { new (NotNull, fastMalloc(Base::allocationSize(jitCode.m_linkerIR.size()))) JITData(jitCode, WTFMove(exits)) };
-    if (result->tryInitialize(vm, codeBlock, jitCode))
-        return result;
-    return nullptr;
+    return std::unique_ptr<JITData> { new (NotNull, fastMalloc(Base::allocationSize(jitCode.m_linkerIR.size()))) JITData(jitCode, WTFMove(exits)) };
 }
 
 } } // namespace JSC::DFG
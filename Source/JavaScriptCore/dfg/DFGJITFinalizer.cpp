@@ -31,6 +31,7 @@
 #include "CodeBlock.h"
 #include "CodeBlockWithJITType.h"
 #include "DFGPlan.h"
+#include "DFGThunks.h"
 #include "HeapInlines.h"
 #include "ProfilerDatabase.h"
 
@@ -42,6 +43,12 @@ JITFinalizer::JITFinalizer(Plan& plan, Ref<JITCode>&& jitCode, std::unique_ptr<L
     , m_linkBuffer(WTFMove(linkBuffer))
     , m_withArityCheck(withArityCheck)
 {
+    // The finalizer is constructed on the compile thread, so allocate and lay out
+    // the OSR exit state here; finalize() then only has to wire it to the
+    // CodeBlock on the main thread.
+    auto osrExitThunk = m_plan.vm()->getCTIStub(osrExitGenerationThunkGenerator).retagged<OSRExitPtrTag>();
+    auto exits = JITData::ExitVector::createWithSizeAndConstructorArguments(m_jitCode->m_osrExit.size(), osrExitThunk);
+    m_jitData = JITData::allocate(m_jitCode.get(), WTFMove(exits));
 }
 
 JITFinalizer::~JITFinalizer()
@@ -65,10 +72,9 @@ bool JITFinalizer::finalize()
 
     codeBlock->setJITCode(m_jitCode.copyRef());
 
-    auto data = m_plan.tryFinalizeJITData(m_jitCode.get());
-    if (UNLIKELY(!data))
+    if (UNLIKELY(!m_jitData->tryInitialize(vm, codeBlock, m_jitCode.get())))
         return false;
-    codeBlock->setDFGJITData(WTFMove(data));
+    codeBlock->setDFGJITData(WTFMove(m_jitData));
 
 #if ENABLE(FTL_JIT)
     m_jitCode->optimizeAfterWarmUp(codeBlock);
@@ -46,6 +46,7 @@ private:
     
     Ref<JITCode> m_jitCode;
     std::unique_ptr<LinkBuffer> m_linkBuffer;
+    std::unique_ptr<JITData> m_jitData;
     CodePtr<JSEntryPtrTag> m_withArityCheck;
 };
 
@@ -103,8 +103,6 @@ public:
     DeferredCompilationCallback* callback() const { return m_callback.get(); }
     void setCallback(Ref<DeferredCompilationCallback>&& callback) { m_callback = WTFMove(callback); }
 
-    std::unique_ptr<JITData> tryFinalizeJITData(const JITCode&);
-
 private:
     CompilationPath compileInThreadImpl() override;
     
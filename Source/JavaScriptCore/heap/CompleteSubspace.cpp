@@ -141,6 +141,7 @@ void* CompleteSubspace::tryAllocateSlow(VM& vm, size_t size, GCDeferralContext*
         set->add(allocation->cell());
     ASSERT(allocation->indexInSpace() == m_space.m_preciseAllocations.size() - 1);
     vm.heap.didAllocate(size);
+    didAllocate(size);
     m_space.m_capacity += size;
     
     m_preciseAllocations.append(allocation);
@@ -198,6 +199,7 @@ void* CompleteSubspace::reallocatePreciseAllocationNonVirtual(VM& vm, HeapCell*
 
     m_space.m_preciseAllocations[oldIndexInSpace] = allocation;
     vm.heap.didAllocate(difference);
+    didAllocate(difference);
     m_space.m_capacity += difference;
 
     m_preciseAllocations.append(allocation);
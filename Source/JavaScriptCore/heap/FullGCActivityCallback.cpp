@@ -50,6 +50,16 @@ void FullGCActivityCallback::doCollection(VM& vm)
     }
 #endif
 
+    // Tier down before collecting: jettisoned DFG/FTL blocks die in the coming full
+    // collection, which is when their executable memory actually goes back to the pool.
+    // We only do this for VMs that have sat idle for a while; a VM that is merely
+    // between event-loop turns would just pay to recompile its hot code.
+    if (MemoryPressureHandler::singleton().isUnderMemoryPressure() && !vm.entryScope) {
+        Seconds idleTime = MonotonicTime::now() - vm.lastEntryScopeEndTime;
+        if (idleTime >= Seconds(Options::memoryPressureOptimizedCodeIdleSeconds()))
+            heap.jettisonAllOptimizedCode();
+    }
+
     heap.collectAsync(CollectionScope::Full);
 }
 
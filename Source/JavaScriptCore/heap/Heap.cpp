@@ -63,6 +63,7 @@
 #include "MarkedSpaceInlines.h"
 #include "MarkingConstraintSet.h"
 #include "PreventCollectionScope.h"
+#include "RegExpCache.h"
 #include "SamplingProfiler.h"
 #include "ShadowChicken.h"
 #include "SpaceTimeMutatorScheduler.h"
@@ -890,8 +891,14 @@ void Heap::updateObjectCounts()
         m_totalBytesVisited = 0;
 
     m_totalBytesVisitedThisCycle = bytesVisited();
-    
+
     m_totalBytesVisited += m_totalBytesVisitedThisCycle;
+
+    m_objectSpace.forEachSubspace(
+        [&] (Subspace& subspace) -> IterationStatus {
+            subspace.updateLiveBytesAtEndOfCollection();
+            return IterationStatus::Continue;
+        });
 }
 
 void Heap::endMarking()
@@ -1043,6 +1050,23 @@ void Heap::deleteAllCodeBlocks(DeleteAllCodeEffort effort)
 #endif
 }
 
+void Heap::jettisonAllOptimizedCode()
+{
+    VM& vm = this->vm();
+    // Unlike deleteAllCodeBlocks, this only drops DFG/FTL code. Optimized blocks account
+    // for most of the executable pool but can be rebuilt from their baseline/LLInt
+    // alternatives, so this keeps an idle page quick to resume while the jettisoned
+    // blocks return their JIT memory at the next sweep.
+    RELEASE_ASSERT(!vm.entryScope);
+    completeAllJITPlans();
+
+    Locker codeBlockSetLocker { m_codeBlocks->getLock() };
+    forEachCodeBlockIgnoringJITPlans(codeBlockSetLocker, [&] (CodeBlock* codeBlock) {
+        if (JITCode::isOptimizingJIT(codeBlock->jitType()))
+            codeBlock->jettison(Profiler::JettisonDueToMemoryPressure);
+    });
+}
+
 void Heap::deleteAllUnlinkedCodeBlocks(DeleteAllCodeEffort effort)
 {
     if (m_collectionScope && effort == DeleteAllCodeIfNotCollecting)
@@ -1122,6 +1146,9 @@ void Heap::addToRememberedSet(const JSCell* constCell)
     // get scanned again. If we lose then someone else will barrier the object again. That would
     // be unfortunate but not the end of the world.
     cell->setCellState(CellState::PossiblyGrey);
+    // No lock: the API lock serializes mutator threads, so there is only ever one appender
+    // (or the collector itself, while the mutator is stopped). The stack's segments are
+    // transferred wholesale to the collector at the next handshake.
     m_mutatorMarkStack->append(cell);
 }
 
@@ -1609,8 +1636,10 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
         removeDeadCompilerWorklistEntries();
     }
 
+    sweepNonDestructibleBlocksAfterMarking();
+
     notifyIncrementalSweeper();
-    
+
     m_codeBlocks->iterateCurrentlyExecuting(
         [&] (CodeBlock* codeBlock) {
             writeBarrier(codeBlock);
@@ -1625,8 +1654,11 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
         m_verifier->verify(HeapVerifier::Phase::AfterGC);
     }
 
+    if (UNLIKELY(Options::dumpHeapFragmentationAfterFullGC()) && m_collectionScope && m_collectionScope.value() == CollectionScope::Full)
+        m_objectSpace.dumpFragmentation(WTF::dataFile());
+
     didFinishCollection();
-    
+
     if (m_currentRequest.didFinishEndPhase)
         m_currentRequest.didFinishEndPhase->run();
     
@@ -2154,8 +2186,10 @@ void Heap::finalize()
     if (HasOwnPropertyCache* cache = vm().hasOwnPropertyCache())
         cache->clear();
 
-    if (m_lastCollectionScope && m_lastCollectionScope.value() == CollectionScope::Full)
+    if (m_lastCollectionScope && m_lastCollectionScope.value() == CollectionScope::Full) {
         vm().jsonAtomStringCache.clear();
+        vm().regExpCache()->deleteCodeForIdleRegExps();
+    }
 
     m_possiblyAccessedStringsFromConcurrentThreads.clear();
 
@@ -2296,6 +2330,46 @@ void Heap::snapshotUnswept()
     m_objectSpace.snapshotUnswept();
 }
 
+void Heap::sweepNonDestructibleBlocksAfterMarking()
+{
+    if (!Options::useParallelPostMarkingSweep())
+        return;
+
+    TimingScope timingScope(*this, "Heap::sweepNonDestructibleBlocksAfterMarking");
+
+    // Destructible blocks have to keep sweeping in mutator context (the incremental
+    // sweeper), since destructors expect the API lock. Everything else is pure bit and
+    // footer manipulation, so the helper threads can sweep it while the world is still
+    // stopped. Each thread claims a whole directory at a time; that way no two threads
+    // ever write the same directory's bitvector words.
+    //
+    // FIXME: The option stays off by default because directory claiming is not enough:
+    // MarkedBlock::Handle::sweep still enters a SweepingScope, whose unsynchronized
+    // save/set/restore of Heap::m_mutatorState races across helper threads, and
+    // WeakSet::sweep mutates the Heap-global logically-empty-weak-block list
+    // (sweepNextLogicallyEmptyWeakBlock / addLogicallyEmptyWeakBlock) with no locking.
+    // The helper path needs to skip the scope and defer weak-set handling (or the
+    // weak-block list needs a lock) before this can default on.
+    Vector<BlockDirectory*> directories;
+    m_objectSpace.forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            if (!directory.needsDestruction())
+                directories.append(&directory);
+            return IterationStatus::Continue;
+        });
+
+    std::atomic<size_t> cursor { 0 };
+    m_helperClient.runFunctionInParallel(
+        [&] () {
+            for (;;) {
+                size_t index = cursor++;
+                if (index >= directories.size())
+                    return;
+                directories[index]->sweep();
+            }
+        });
+}
+
 void Heap::deleteSourceProviderCaches()
 {
     if (m_lastCollectionScope && m_lastCollectionScope.value() == CollectionScope::Full)
@@ -2906,10 +2980,19 @@ void Heap::addCoreConstraints()
     m_constraintSet->add(
         "Ws", "Weak Sets",
         MAKE_MARKING_CONSTRAINT_EXECUTOR_PAIR(([this] (auto& visitor) {
-            SetRootMarkReasonScope rootScope(visitor, RootMarkReason::WeakSets);
-            m_objectSpace.visitWeakSets(visitor);
+            // Weak set harvesting is mostly pointer chasing with no ordering
+            // requirement between sets, so hand the solver a task that lets each
+            // helper visitor claim whole weak sets instead of walking them all on
+            // one visitor.
+            auto visitWeakSet = [] (auto& visitor2, WeakSet* weakSet) {
+                SetRootMarkReasonScope rootScope(visitor2, RootMarkReason::WeakSets);
+                weakSet->visit(visitor2);
+            };
+            RefPtr<SharedTask<void(decltype(visitor)&)>> task = m_objectSpace.template forEachWeakSetInParallel<decltype(visitor)>(visitWeakSet);
+            visitor.addParallelConstraintTask(task);
         })),
-        ConstraintVolatility::GreyedByMarking);
+        ConstraintVolatility::GreyedByMarking,
+        ConstraintParallelism::Parallel);
     
     m_constraintSet->add(
         "O", "Output",
@@ -436,6 +436,7 @@ public:
 
     void deleteAllCodeBlocks(DeleteAllCodeEffort);
     void deleteAllUnlinkedCodeBlocks(DeleteAllCodeEffort);
+    JS_EXPORT_PRIVATE void jettisonAllOptimizedCode();
 
     void didAllocate(size_t);
     bool isPagedOut();
@@ -688,6 +689,7 @@ private:
     void pruneStaleEntriesFromWeakGCHashTables();
     void sweepArrayBuffers();
     void snapshotUnswept();
+    void sweepNonDestructibleBlocksAfterMarking();
     void deleteSourceProviderCaches();
     void notifyIncrementalSweeper();
     void harvestWeakReferences();
@@ -789,6 +791,11 @@ private:
     
     std::unique_ptr<SlotVisitor> m_collectorSlotVisitor;
     std::unique_ptr<SlotVisitor> m_mutatorSlotVisitor;
+    // The mutator's remembered set, in the form of a segmented sequential store buffer.
+    // Barriers append to it without synchronization: appends only ever come from the one
+    // thread that holds the API lock, or from the collector while the mutator is stopped.
+    // MarkStackMergingConstraint hands the accumulated segments to the collector wholesale
+    // at each constraint-solving handshake.
     std::unique_ptr<MarkStackArray> m_mutatorMarkStack;
     std::unique_ptr<MarkStackArray> m_raceMarkStack;
     std::unique_ptr<MarkingConstraintSet> m_constraintSet;
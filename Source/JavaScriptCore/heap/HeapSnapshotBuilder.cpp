@@ -350,8 +350,24 @@ String HeapSnapshotBuilder::json(Function<bool (const HeapSnapshotNode&)> allowN
     HashMap<UniquedStringImpl*, unsigned> edgeNameIndexes;
     unsigned nextEdgeNameIndex = 0;
 
+    // Node identity is already incremental: each buildSnapshot() records only
+    // cells unseen by earlier snapshots in the chain, and dead cells are swept
+    // out. Serialization is not — the frontend expects a self-contained
+    // version-2 document and edges span epochs, so every snapshot re-emits the
+    // whole chain as one JSON string. A diff-only or binary wire format is a
+    // Heap domain protocol change, not something this builder can do alone.
     StringBuilder json;
 
+    // On large heaps this string reaches hundreds of MB; reserving up front
+    // avoids repeatedly growing and copying the buffer while appending.
+    size_t nodeCount = 0;
+    for (HeapSnapshot* snapshot = m_profiler.mostRecentSnapshot(); snapshot; snapshot = snapshot->previous())
+        nodeCount += snapshot->m_nodes.size();
+    constexpr size_t estimatedBytesPerNode = 32;
+    constexpr size_t estimatedBytesPerEdge = 24;
+    size_t estimatedCapacity = nodeCount * estimatedBytesPerNode + m_edges.size() * estimatedBytesPerEdge;
+    json.reserveCapacity(static_cast<unsigned>(std::min<size_t>(estimatedCapacity, std::numeric_limits<unsigned>::max())));
+
     auto appendNodeJSON = [&] (const HeapSnapshotNode& node) {
         // Let the client decide if they want to allow or disallow certain nodes.
         if (!allowNodeCallback(node))
@@ -117,7 +117,8 @@ void* LocalAllocator::allocateSlowCase(Heap& heap, GCDeferralContext* deferralCo
 
     ASSERT(!m_directory->markedSpace().isIterating());
     heap.didAllocate(m_freeList.originalSize());
-    
+    m_directory->m_subspace->didAllocate(m_freeList.originalSize());
+
     didConsumeFreeList();
     
     AllocatingScope helpingHeap(heap);
@@ -273,22 +273,6 @@ void MarkedSpace::enablePreciseAllocationTracking()
         m_preciseAllocationSet->add(allocation->cell());
 }
 
-template<typename Visitor>
-void MarkedSpace::visitWeakSets(Visitor& visitor)
-{
-    auto visit = [&] (WeakSet* weakSet) {
-        weakSet->visit(visitor);
-    };
-    
-    m_newActiveWeakSets.forEach(visit);
-    
-    if (heap().collectionScope() == CollectionScope::Full)
-        m_activeWeakSets.forEach(visit);
-}
-
-template void MarkedSpace::visitWeakSets(AbstractSlotVisitor&);
-template void MarkedSpace::visitWeakSets(SlotVisitor&);
-
 void MarkedSpace::reapWeakSets()
 {
     auto visit = [&] (WeakSet* weakSet) {
@@ -573,6 +557,38 @@ void MarkedSpace::dumpBits(PrintStream& out)
         });
 }
 
+void MarkedSpace::dumpFragmentation(PrintStream& out)
+{
+    // Meaningful right after a full collection, when mark counts reflect liveness.
+    size_t totalBlockCount = 0;
+    size_t totalSparseBlockCount = 0;
+    size_t totalLiveBytes = 0;
+    forEachDirectory(
+        [&] (BlockDirectory& directory) -> IterationStatus {
+            size_t blockCount = 0;
+            size_t sparseBlockCount = 0;
+            size_t liveBytes = 0;
+            directory.forEachBlock(
+                [&] (MarkedBlock::Handle* block) {
+                    blockCount++;
+                    size_t blockLiveBytes = block->markCount() * directory.cellSize();
+                    liveBytes += blockLiveBytes;
+                    if (blockLiveBytes * 5 < MarkedBlock::blockSize)
+                        sparseBlockCount++;
+                });
+            if (sparseBlockCount) {
+                out.print("  ", directory, ": ", sparseBlockCount, "/", blockCount, " blocks <20% occupied, ",
+                    liveBytes / 1024, "kB live of ", blockCount * MarkedBlock::blockSize / 1024, "kB\n");
+            }
+            totalBlockCount += blockCount;
+            totalSparseBlockCount += sparseBlockCount;
+            totalLiveBytes += liveBytes;
+            return IterationStatus::Continue;
+        });
+    out.print("MarkedSpace fragmentation: ", totalSparseBlockCount, "/", totalBlockCount, " blocks <20% occupied, ",
+        totalLiveBytes / 1024, "kB live of ", totalBlockCount * MarkedBlock::blockSize / 1024, "kB\n");
+}
+
 void MarkedSpace::addBlockDirectory(const AbstractLocker&, BlockDirectory* directory)
 {
     directory->setNextDirectory(nullptr);
@@ -32,6 +32,7 @@
 #include <wtf/Noncopyable.h>
 #include <wtf/RetainPtr.h>
 #include <wtf/SentinelLinkedList.h>
+#include <wtf/SharedTask.h>
 #include <wtf/SinglyLinkedListWithTail.h>
 #include <wtf/Vector.h>
 
@@ -105,7 +106,7 @@ public:
     
     void prepareForAllocation();
 
-    template<typename Visitor> void visitWeakSets(Visitor&);
+    template<typename Visitor, typename Func> Ref<SharedTask<void(Visitor&)>> forEachWeakSetInParallel(const Func&);
     void reapWeakSets();
 
     MarkedBlockSet& blocks() { return m_blocks; }
@@ -175,6 +176,7 @@ public:
     bool isMarking() const { return m_isMarking; }
     
     void dumpBits(PrintStream& = WTF::dataFile());
+    void dumpFragmentation(PrintStream& = WTF::dataFile());
     
     JS_EXPORT_PRIVATE static std::array<unsigned, numSizeClasses> s_sizeClassForSizeStep;
     
@@ -60,6 +60,43 @@ template<typename Functor> inline void MarkedSpace::forEachLiveCell(const Functo
     }
 }
 
+template<typename Visitor, typename Func>
+Ref<SharedTask<void(Visitor&)>> MarkedSpace::forEachWeakSetInParallel(const Func& func)
+{
+    class Task final : public SharedTask<void(Visitor&)> {
+    public:
+        Task(MarkedSpace& space, const Func& func)
+            : m_func(func)
+        {
+            auto append = [&] (WeakSet* weakSet) {
+                m_weakSets.append(weakSet);
+            };
+            space.m_newActiveWeakSets.forEach(append);
+            if (space.heap().collectionScope() == CollectionScope::Full)
+                space.m_activeWeakSets.forEach(append);
+        }
+
+        void run(Visitor& visitor) final
+        {
+            // Whole weak sets are claimed at a time, so visitors never share a
+            // WeakBlock.
+            for (;;) {
+                size_t index = m_cursor.exchangeAdd(1);
+                if (index >= m_weakSets.size())
+                    return;
+                m_func(visitor, m_weakSets[index]);
+            }
+        }
+
+    private:
+        Func m_func;
+        Vector<WeakSet*> m_weakSets;
+        Atomic<size_t> m_cursor { 0 };
+    };
+
+    return adoptRef(*new Task(*this, func));
+}
+
 template<typename Functor> inline void MarkedSpace::forEachDeadCell(HeapIterationScope&, const Functor& functor)
 {
     ASSERT(isIterating());
@@ -129,6 +129,22 @@ void Subspace::sweepBlocks()
         });
 }
 
+void Subspace::updateLiveBytesAtEndOfCollection()
+{
+    // Called with the world stopped, after marking, so mark counts are stable.
+    size_t liveBytes = 0;
+    forEachMarkedBlock(
+        [&] (MarkedBlock::Handle* handle) {
+            liveBytes += handle->markCount() * handle->cellSize();
+        });
+    forEachPreciseAllocation(
+        [&] (PreciseAllocation* allocation) {
+            if (allocation->isMarked())
+                liveBytes += allocation->cellSize();
+        });
+    m_liveBytesAtLastCollection.store(liveBytes, std::memory_order_relaxed);
+}
+
 void Subspace::didResizeBits(unsigned)
 {
 }
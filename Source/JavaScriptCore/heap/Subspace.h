@@ -30,6 +30,7 @@
 #include "Allocator.h"
 #include "MarkedBlock.h"
 #include "MarkedSpace.h"
+#include <atomic>
 #include <wtf/text/CString.h>
 
 namespace JSC {
@@ -99,6 +100,16 @@ public:
 
     bool isIsoSubspace() const { return m_isIsoSubspace; }
 
+    // Liveness telemetry. Allocation is accounted at the same free-list-consumption
+    // granularity as Heap::didAllocate, so the cell allocation fast path stays
+    // untouched; live bytes are recomputed while the world is stopped at the end of
+    // each collection. Both counters use relaxed atomics, so a sampling thread can
+    // read them without forcing a collection or pausing the mutator.
+    void didAllocate(size_t bytes) { m_totalAllocatedBytes.fetch_add(bytes, std::memory_order_relaxed); }
+    size_t totalAllocatedBytes() const { return m_totalAllocatedBytes.load(std::memory_order_relaxed); }
+    size_t liveBytesAtLastCollection() const { return m_liveBytesAtLastCollection.load(std::memory_order_relaxed); }
+    void updateLiveBytesAtEndOfCollection();
+
 protected:
     Subspace(CString name, Heap&);
 
@@ -118,6 +129,9 @@ protected:
 
     Subspace* m_nextSubspaceInAlignedMemoryAllocator { nullptr };
 
+    std::atomic<size_t> m_totalAllocatedBytes { 0 };
+    std::atomic<size_t> m_liveBytesAtLastCollection { 0 };
+
     CString m_name;
 };
 
@@ -100,6 +100,17 @@ void ICStats::add(const ICEvent& event)
     m_spectrum.add(event);
 }
 
+Vector<std::pair<ICEvent, uint64_t>> ICStats::snapshot()
+{
+    Vector<std::pair<ICEvent, uint64_t>> result;
+    Locker spectrumLocker { m_spectrum.getLock() };
+    auto list = m_spectrum.buildList(spectrumLocker);
+    result.reserveInitialCapacity(list.size());
+    for (unsigned i = list.size(); i--;)
+        result.uncheckedAppend({ *list[i].key, list[i].count });
+    return result;
+}
+
 ICStats& ICStats::instance()
 {
     for (;;) {
@@ -205,9 +205,17 @@ public:
     ~ICStats();
     
     void add(const ICEvent& event);
-    
+
+    // Snapshot for programmatic consumers like $vm.icStats(), ordered from highest
+    // count to lowest.
+    Vector<std::pair<ICEvent, uint64_t>> snapshot();
+
     static ICStats& instance();
-    
+
+    // Events are only logged under Options::useICStats(), so consumers that merely
+    // read the stats should not instantiate the singleton (and its logging thread).
+    static ICStats* instanceIfExists() { return s_instance.load(); }
+
 private:
 
     Spectrum<ICEvent, uint64_t> m_spectrum;
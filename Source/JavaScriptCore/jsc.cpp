@@ -38,6 +38,7 @@
 #include "Disassembler.h"
 #include "Exception.h"
 #include "ExceptionHelpers.h"
+#include "HeapInlines.h"
 #include "HeapSnapshotBuilder.h"
 #include "InitializeThreading.h"
 #include "Interpreter.h"
@@ -447,6 +448,7 @@ public:
     Vector<String> m_arguments;
     String m_profilerOutput;
     String m_uncaughtExceptionName;
+    String m_recordWarmupPath;
     bool m_interactive { false };
     bool m_dump { false };
     bool m_module { false };
@@ -3586,6 +3588,8 @@ static NO_RETURN void printUsageStatement(bool help = false)
     fprintf(stderr, "  --watchdog-exception-ok    Uncaught watchdog exceptions exit with success\n");
     fprintf(stderr, "  --dumpException            Dump uncaught exception text\n");
     fprintf(stderr, "  --footprint                Dump memory footprint after done executing\n");
+    fprintf(stderr, "  --record-warmup=<file>     Write the JIT tier reached by each function to the given file at exit\n");
+    fprintf(stderr, "  --replay-warmup=<file>     Lower tier-up thresholds for the tiers a recorded profile reached\n");
     fprintf(stderr, "  --options                  Dumps all JSC VM options and exits\n");
     fprintf(stderr, "  --dumpOptions              Dumps all non-default JSC VM options before continuing\n");
     fprintf(stderr, "  --<jsc VM option>=<value>  Sets the specified JSC VM option\n");
@@ -3776,6 +3780,48 @@ void CommandLine::parseArguments(int argc, char** argv)
             continue;
         }
 
+        static const unsigned recordWarmupStrLength = strlen("--record-warmup=");
+        if (!strncmp(arg, "--record-warmup=", recordWarmupStrLength)) {
+            m_recordWarmupPath = String::fromLatin1(argv[i] + recordWarmupStrLength);
+            continue;
+        }
+
+        static const unsigned replayWarmupStrLength = strlen("--replay-warmup=");
+        if (!strncmp(arg, "--replay-warmup=", replayWarmupStrLength)) {
+            // The profile cannot be replayed literally: Structures and compiled code
+            // embed per-boot pointers (globals, prototypes, stubs), so pre-creating
+            // them from a file is not possible. Instead, treat the profile as
+            // evidence of how far this workload climbs the tier ladder and lower the
+            // tier-up thresholds for exactly those tiers, so the VM stops waiting
+            // for warm-up it already knows is coming.
+            const char* path = argv[i] + replayWarmupStrLength;
+            FILE* profile = fopen(path, "r");
+            if (!profile) {
+                fprintf(stderr, "Could not open warmup profile: %s\n", path);
+                continue;
+            }
+            bool sawBaseline = false;
+            bool sawDFG = false;
+            bool sawFTL = false;
+            char line[1024];
+            while (fgets(line, sizeof(line), profile)) {
+                if (!strncmp(line, "Baseline\t", 9))
+                    sawBaseline = true;
+                else if (!strncmp(line, "DFG\t", 4))
+                    sawDFG = true;
+                else if (!strncmp(line, "FTL\t", 4))
+                    sawFTL = true;
+            }
+            fclose(profile);
+            if (sawBaseline)
+                JSC::Options::thresholdForJITAfterWarmUp() = 10;
+            if (sawDFG)
+                JSC::Options::thresholdForOptimizeAfterWarmUp() = 100;
+            if (sawFTL)
+                JSC::Options::thresholdForFTLOptimizeAfterWarmUp() = 1000;
+            continue;
+        }
+
         if (!strcmp(arg, "--dumpLinkBufferStats")) {
             m_dumpLinkBufferStats = true;
             continue;
@@ -3927,6 +3973,20 @@ int runJSC(const CommandLine& options, bool isWorker, const Func& func)
         dataLogLn(*vm.jitSizeStatistics);
 #endif
 
+    if (!options.m_recordWarmupPath.isEmpty()) {
+        JSLockHolder locker(&vm);
+        if (FILE* out = fopen(options.m_recordWarmupPath.utf8().data(), "w")) {
+            vm.heap.forEachCodeBlock([&] (CodeBlock* codeBlock) {
+                JITType jitType = codeBlock->jitType();
+                if (jitType != JITType::BaselineJIT && jitType != JITType::DFGJIT && jitType != JITType::FTLJIT)
+                    return;
+                fprintf(out, "%s\t%s:%d\t%s\n", JITCode::typeName(jitType).characters(), codeBlock->ownerExecutable()->sourceURL().utf8().data(), codeBlock->ownerExecutable()->firstLine(), codeBlock->inferredName().data());
+            });
+            fclose(out);
+        } else
+            fprintf(stderr, "Could not open warmup profile for writing: %s\n", options.m_recordWarmupPath.utf8().data());
+    }
+
     vm.codeCache()->write();
 
     if (options.m_destroyVM || isWorker) {
@@ -65,6 +65,9 @@ void printInternal(PrintStream& out, JettisonReason reason)
     case JettisonDueToOldAge:
         out.print("JettisonDueToOldAge");
         return;
+    case JettisonDueToMemoryPressure:
+        out.print("JettisonDueToMemoryPressure");
+        return;
     case JettisonDueToVMTraps:
         out.print("JettisonDueToVMTraps");
         return;
@@ -38,6 +38,7 @@ enum JettisonReason {
     JettisonDueToProfiledWatchpoint,
     JettisonDueToUnprofiledWatchpoint,
     JettisonDueToOldAge,
+    JettisonDueToMemoryPressure,
     JettisonDueToVMTraps
 };
 
@@ -28,6 +28,7 @@
 
 #include "BytecodeGenerator.h"
 #include "IndirectEvalExecutable.h"
+#include "TierUpProfile.h"
 
 namespace JSC {
 
@@ -170,6 +171,8 @@ UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableT
             source.provider()->setSourceURLDirective(unlinkedCodeBlock->sourceURLDirective());
         if (unlinkedCodeBlock->sourceMappingURLDirective())
             source.provider()->setSourceMappingURLDirective(unlinkedCodeBlock->sourceMappingURLDirective());
+        if (UNLIKELY(TierUpProfile::isEnabled()) && unlinkedCodeBlock->didOptimize() == TriState::Indeterminate && ensureGlobalTierUpProfile().didOptimize(source))
+            unlinkedCodeBlock->noteDidOptimizeInPreviousRun();
         return unlinkedCodeBlock;
     }
 
@@ -183,6 +186,9 @@ UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableT
         });
     }
 
+    if (UNLIKELY(TierUpProfile::isEnabled()) && unlinkedCodeBlock && ensureGlobalTierUpProfile().didOptimize(source))
+        unlinkedCodeBlock->noteDidOptimizeInPreviousRun();
+
     return unlinkedCodeBlock;
 }
 
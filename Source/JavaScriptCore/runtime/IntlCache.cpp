@@ -65,4 +65,23 @@ Vector<UChar, 32> IntlCache::getFieldDisplayName(const CString& locale, UDateTim
     return buffer;
 }
 
+RefPtr<IntlSharedDateFormat> IntlCache::sharedDateFormat(const String& key) const
+{
+    auto iterator = m_sharedDateFormats.find(key);
+    if (iterator == m_sharedDateFormats.end())
+        return nullptr;
+    return iterator->value.ptr();
+}
+
+Ref<IntlSharedDateFormat> IntlCache::addSharedDateFormat(const String& key, Ref<IntlSharedDateFormat>&& dateFormat)
+{
+    // Pages constructing many distinct formatters are rare; when the cap is hit,
+    // dropping the whole map is fine since live formatters keep their backends alive.
+    if (m_sharedDateFormats.size() >= maxSharedDateFormats)
+        m_sharedDateFormats.clear();
+    auto result = dateFormat.copyRef();
+    m_sharedDateFormats.add(key, WTFMove(dateFormat));
+    return result;
+}
+
 } // namespace JSC
@@ -25,13 +25,38 @@
 
 #pragma once
 
+#include <unicode/udat.h>
 #include <unicode/udatpg.h>
+#include <wtf/HashMap.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/RefCounted.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
 #include <wtf/unicode/icu/ICUHelpers.h>
 
 namespace JSC {
 
+// A fully configured UDateFormat backend. IntlDateTimeFormat never mutates its
+// UDateFormat after construction, so instances created with the same locale,
+// pattern, and time zone can share one backend via the VM's IntlCache.
+class IntlSharedDateFormat : public RefCounted<IntlSharedDateFormat> {
+public:
+    static Ref<IntlSharedDateFormat> create(std::unique_ptr<UDateFormat, ICUDeleter<udat_close>>&& dateFormat)
+    {
+        return adoptRef(*new IntlSharedDateFormat(WTFMove(dateFormat)));
+    }
+
+    UDateFormat* dateFormat() const { return m_dateFormat.get(); }
+
+private:
+    explicit IntlSharedDateFormat(std::unique_ptr<UDateFormat, ICUDeleter<udat_close>>&& dateFormat)
+        : m_dateFormat(WTFMove(dateFormat))
+    {
+    }
+
+    std::unique_ptr<UDateFormat, ICUDeleter<udat_close>> m_dateFormat;
+};
+
 class IntlCache {
     WTF_MAKE_NONCOPYABLE(IntlCache);
     WTF_MAKE_FAST_ALLOCATED;
@@ -41,6 +66,9 @@ public:
     Vector<UChar, 32> getBestDateTimePattern(const CString& locale, const UChar* skeleton, unsigned skeletonSize, UErrorCode&);
     Vector<UChar, 32> getFieldDisplayName(const CString& locale, UDateTimePatternField, UDateTimePGDisplayWidth, UErrorCode&);
 
+    RefPtr<IntlSharedDateFormat> sharedDateFormat(const String& key) const;
+    Ref<IntlSharedDateFormat> addSharedDateFormat(const String& key, Ref<IntlSharedDateFormat>&&);
+
 private:
     UDateTimePatternGenerator* getSharedPatternGenerator(const CString& locale, UErrorCode& status)
     {
@@ -53,8 +81,11 @@ private:
 
     UDateTimePatternGenerator* cacheSharedPatternGenerator(const CString& locale, UErrorCode&);
 
+    static constexpr unsigned maxSharedDateFormats = 32;
+
     std::unique_ptr<UDateTimePatternGenerator, ICUDeleter<udatpg_close>> m_cachedDateTimePatternGenerator;
     CString m_cachedDateTimePatternGeneratorLocale;
+    HashMap<String, Ref<IntlSharedDateFormat>> m_sharedDateFormats;
 };
 
 } // namespace JSC
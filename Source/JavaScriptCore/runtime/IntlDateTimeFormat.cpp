@@ -992,18 +992,27 @@ void IntlDateTimeFormat::initializeDateTimeFormat(JSGlobalObject* globalObject,
 
     dataLogLnIf(IntlDateTimeFormatInternal::verbose, "locale:(", m_locale, "),dataLocale:(", dataLocaleWithExtensions, "),pattern:(", pattern, ")");
 
-    UErrorCode status = U_ZERO_ERROR;
-    StringView timeZoneView(m_timeZone);
-    m_dateFormat = std::unique_ptr<UDateFormat, UDateFormatDeleter>(udat_open(UDAT_PATTERN, UDAT_PATTERN, dataLocaleWithExtensions.data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), pattern.upconvertedCharacters(), pattern.length(), &status));
-    if (U_FAILURE(status)) {
-        throwTypeError(globalObject, scope, "failed to initialize DateTimeFormat"_s);
-        return;
-    }
+    // The backing UDateFormat is never mutated after this point, so formatters with the
+    // same data locale, pattern, and time zone can share one backend through the VM's
+    // IntlCache. Repeated construction with the same options then skips udat_open.
+    String sharedFormatKey = makeString(StringView::fromLatin1(dataLocaleWithExtensions.data()), '\n', pattern, '\n', m_timeZone);
+    m_dateFormat = vm.intlCache().sharedDateFormat(sharedFormatKey);
+    if (!m_dateFormat) {
+        UErrorCode status = U_ZERO_ERROR;
+        StringView timeZoneView(m_timeZone);
+        auto dateFormat = std::unique_ptr<UDateFormat, UDateFormatDeleter>(udat_open(UDAT_PATTERN, UDAT_PATTERN, dataLocaleWithExtensions.data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), pattern.upconvertedCharacters(), pattern.length(), &status));
+        if (U_FAILURE(status)) {
+            throwTypeError(globalObject, scope, "failed to initialize DateTimeFormat"_s);
+            return;
+        }
+
+        // Gregorian calendar should be used from the beginning of ECMAScript time.
+        // Failure here means unsupported calendar, and can safely be ignored.
+        UCalendar* cal = const_cast<UCalendar*>(udat_getCalendar(dateFormat.get()));
+        ucal_setGregorianChange(cal, minECMAScriptTime, &status);
 
-    // Gregorian calendar should be used from the beginning of ECMAScript time.
-    // Failure here means unsupported calendar, and can safely be ignored.
-    UCalendar* cal = const_cast<UCalendar*>(udat_getCalendar(m_dateFormat.get()));
-    ucal_setGregorianChange(cal, minECMAScriptTime, &status);
+        m_dateFormat = vm.intlCache().addSharedDateFormat(sharedFormatKey, IntlSharedDateFormat::create(WTFMove(dateFormat)));
+    }
 }
 
 ASCIILiteral IntlDateTimeFormat::hourCycleString(HourCycle hourCycle)
@@ -1286,7 +1295,7 @@ JSValue IntlDateTimeFormat::format(JSGlobalObject* globalObject, double value) c
         return throwRangeError(globalObject, scope, "date value is not finite in DateTimeFormat format()"_s);
 
     Vector<UChar, 32> result;
-    auto status = callBufferProducingFunction(udat_format, m_dateFormat.get(), value, result, nullptr);
+    auto status = callBufferProducingFunction(udat_format, m_dateFormat->dateFormat(), value, result, nullptr);
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "failed to format date value"_s);
 
@@ -1373,7 +1382,7 @@ JSValue IntlDateTimeFormat::formatToParts(JSGlobalObject* globalObject, double v
         return throwTypeError(globalObject, scope, "failed to open field position iterator"_s);
 
     Vector<UChar, 32> result;
-    status = callBufferProducingFunction(udat_formatForFields, m_dateFormat.get(), value, result, fields.get());
+    status = callBufferProducingFunction(udat_formatForFields, m_dateFormat->dateFormat(), value, result, fields.get());
     if (U_FAILURE(status))
         return throwTypeError(globalObject, scope, "failed to format date value"_s);
 
@@ -1433,7 +1442,7 @@ UDateIntervalFormat* IntlDateTimeFormat::createDateIntervalFormatIfNecessary(JSG
 
     Vector<UChar, 32> pattern;
     {
-        auto status = callBufferProducingFunction(udat_toPattern, m_dateFormat.get(), false, pattern);
+        auto status = callBufferProducingFunction(udat_toPattern, m_dateFormat->dateFormat(), false, pattern);
         if (U_FAILURE(status)) {
             throwTypeError(globalObject, scope, "failed to initialize DateIntervalFormat"_s);
             return nullptr;
@@ -1571,7 +1580,7 @@ JSValue IntlDateTimeFormat::formatRange(JSGlobalObject* globalObject, double sta
 
 #if HAVE(ICU_U_DATE_INTERVAL_FORMAT_FORMAT_RANGE_TO_PARTS)
     UErrorCode status = U_ZERO_ERROR;
-    auto result = formattedValueFromDateRange(*dateIntervalFormat, *m_dateFormat, startDate, endDate, status);
+    auto result = formattedValueFromDateRange(*dateIntervalFormat, *m_dateFormat->dateFormat(), startDate, endDate, status);
     if (U_FAILURE(status)) {
         throwTypeError(globalObject, scope, "Failed to format date interval"_s);
         return { };
@@ -1637,7 +1646,7 @@ JSValue IntlDateTimeFormat::formatRangeToParts(JSGlobalObject* globalObject, dou
     RETURN_IF_EXCEPTION(scope, { });
 
     UErrorCode status = U_ZERO_ERROR;
-    auto result = formattedValueFromDateRange(*dateIntervalFormat, *m_dateFormat, startDate, endDate, status);
+    auto result = formattedValueFromDateRange(*dateIntervalFormat, *m_dateFormat->dateFormat(), startDate, endDate, status);
     if (U_FAILURE(status)) {
         throwTypeError(globalObject, scope, "Failed to format date interval"_s);
         return { };
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "IntlCache.h"
 #include "JSObject.h"
 #include <unicode/udat.h>
 #include <wtf/unicode/icu/ICUHelpers.h>
@@ -130,7 +131,7 @@ private:
     using UDateFormatDeleter = ICUDeleter<udat_close>;
 
     WriteBarrier<JSBoundFunction> m_boundFormat;
-    std::unique_ptr<UDateFormat, UDateFormatDeleter> m_dateFormat;
+    RefPtr<IntlSharedDateFormat> m_dateFormat;
     std::unique_ptr<UDateIntervalFormat, UDateIntervalFormatDeleter> m_dateIntervalFormat;
 
     String m_locale;
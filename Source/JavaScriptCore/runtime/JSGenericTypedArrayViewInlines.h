@@ -217,9 +217,31 @@ bool JSGenericTypedArrayView<Adaptor>::setWithSpecificType(
 
     unsigned otherElementSize = sizeof(typename OtherAdaptor::Type);
 
+    bool definitelyNonOverlapping = !hasArrayBuffer() || !other->hasArrayBuffer()
+        || existingBuffer() != other->existingBuffer();
+
+    // Float -> Uint8Clamped is the conversion image and canvas code leans on. The
+    // generic path branches on NaN and both clamp limits per element, which defeats the
+    // vectorizer; this equivalent select-based form compiles to straight-line vector
+    // code. The comparisons send NaN to 0 like toNativeFromDouble, and nearbyint
+    // matches lrint under the default rounding mode. Only safe when the buffers
+    // cannot alias, since it stores in blocks rather than strictly left to right.
+    if constexpr (Adaptor::typeValue == TypeUint8Clamped && OtherAdaptor::isFloat) {
+        if (definitelyNonOverlapping) {
+            uint8_t* destination = typedVector() + offset;
+            const typename OtherAdaptor::Type* source = other->typedVector() + otherOffset;
+            for (size_t i = 0; i < length; ++i) {
+                double value = source[i];
+                value = value > 0 ? value : 0;
+                value = value < 255 ? value : 255;
+                destination[i] = static_cast<uint8_t>(std::nearbyint(value));
+            }
+            return true;
+        }
+    }
+
     // Handle cases (1) and (2A).
-    if (!hasArrayBuffer() || !other->hasArrayBuffer()
-        || existingBuffer() != other->existingBuffer()
+    if (definitelyNonOverlapping
         || (elementSize == otherElementSize && (static_cast<void*>(typedVector() + offset) <= static_cast<void*>(other->typedVector() + otherOffset)))
         || type == CopyType::LeftToRight) {
         for (size_t i = 0; i < length; ++i) {
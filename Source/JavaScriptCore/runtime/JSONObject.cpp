@@ -1478,6 +1478,17 @@ JSValue JSONParseWithException(JSGlobalObject* globalObject, StringView json)
     return result;
 }
 
+// On the prospect of a streaming UTF-8 stringify for very large snapshots: the
+// output string is already 8-bit whenever the stringified content is Latin-1
+// (both FastStringifier's buffer and StringBuilder narrow automatically), so
+// for typical ASCII-heavy payloads the later UTF-8 conversion is a byte copy,
+// not a widening pass — the real cost of this API shape is holding the whole
+// result in memory at once. The StringBuilder threaded through
+// appendStringifiedValue is the natural seam for a sink abstraction, but
+// chunked emission cannot be bolted on from outside: replacer functions and
+// toJSON can run arbitrary JS between chunks, so a flush boundary has to keep
+// the holder stack valid across GC and re-entry. That makes this a stringifier
+// rewrite, not an API wrapper, and it should be designed as such.
 String JSONStringify(JSGlobalObject* globalObject, JSValue value, JSValue space)
 {
     return stringify(*globalObject, value, jsNull(), space);
@@ -32,7 +32,7 @@ namespace JSC {
 
 const ClassInfo JSPropertyNameEnumerator::s_info = { "JSPropertyNameEnumerator"_s, nullptr, nullptr, nullptr, CREATE_METHOD_TABLE(JSPropertyNameEnumerator) };
 
-JSPropertyNameEnumerator* JSPropertyNameEnumerator::create(VM& vm, Structure* structure, uint32_t indexedLength, uint32_t numberStructureProperties, PropertyNameArray&& propertyNames)
+JSPropertyNameEnumerator* JSPropertyNameEnumerator::create(VM& vm, Structure* structure, uint32_t indexedLength, uint32_t numberStructureProperties, PropertyNameArray&& propertyNames, JSPropertyNameEnumerator* previousEnumerator)
 {
     unsigned propertyNamesSize = propertyNames.size();
     unsigned propertyNamesBufferSizeInBytes = Checked<unsigned>(propertyNamesSize) * sizeof(WriteBarrier<JSString>);
@@ -43,7 +43,7 @@ JSPropertyNameEnumerator* JSPropertyNameEnumerator::create(VM& vm, Structure* st
             propertyNamesBuffer[i].clear();
     }
     JSPropertyNameEnumerator* enumerator = new (NotNull, allocateCell<JSPropertyNameEnumerator>(vm)) JSPropertyNameEnumerator(vm, structure, indexedLength, numberStructureProperties, propertyNamesBuffer, propertyNamesSize);
-    enumerator->finishCreation(vm, propertyNames.releaseData());
+    enumerator->finishCreation(vm, propertyNames.releaseData(), previousEnumerator);
     return enumerator;
 }
 
@@ -64,7 +64,7 @@ JSPropertyNameEnumerator::JSPropertyNameEnumerator(VM& vm, Structure* structure,
         m_flags |= JSPropertyNameEnumerator::GenericMode;
 }
 
-void JSPropertyNameEnumerator::finishCreation(VM& vm, RefPtr<PropertyNameArrayData>&& identifiers)
+void JSPropertyNameEnumerator::finishCreation(VM& vm, RefPtr<PropertyNameArrayData>&& identifiers, JSPropertyNameEnumerator* previousEnumerator)
 {
     Base::finishCreation(vm);
 
@@ -72,6 +72,17 @@ void JSPropertyNameEnumerator::finishCreation(VM& vm, RefPtr<PropertyNameArrayDa
     ASSERT(m_endGenericPropertyIndex == vector.size());
     for (unsigned i = 0; i < vector.size(); ++i) {
         const Identifier& identifier = vector[i];
+        // When the structure this enumerator replaces only grew (the common churn after a
+        // transition), its enumerator already owns JSStrings for the shared prefix of the
+        // name list. Both sides hold the atomized impl, so pointer identity suffices, and
+        // enumerators are immutable so sharing the cells is safe.
+        if (previousEnumerator) {
+            JSString* cached = previousEnumerator->propertyNameAtIndex(i);
+            if (cached && cached->tryGetValueImpl() == identifier.impl()) {
+                m_propertyNames.get()[i].set(vm, this, cached);
+                continue;
+            }
+        }
         m_propertyNames.get()[i].set(vm, this, jsString(vm, identifier.string()));
     }
 }
@@ -54,7 +54,7 @@ public:
         return &vm.propertyNameEnumeratorSpace();
     }
 
-    static JSPropertyNameEnumerator* create(VM&, Structure*, uint32_t, uint32_t, PropertyNameArray&&);
+    static JSPropertyNameEnumerator* create(VM&, Structure*, uint32_t, uint32_t, PropertyNameArray&&, JSPropertyNameEnumerator* previousEnumerator = nullptr);
 
     static Structure* createStructure(VM& vm, JSGlobalObject* globalObject, JSValue prototype)
     {
@@ -101,7 +101,7 @@ private:
     friend class LLIntOffsetsExtractor;
 
     JSPropertyNameEnumerator(VM&, Structure*, uint32_t, uint32_t, WriteBarrier<JSString>*, unsigned);
-    void finishCreation(VM&, RefPtr<PropertyNameArrayData>&&);
+    void finishCreation(VM&, RefPtr<PropertyNameArrayData>&&, JSPropertyNameEnumerator* previousEnumerator);
 
     // JSPropertyNameEnumerator is immutable data structure, which allows VM to cache the empty one.
     // After instantiating JSPropertyNameEnumerator, we must not change any fields.
@@ -154,8 +154,15 @@ inline JSPropertyNameEnumerator* propertyNameEnumerator(JSGlobalObject* globalOb
     JSPropertyNameEnumerator* enumerator = nullptr;
     if (!indexedLength && !propertyNames.size())
         enumerator = vm.emptyPropertyNameEnumerator();
-    else
-        enumerator = JSPropertyNameEnumerator::create(vm, structureAfterGettingPropertyNames, indexedLength, numberStructureProperties, WTFMove(propertyNames));
+    else {
+        // If this structure was reached by transition, the predecessor's cached enumerator
+        // holds name strings for a shared prefix of the property list; reuse those cells
+        // instead of allocating fresh ones for every name.
+        JSPropertyNameEnumerator* previousEnumerator = nullptr;
+        if (Structure* previous = structureAfterGettingPropertyNames->previousID())
+            previousEnumerator = previous->cachedPropertyNameEnumerator();
+        enumerator = JSPropertyNameEnumerator::create(vm, structureAfterGettingPropertyNames, indexedLength, numberStructureProperties, WTFMove(propertyNames), previousEnumerator);
+    }
     if (!indexedLength && successfullyNormalizedChain && structureAfterGettingPropertyNames == structure) {
         StructureChain* chain = structure->prototypeChain(vm, globalObject, base);
         if (structure->canCachePropertyNameEnumerator(vm))
@@ -86,7 +86,65 @@ void JSString::dumpToStream(const JSCell* cell, PrintStream& out)
 
 bool JSString::equalSlowCase(JSGlobalObject* globalObject, JSString* other) const
 {
-    return equalInline(globalObject, other);
+    UNUSED_PARAM(globalObject);
+
+    unsigned length = this->length();
+    if (length != other->length())
+        return false;
+    if (!length)
+        return true;
+
+    // Compare without resolving either rope: stream the leaf segments of both strings
+    // left-to-right and compare the overlapping runs. The segment comparisons funnel
+    // into WTF's character-equality primitives, which vectorize, so this costs no more
+    // per character than comparing two flat strings and never allocates. The work
+    // queues mirror resolveRopeSlowCase(): fibers are kept alive by their parent
+    // ropes, so plain pointers are safe here.
+    Vector<const JSString*, 32, UnsafeVectorOverflow> workQueue1;
+    Vector<const JSString*, 32, UnsafeVectorOverflow> workQueue2;
+    workQueue1.append(this);
+    workQueue2.append(other);
+
+    auto nextSegment = [](Vector<const JSString*, 32, UnsafeVectorOverflow>& workQueue) -> StringView {
+        while (!workQueue.isEmpty()) {
+            const JSString* currentFiber = workQueue.takeLast();
+            if (currentFiber->isRope()) {
+                const JSRopeString* currentFiberAsRope = static_cast<const JSRopeString*>(currentFiber);
+                if (currentFiberAsRope->isSubstring()) {
+                    ASSERT(!currentFiberAsRope->substringBase()->isRope());
+                    StringView view = *currentFiberAsRope->substringBase()->valueInternal().impl();
+                    StringView segment = view.substring(currentFiberAsRope->substringOffset(), currentFiberAsRope->length());
+                    if (segment.isEmpty())
+                        continue;
+                    return segment;
+                }
+                for (unsigned i = JSRopeString::s_maxInternalRopeLength; i--;) {
+                    if (JSString* fiber = currentFiberAsRope->fiber(i))
+                        workQueue.append(fiber);
+                }
+                continue;
+            }
+            StringView view = *currentFiber->valueInternal().impl();
+            if (!view.isEmpty())
+                return view;
+        }
+        return { };
+    };
+
+    StringView segment1 = nextSegment(workQueue1);
+    StringView segment2 = nextSegment(workQueue2);
+    unsigned remaining = length;
+    while (remaining) {
+        ASSERT(!segment1.isEmpty());
+        ASSERT(!segment2.isEmpty());
+        unsigned runLength = std::min(segment1.length(), segment2.length());
+        if (segment1.substring(0, runLength) != segment2.substring(0, runLength))
+            return false;
+        remaining -= runLength;
+        segment1 = runLength == segment1.length() ? nextSegment(workQueue1) : segment1.substring(runLength);
+        segment2 = runLength == segment2.length() ? nextSegment(workQueue2) : segment2.substring(runLength);
+    }
+    return true;
 }
 
 size_t JSString::estimatedSize(JSCell* cell, VM& vm)
@@ -46,21 +46,15 @@ bool JSString::equal(JSGlobalObject* globalObject, JSString* other) const
 
 ALWAYS_INLINE bool JSString::equalInline(JSGlobalObject* globalObject, JSString* other) const
 {
-    VM& vm = globalObject->vm();
-    auto scope = DECLARE_THROW_SCOPE(vm);
-
     unsigned length = this->length();
     if (length != other->length())
         return false;
 
-    auto str1 = unsafeView(globalObject);
-    RETURN_IF_EXCEPTION(scope, false);
-    auto str2 = other->unsafeView(globalObject);
-    RETURN_IF_EXCEPTION(scope, false);
-
-    ensureStillAliveHere(this);
-    ensureStillAliveHere(other);
-    return WTF::equal(str1, str2, length);
+    // Ropes are compared fiber-by-fiber without resolving, so this never allocates
+    // and never throws.
+    if (isRope() || other->isRope())
+        return equalSlowCase(globalObject, other);
+    return WTF::equal(*valueInternal().impl(), *other->valueInternal().impl());
 }
 
 template<typename StringType>
@@ -861,6 +861,30 @@ static ALWAYS_INLINE bool isSafeStringCharacter(UChar c, UChar terminator)
         return (c >= ' ' && isLatin1(c) && c != '\\' && c != terminator) || (c == '\t');
 }
 
+// Advances over a run of 8-bit characters that cannot end or complicate a strict JSON
+// string (no quote, no backslash, no control character), eight bytes at a time. Each
+// predicate is the word-parallel zero-byte test; none of them can miss an unsafe byte,
+// and a spurious hit merely ends the run early, so the per-character loop that follows
+// always resynchronizes correctly.
+static ALWAYS_INLINE const LChar* bulkScanSafeStringCharacters(const LChar* ptr, const LChar* end)
+{
+    constexpr uint64_t ones = 0x0101010101010101ULL;
+    constexpr uint64_t highs = 0x8080808080808080ULL;
+    while (end - ptr >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, ptr, sizeof(chunk));
+        uint64_t quotes = chunk ^ (ones * '"');
+        uint64_t backslashes = chunk ^ (ones * '\\');
+        uint64_t unsafe = (quotes - ones) & ~quotes;
+        unsafe |= (backslashes - ones) & ~backslashes;
+        unsafe |= (chunk - ones * 0x20) & ~chunk; // Control characters.
+        if (unsafe & highs)
+            break;
+        ptr += 8;
+    }
+    return ptr;
+}
+
 template <typename CharType>
 ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserToken<CharType>& token, CharType terminator)
 {
@@ -869,6 +893,8 @@ ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserT
 
     if (m_mode == StrictJSON) {
         ASSERT(terminator == '"');
+        if constexpr (sizeof(CharType) == 1)
+            m_ptr = bulkScanSafeStringCharacters(m_ptr, m_end);
         while (m_ptr < m_end && isSafeStringCharacter<SafeStringCharacterSet::Strict>(*m_ptr, '"'))
             ++m_ptr;
     } else {
@@ -894,6 +920,8 @@ TokenType LiteralParser<CharType>::Lexer::lexStringSlow(LiteralParserToken<CharT
     do {
         runStart = m_ptr;
         if (m_mode == StrictJSON) {
+            if constexpr (sizeof(CharType) == 1)
+                m_ptr = bulkScanSafeStringCharacters(m_ptr, m_end);
             while (m_ptr < m_end && isSafeStringCharacter<SafeStringCharacterSet::Strict>(*m_ptr, terminator))
                 ++m_ptr;
         } else {
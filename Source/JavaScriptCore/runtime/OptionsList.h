@@ -88,6 +88,8 @@ bool canUseWebAssemblyFastMemory();
     v(Bool, useBaselineJIT, true, Normal, "allows the baseline JIT to be used if true") \
     v(Bool, useDFGJIT, true, Normal, "allows the DFG JIT to be used if true") \
     v(Bool, useRegExpJIT, jitEnabledByDefault(), Normal, "allows the RegExp JIT to be used if true") \
+    v(Unsigned, matchCountForRegExpJIT, 5, Normal, "the number of matches a RegExp must perform before the RegExp JIT compiles it (0 = compile on first match)") \
+    v(Unsigned, fullGCCountForRegExpCodeDeletion, 3, Normal, "the number of full collections a RegExp can go unmatched before its compiled code is discarded (0 = never discard)") \
     v(Bool, useDOMJIT, is64Bit(), Normal, "allows the DOMJIT to be used if true") \
     \
     v(Bool, reportMustSucceedExecutableAllocations, false, Normal, nullptr) \
@@ -218,8 +220,10 @@ bool canUseWebAssemblyFastMemory();
     v(Double, sizeClassProgression, 1.4, Normal, nullptr) \
     v(Unsigned, preciseAllocationCutoff, 100000, Normal, nullptr) \
     v(Bool, dumpSizeClasses, false, Normal, nullptr) \
+    v(Bool, dumpHeapFragmentationAfterFullGC, false, Normal, nullptr) \
     v(Bool, useBumpAllocator, true, Normal, nullptr) \
     v(Bool, stealEmptyBlocksFromOtherAllocators, true, Normal, nullptr) \
+    v(Bool, useParallelPostMarkingSweep, false, Normal, "sweep non-destructible blocks on GC helper threads after marking; not yet safe to enable by default, see Heap::sweepNonDestructibleBlocksAfterMarking()") \
     v(Bool, eagerlyUpdateTopCallFrame, false, Normal, nullptr) \
     v(Bool, dumpZappedCellCrashData, false, Normal, nullptr) \
     \
@@ -344,6 +348,7 @@ bool canUseWebAssemblyFastMemory();
     v(Unsigned, slowPathAllocsBetweenGCs, 0, Normal, "force a GC on every Nth slow path alloc, where N is specified by this option") \
     \
     v(Double, percentCPUPerMBForFullTimer, 0.0003125, Normal, nullptr) \
+    v(Double, memoryPressureOptimizedCodeIdleSeconds, 10, Normal, "seconds a VM must be idle before memory pressure jettisons its DFG/FTL code") \
     v(Double, percentCPUPerMBForEdenTimer, 0.0025, Normal, nullptr) \
     v(Double, collectionTimerMaxPercentCPU, 0.05, Normal, nullptr) \
     \
@@ -424,12 +429,14 @@ bool canUseWebAssemblyFastMemory();
     v(Bool, usePredictionFileCreatingFuzzerAgent, false, Normal, nullptr) \
     v(Bool, requirePredictionForFileBasedFuzzerAgent, false, Normal, nullptr) \
     v(OptionString, fuzzerPredictionsFile, nullptr, Normal, "file with list of predictions for FileBasedFuzzerAgent") \
+    v(OptionString, tierUpProfileFile, nullptr, Normal, "file recording which functions tiered up into the optimizing JIT, used to lower their thresholds on later runs") \
     v(Bool, useNarrowingNumberPredictionFuzzerAgent, false, Normal, nullptr) \
     v(Bool, useWideningNumberPredictionFuzzerAgent, false, Normal, nullptr) \
     \
     v(Bool, logPhaseTimes, false, Normal, nullptr) \
     v(Double, rareBlockPenalty, 0.001, Normal, nullptr) \
     v(Unsigned, maximumTmpsForGraphColoring, 60000, Normal, "The maximum number of tmps an Air program can have before always register allocating with Linear Scan") \
+    v(Unsigned, maximumAirInstsForGraphColoring, 100000, Normal, "The maximum number of instructions an Air program can have before always register allocating with Linear Scan") \
     v(Bool, airLinearScanVerbose, false, Normal, nullptr) \
     v(Bool, airLinearScanSpillsEverything, false, Normal, nullptr) \
     v(Bool, airForceBriggsAllocator, false, Normal, nullptr) \
@@ -442,6 +449,7 @@ bool canUseWebAssemblyFastMemory();
     v(Unsigned, maxB3TailDupBlockSize, 3, Normal, nullptr) \
     v(Unsigned, maxB3TailDupBlockSuccessors, 3, Normal, nullptr) \
     v(Bool, useB3HoistLoopInvariantValues, false, Normal, nullptr) \
+    v(Bool, useB3LoopVectorization, false, Normal, "Rewrite simple stride-1 B3 loops into 128-bit vector loops with a scalar remainder (requires useWebAssemblySIMD)") \
     v(Bool, useB3CanonicalizePrePostIncrements, false, Normal, nullptr) \
     \
     v(Bool, useDollarVM, false, Restricted, "installs the $vm debugging tool in global objects") \
@@ -468,6 +476,8 @@ bool canUseWebAssemblyFastMemory();
     \
     v(Bool, useSourceProviderCache, true, Normal, "If false, the parser will not use the source provider cache. It's good to verify everything works when this is false. Because the cache is so successful, it can mask bugs.") \
     v(Bool, useCodeCache, true, Normal, "If false, the unlinked byte code cache will not be used.") \
+    v(Bool, useIdleTimeBytecodeGeneration, false, Normal, "Generate bytecode for eagerly-discovered function declarations of global code when the VM goes idle, so first calls hit the unlinked code block cache.") \
+    v(Unsigned, idleTimeBytecodeGenerationBudget, 512, Normal, "Maximum number of function declarations to generate bytecode for per idle-time generation pass.") \
     \
     v(Bool, useWebAssembly, true, Normal, "Expose the WebAssembly global object.") \
     \
@@ -494,6 +504,8 @@ bool canUseWebAssemblyFastMemory();
     v(Unsigned, maxNumWebAssemblyFastMemories, 4, Normal, nullptr) \
     v(Bool, wasmBBQUsesAir, true, Normal, nullptr) \
     v(Bool, useWasmLLInt, true, Normal, nullptr) \
+    v(Bool, useWasmModuleCache, true, Normal, "reuses validated Wasm modules for byte-identical sources within the process") \
+    v(Size, wasmModuleCacheByteBudget, 16 * MB, Normal, "total source bytes the validated Wasm module cache may retain") \
     v(Bool, useBBQJIT, true, Normal, "allows the BBQ JIT to be used if true") \
     v(Bool, useOMGJIT, true, Normal, "allows the OMG JIT to be used if true") \
     v(Bool, useWasmLLIntPrologueOSR, true, Normal, "allows prologue OSR from Wasm LLInt if true") \
@@ -246,6 +246,7 @@ void RegExp::compile(VM* vm, Yarr::CharSize charSize)
 
 #if ENABLE(YARR_JIT)
     if (!pattern.containsUnsignedLengthPattern() && Options::useRegExpJIT()
+        && m_matchCount >= Options::matchCountForRegExpJIT()
 #if !ENABLE(YARR_JIT_BACKREFERENCES)
         && !pattern.m_containsBackreferences
 #endif
@@ -310,6 +311,7 @@ void RegExp::compileMatchOnly(VM* vm, Yarr::CharSize charSize)
 
 #if ENABLE(YARR_JIT)
     if (!pattern.containsUnsignedLengthPattern() && Options::useRegExpJIT()
+        && m_matchCount >= Options::matchCountForRegExpJIT()
 #if !ENABLE(YARR_JIT_BACKREFERENCES)
         && !pattern.m_containsBackreferences
 #endif
@@ -190,6 +190,11 @@ private:
     };
 
     String m_patternString;
+    // How many times this RegExp has matched, and how many full collections have finished
+    // since it last matched. The former gates Yarr JIT compilation behind an interpreter
+    // warm-up tier; the latter lets RegExpCache discard code for idle RegExps.
+    unsigned m_matchCount { 0 };
+    unsigned m_fullGCsSinceLastMatch { 0 };
     RegExpState m_state { NotCompiled };
     OptionSet<Yarr::Flags> m_flags;
     Yarr::ErrorCode m_constructionErrorCode { Yarr::ErrorCode::NoError };
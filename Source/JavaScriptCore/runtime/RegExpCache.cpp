@@ -29,6 +29,7 @@
 #include "config.h"
 #include "RegExpCache.h"
 
+#include "Options.h"
 #include "StrongInlines.h"
 
 namespace JSC {
@@ -78,6 +79,26 @@ void RegExpCache::addToStrongCache(RegExp* regExp)
         m_nextEntryInStrongCache = 0;
 }
 
+void RegExpCache::deleteCodeForIdleRegExps()
+{
+    unsigned fullGCLimit = Options::fullGCCountForRegExpCodeDeletion();
+    if (!fullGCLimit)
+        return;
+
+    // Called at the end of each full collection. A RegExp that has sat through
+    // fullGCLimit full collections without matching gives up its compiled code;
+    // if it matches again it simply recompiles.
+    for (auto& entry : m_weakCache) {
+        RegExp* regExp = entry.value.get();
+        if (!regExp) // Skip zombies.
+            continue;
+        if (!regExp->hasCode())
+            continue;
+        if (regExp->m_fullGCsSinceLastMatch++ >= fullGCLimit)
+            regExp->deleteCode();
+    }
+}
+
 void RegExpCache::deleteAllCode()
 {
     for (int i = 0; i < maxStrongCacheableEntries; i++)
@@ -50,6 +50,7 @@ class RegExpCache final : private WeakHandleOwner {
 public:
     RegExpCache(VM* vm);
     void deleteAllCode();
+    void deleteCodeForIdleRegExps();
 
     RegExp* ensureEmptyRegExp(VM& vm)
     {
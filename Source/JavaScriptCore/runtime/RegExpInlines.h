@@ -106,7 +106,21 @@ ALWAYS_INLINE int RegExp::matchInline(JSGlobalObject* nullOrGlobalObject, VM& vm
     m_rtMatchTotalSubjectStringLen += (double)(s.length() - startOffset);
 #endif
 
-    compileIfNecessary(vm, s.is8Bit() ? Yarr::CharSize::Char8 : Yarr::CharSize::Char16);
+    Yarr::CharSize charSize = s.is8Bit() ? Yarr::CharSize::Char8 : Yarr::CharSize::Char16;
+
+    if (matchFrom == Yarr::MatchFrom::VMThread) {
+        m_matchCount++;
+        m_fullGCsSinceLastMatch = 0;
+    }
+
+    compileIfNecessary(vm, charSize);
+
+#if ENABLE(YARR_JIT)
+    // The first compile of a RegExp only produces bytecode; once the RegExp has matched
+    // enough times to be worth executable memory, recompile with the Yarr JIT allowed.
+    if (matchFrom == Yarr::MatchFrom::VMThread && m_state == ByteCode && m_matchCount == Options::matchCountForRegExpJIT())
+        compile(&vm, charSize);
+#endif
 
     auto throwError = [&] {
         if (matchFrom == Yarr::MatchFrom::CompilerThread)
@@ -246,7 +260,20 @@ ALWAYS_INLINE MatchResult RegExp::matchInline(JSGlobalObject* nullOrGlobalObject
     m_rtMatchOnlyTotalSubjectStringLen += (double)(s.length() - startOffset);
 #endif
 
-    compileIfNecessaryMatchOnly(vm, s.is8Bit() ? Yarr::CharSize::Char8 : Yarr::CharSize::Char16);
+    Yarr::CharSize charSize = s.is8Bit() ? Yarr::CharSize::Char8 : Yarr::CharSize::Char16;
+
+    if (matchFrom == Yarr::MatchFrom::VMThread) {
+        m_matchCount++;
+        m_fullGCsSinceLastMatch = 0;
+    }
+
+    compileIfNecessaryMatchOnly(vm, charSize);
+
+#if ENABLE(YARR_JIT)
+    // See matchInline above: recompile with the Yarr JIT allowed once warmed up.
+    if (matchFrom == Yarr::MatchFrom::VMThread && m_state == ByteCode && m_matchCount == Options::matchCountForRegExpJIT())
+        compileMatchOnly(&vm, charSize);
+#endif
 
     auto throwError = [&] {
         if (matchFrom == Yarr::MatchFrom::CompilerThread)
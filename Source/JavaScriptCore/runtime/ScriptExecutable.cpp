@@ -41,6 +41,7 @@
 #include "ModuleProgramCodeBlock.h"
 #include "ParserError.h"
 #include "ProgramCodeBlock.h"
+#include "StrongInlines.h"
 #include "VMInlines.h"
 
 namespace JSC {
@@ -367,6 +368,25 @@ static void setupJIT(VM& vm, CodeBlock* codeBlock)
 #endif
 }
 
+static void generateBytecodeForEagerFunctions(VM& vm, UnlinkedCodeBlock* unlinkedCodeBlock, const SourceCode& source, OptionSet<CodeGenerationMode> codeGenerationMode, unsigned& remainingBudget)
+{
+    for (size_t i = 0; i < unlinkedCodeBlock->numberOfFunctionDecls(); ++i) {
+        if (!remainingBudget)
+            return;
+        UnlinkedFunctionExecutable* declaration = unlinkedCodeBlock->functionDecl(i);
+        SourceCode declarationSource = declaration->linkedSourceCode(source);
+        ParserError error;
+        UnlinkedFunctionCodeBlock* declarationCodeBlock = declaration->unlinkedCodeBlockFor(
+            vm, declarationSource, CodeForCall, codeGenerationMode, error, declaration->parseMode());
+        if (!declarationCodeBlock) {
+            // If the function is ever called, the error will be regenerated and thrown properly.
+            continue;
+        }
+        remainingBudget--;
+        generateBytecodeForEagerFunctions(vm, declarationCodeBlock, declarationSource, codeGenerationMode, remainingBudget);
+    }
+}
+
 void ScriptExecutable::prepareForExecutionImpl(VM& vm, JSFunction* function, JSScope* scope, CodeSpecializationKind kind, CodeBlock*& resultCodeBlock)
 {
     auto throwScope = DECLARE_THROW_SCOPE(vm);
@@ -402,6 +422,20 @@ void ScriptExecutable::prepareForExecutionImpl(VM& vm, JSFunction* function, JSS
     }
 
     installCode(vm, codeBlock, codeBlock->codeType(), codeBlock->specializationKind());
+
+    // Bytecode generation allocates in the GC heap, so it cannot move to a worker
+    // thread. The next best thing for large bundles is to generate code for the
+    // function declarations we have already discovered once the VM goes idle, so
+    // that first calls hit the UnlinkedFunctionExecutable code block cache instead
+    // of stalling in the BytecodeGenerator.
+    if (UNLIKELY(Options::useIdleTimeBytecodeGeneration()) && (codeBlock->codeType() == GlobalCode || codeBlock->codeType() == ModuleCode)) {
+        JSGlobalObject* globalObject = scope->globalObject();
+        vm.whenIdle(
+            [&vm, codeGenerationMode = globalObject->defaultCodeGenerationMode(), source = source(), unlinkedCodeBlock = Strong<UnlinkedCodeBlock>(vm, codeBlock->unlinkedCodeBlock())] {
+                unsigned remainingBudget = Options::idleTimeBytecodeGenerationBudget();
+                generateBytecodeForEagerFunctions(vm, unlinkedCodeBlock.get(), source, codeGenerationMode, remainingBudget);
+            });
+    }
 }
 
 ScriptExecutable* ScriptExecutable::topLevelExecutable()
@@ -145,6 +145,16 @@ inline bool setsReadOnlyOnNonAccessorProperties(TransitionKind transition)
     }
 }
 
+// Memory-wise this is already a two-tier representation: a structure with one
+// successor (the common case on linear transition chains) stores a single weak
+// reference inline in m_data — no hash table exists until a second successor
+// appears — and on 64-bit targets the (property name, attributes, kind) key is
+// packed into one word rather than stored as a separate tuple. What each
+// structure on a chain still pays for is the WeakImpl backing the inline slot
+// and, at branch points, the WeakGCMap. Sharing chain storage across
+// structures would require the successor lookup to key on the predecessor as
+// well, turning every transition walk into a probe of a global table; that
+// trades the per-structure word for slower property addition everywhere.
 class StructureTransitionTable {
     static constexpr intptr_t UsingSingleSlotFlag = 1;
 
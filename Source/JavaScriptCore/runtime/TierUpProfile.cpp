@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "TierUpProfile.h"
+
+#include "SourceCode.h"
+#include <mutex>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/StringToIntegerConversion.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+// The profile is stored as a text file, one hot function per line in the
+// colon delimited format:
+// <source provider hash>:<start offset>
+// Both are unsigned decimal integers.
+
+static String readProfileFile(const char* filename)
+{
+    FILE* file = fopen(filename, "r");
+    if (!file) {
+        // First run: the profile does not exist yet; save() will create it.
+        return String();
+    }
+    RELEASE_ASSERT(fseek(file, 0, SEEK_END) != -1);
+    long bufferCapacity = ftell(file);
+    RELEASE_ASSERT(bufferCapacity != -1);
+    RELEASE_ASSERT(fseek(file, 0, SEEK_SET) != -1);
+    Vector<char> buffer;
+    buffer.resize(bufferCapacity);
+    size_t readSize = fread(buffer.data(), 1, buffer.size(), file);
+    fclose(file);
+    RELEASE_ASSERT(readSize == buffer.size());
+    return String(buffer.data(), buffer.size());
+}
+
+TierUpProfile::TierUpProfile()
+{
+    const char* filename = Options::tierUpProfileFile();
+    RELEASE_ASSERT_WITH_MESSAGE(filename, "profile file must be specified using --tierUpProfileFile=");
+
+    Locker locker { m_lock };
+    String contents = readProfileFile(filename);
+    for (const auto& line : contents.split('\n')) {
+        const Vector<String>& lineParts = line.split(':');
+        if (lineParts.size() != 2)
+            continue;
+        auto sourceHash = parseInteger<unsigned>(lineParts[0]);
+        auto startOffset = parseInteger<unsigned>(lineParts[1]);
+        if (!sourceHash || !startOffset)
+            continue;
+        m_hotFunctions.add((static_cast<uint64_t>(*sourceHash) << 32) | *startOffset);
+    }
+}
+
+uint64_t TierUpProfile::keyFor(const SourceCode& source)
+{
+    return (static_cast<uint64_t>(source.provider()->hash()) << 32) | static_cast<unsigned>(source.startOffset());
+}
+
+bool TierUpProfile::didOptimize(const SourceCode& source)
+{
+    Locker locker { m_lock };
+    return m_hotFunctions.contains(keyFor(source));
+}
+
+void TierUpProfile::recordDidOptimize(const SourceCode& source)
+{
+    Locker locker { m_lock };
+    if (m_hotFunctions.add(keyFor(source)).isNewEntry)
+        m_dirty = true;
+}
+
+void TierUpProfile::save()
+{
+    Locker locker { m_lock };
+    if (!m_dirty)
+        return;
+
+    FILE* file = fopen(Options::tierUpProfileFile(), "w");
+    if (!file)
+        return;
+    for (uint64_t key : m_hotFunctions)
+        fprintf(file, "%u:%u\n", static_cast<unsigned>(key >> 32), static_cast<unsigned>(key));
+    fclose(file);
+    m_dirty = false;
+}
+
+TierUpProfile& ensureGlobalTierUpProfile()
+{
+    static LazyNeverDestroyed<TierUpProfile> tierUpProfile;
+    static std::once_flag initializeTierUpProfileFlag;
+    std::call_once(initializeTierUpProfileFlag, [] {
+        tierUpProfile.construct();
+    });
+    return tierUpProfile;
+}
+
+} // namespace JSC
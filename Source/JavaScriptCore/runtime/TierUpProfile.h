@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "Options.h"
+#include <wtf/HashSet.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+
+namespace JSC {
+
+class SourceCode;
+
+// Remembers which functions tiered up into the optimizing JIT, keyed by the
+// source provider's content hash and the function's start offset, and persists
+// that set to the file named by Options::tierUpProfileFile(). A later run that
+// loads the same profile starts those functions with the lowered thresholds a
+// successful OSR entry would have earned them, so restarted workloads running
+// the same scripts reach steady state sooner. Because the key is a content
+// hash, entries for edited scripts simply stop matching.
+class TierUpProfile {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static bool isEnabled() { return !!Options::tierUpProfileFile(); }
+
+    bool didOptimize(const SourceCode&);
+    void recordDidOptimize(const SourceCode&);
+
+    // Rewrites the profile file if anything new was recorded. Last writer wins
+    // when multiple processes share a profile; entries are hints, so that is
+    // acceptable.
+    JS_EXPORT_PRIVATE void save();
+
+private:
+    friend class LazyNeverDestroyed<TierUpProfile>;
+    TierUpProfile();
+
+    static uint64_t keyFor(const SourceCode&);
+
+    Lock m_lock;
+    bool m_dirty WTF_GUARDED_BY_LOCK(m_lock) { false };
+    HashSet<uint64_t, IntHash<uint64_t>, WTF::UnsignedWithZeroKeyHashTraits<uint64_t>> m_hotFunctions WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+JS_EXPORT_PRIVATE TierUpProfile& ensureGlobalTierUpProfile();
+
+} // namespace JSC
@@ -102,8 +102,10 @@
 #include "StrongInlines.h"
 #include "StructureChain.h"
 #include "StructureInlines.h"
+#include "Subspace.h"
 #include "TestRunnerUtils.h"
 #include "ThunkGenerators.h"
+#include "TierUpProfile.h"
 #include "TypeProfiler.h"
 #include "TypeProfilerLog.h"
 #include "VMEntryScope.h"
@@ -422,6 +424,9 @@ VM::~VM()
         m_samplingProfiler->shutdown();
     }
 #endif // ENABLE(SAMPLING_PROFILER)
+
+    if (UNLIKELY(TierUpProfile::isEnabled()))
+        ensureGlobalTierUpProfile().save();
     
 #if ENABLE(JIT)
     if (JITWorklist* worklist = JITWorklist::existingGlobalWorklistOrNull())
@@ -778,6 +783,15 @@ void VM::whenIdle(Function<void()>&& callback)
     entryScope->addDidPopListener(WTFMove(callback));
 }
 
+void VM::forEachSubspaceLiveness(const Function<void(const char* name, size_t liveBytes, size_t allocatedBytes)>& func)
+{
+    heap.objectSpace().forEachSubspace(
+        [&] (Subspace& subspace) -> IterationStatus {
+            func(subspace.name(), subspace.liveBytesAtLastCollection(), subspace.totalAllocatedBytes());
+            return IterationStatus::Continue;
+        });
+}
+
 void VM::deleteAllLinkedCode(DeleteAllCodeEffort effort)
 {
     whenIdle([=, this] () {
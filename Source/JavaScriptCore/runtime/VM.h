@@ -759,6 +759,9 @@ public:
     Interpreter interpreter;
     unsigned disallowVMEntryCount { 0 };
     VMEntryScope* entryScope { nullptr };
+    // Stamped when the outermost VMEntryScope pops; lets memory-pressure responses
+    // distinguish VMs that merely paused between events from ones that went idle.
+    MonotonicTime lastEntryScopeEndTime { MonotonicTime::now() };
 
     JSObject* stringRecursionCheckFirstObject { nullptr };
     HashSet<JSObject*> stringRecursionCheckVisitedObjects;
@@ -812,6 +815,11 @@ public:
 
     JS_EXPORT_PRIVATE void whenIdle(Function<void()>&&);
 
+    // Walks the per-Subspace liveness telemetry (see Subspace.h): bytes live at the
+    // end of the last collection and cumulative bytes allocated. Cheap enough to
+    // sample periodically for heap composition monitoring.
+    JS_EXPORT_PRIVATE void forEachSubspaceLiveness(const Function<void(const char* name, size_t liveBytes, size_t allocatedBytes)>&);
+
     JS_EXPORT_PRIVATE void deleteAllCode(DeleteAllCodeEffort);
     JS_EXPORT_PRIVATE void deleteAllLinkedCode(DeleteAllCodeEffort);
 
@@ -99,6 +99,7 @@ VMEntryScope::~VMEntryScope()
         m_vm.watchdog()->exitedVM();
 
     m_vm.entryScope = nullptr;
+    m_vm.lastEntryScopeEndTime = MonotonicTime::now();
 
     for (auto& listener : m_didPopListeners)
         listener();
@@ -36,6 +36,7 @@
 #include "FrameTracers.h"
 #include "FunctionCodeBlock.h"
 #include "GetterSetter.h"
+#include "ICStats.h"
 #include "JITSizeStatistics.h"
 #include "JSArray.h"
 #include "JSCInlines.h"
@@ -2179,6 +2180,7 @@ static JSC_DECLARE_HOST_FUNCTION(functionDeltaBetweenButterflies);
 static JSC_DECLARE_HOST_FUNCTION(functionCurrentCPUTime);
 static JSC_DECLARE_HOST_FUNCTION(functionTotalGCTime);
 static JSC_DECLARE_HOST_FUNCTION(functionParseCount);
+static JSC_DECLARE_HOST_FUNCTION(functionICStats);
 static JSC_DECLARE_HOST_FUNCTION(functionIsWasmSupported);
 static JSC_DECLARE_HOST_FUNCTION(functionMake16BitStringIfPossible);
 static JSC_DECLARE_HOST_FUNCTION(functionGetStructureTransitionList);;
@@ -3633,6 +3635,37 @@ JSC_DEFINE_HOST_FUNCTION(functionParseCount, (JSGlobalObject*, CallFrame*))
     return JSValue::encode(jsNumber(globalParseCount.load()));
 }
 
+// Returns an array of { kind, className, propertyName, count } records aggregated from
+// the IC slow paths, hottest first. Run with --useICStats=1; otherwise the result is
+// empty.
+// Usage: $vm.icStats()
+JSC_DEFINE_HOST_FUNCTION(functionICStats, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSArray* result = constructEmptyArray(globalObject, nullptr);
+    RETURN_IF_EXCEPTION(scope, { });
+
+    ICStats* stats = ICStats::instanceIfExists();
+    if (!stats)
+        return JSValue::encode(result);
+
+    unsigned index = 0;
+    for (auto& entry : stats->snapshot()) {
+        const ICEvent& event = entry.first;
+        JSObject* object = constructEmptyObject(globalObject);
+        object->putDirect(vm, Identifier::fromString(vm, "kind"_s), jsString(vm, toString(event.kind())));
+        object->putDirect(vm, Identifier::fromString(vm, "className"_s), event.classInfo() ? jsString(vm, String::fromLatin1(event.classInfo()->className)) : jsNull());
+        object->putDirect(vm, Identifier::fromString(vm, "propertyName"_s), jsString(vm, event.propertyName().string()));
+        object->putDirect(vm, Identifier::fromString(vm, "count"_s), jsNumber(static_cast<double>(entry.second)));
+        result->putDirectIndex(globalObject, index++, object);
+        RETURN_IF_EXCEPTION(scope, { });
+    }
+    return JSValue::encode(result);
+}
+
 JSC_DEFINE_HOST_FUNCTION(functionIsWasmSupported, (JSGlobalObject*, CallFrame*))
 {
     DollarVMAssertScope assertScope;
@@ -4093,6 +4126,7 @@ void JSDollarVM::finishCreation(VM& vm)
     addFunction(vm, "totalGCTime"_s, functionTotalGCTime, 0);
 
     addFunction(vm, "parseCount"_s, functionParseCount, 0);
+    addFunction(vm, "icStats"_s, functionICStats, 0);
 
     addFunction(vm, "isWasmSupported"_s, functionIsWasmSupported, 0);
     addFunction(vm, "make16BitStringIfPossible"_s, functionMake16BitStringIfPossible, 1);
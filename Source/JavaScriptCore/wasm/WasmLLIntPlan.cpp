@@ -167,31 +167,43 @@ void LLIntPlan::didCompleteCompilation()
     if (m_compilerMode == CompilerMode::Validation)
         return;
 
-    for (uint32_t functionIndex = 0; functionIndex < m_moduleInformation->functions.size(); functionIndex++) {
-        if (m_exportedFunctionIndices.contains(functionIndex) || m_moduleInformation->referencedFunctions().contains(functionIndex)) {
-            TypeIndex typeIndex = m_moduleInformation->internalFunctionTypeIndices[functionIndex];
-            const TypeDefinition& signature = TypeInformation::get(typeIndex).expand();
-            CCallHelpers jit;
-            // The LLInt always bounds checks
-            MemoryMode mode = MemoryMode::BoundsChecking;
-            Ref<EmbedderEntrypointCallee> callee = EmbedderEntrypointCallee::create();
-            std::unique_ptr<InternalFunction> function = createJSToWasmWrapper(jit, callee.get(), signature, &m_unlinkedWasmToWasmCalls[functionIndex], m_moduleInformation.get(), mode, functionIndex);
-
-            LinkBuffer linkBuffer(jit, nullptr, LinkBuffer::Profile::Wasm, JITCompilationCanFail);
-            if (UNLIKELY(linkBuffer.didFailToAllocate())) {
-                Base::fail(makeString("Out of executable memory in function entrypoint at index ", String::number(functionIndex)));
-                return;
-            }
-
-            function->entrypoint.compilation = makeUnique<Compilation>(
-                FINALIZE_CODE(linkBuffer, JITCompilationPtrTag, "Embedder->WebAssembly entrypoint[%i] %s", functionIndex, signature.toString().ascii().data()),
-                nullptr);
-
-            callee->setEntrypoint(WTFMove(function->entrypoint));
-
-            auto result = m_embedderCallees.add(functionIndex, WTFMove(callee));
-            ASSERT_UNUSED(result, result.isNewEntry);
+    // Only exported and referenced functions need embedder entrypoints, so walk those
+    // sets directly; walking the whole function index space makes huge mostly-internal
+    // modules pay per function they never expose.
+    auto makeEmbedderCallee = [&](uint32_t functionIndex) -> bool {
+        if (m_embedderCallees.contains(functionIndex))
+            return true;
+        TypeIndex typeIndex = m_moduleInformation->internalFunctionTypeIndices[functionIndex];
+        const TypeDefinition& signature = TypeInformation::get(typeIndex).expand();
+        CCallHelpers jit;
+        // The LLInt always bounds checks
+        MemoryMode mode = MemoryMode::BoundsChecking;
+        Ref<EmbedderEntrypointCallee> callee = EmbedderEntrypointCallee::create();
+        std::unique_ptr<InternalFunction> function = createJSToWasmWrapper(jit, callee.get(), signature, &m_unlinkedWasmToWasmCalls[functionIndex], m_moduleInformation.get(), mode, functionIndex);
+
+        LinkBuffer linkBuffer(jit, nullptr, LinkBuffer::Profile::Wasm, JITCompilationCanFail);
+        if (UNLIKELY(linkBuffer.didFailToAllocate())) {
+            Base::fail(makeString("Out of executable memory in function entrypoint at index ", String::number(functionIndex)));
+            return false;
         }
+
+        function->entrypoint.compilation = makeUnique<Compilation>(
+            FINALIZE_CODE(linkBuffer, JITCompilationPtrTag, "Embedder->WebAssembly entrypoint[%i] %s", functionIndex, signature.toString().ascii().data()),
+            nullptr);
+
+        callee->setEntrypoint(WTFMove(function->entrypoint));
+
+        m_embedderCallees.add(functionIndex, WTFMove(callee));
+        return true;
+    };
+
+    for (uint32_t functionIndex : m_exportedFunctionIndices) {
+        if (!makeEmbedderCallee(functionIndex))
+            return;
+    }
+    for (uint32_t functionIndex : m_moduleInformation->referencedFunctions()) {
+        if (!makeEmbedderCallee(functionIndex))
+            return;
     }
 
     for (auto& unlinked : m_unlinkedWasmToWasmCalls) {
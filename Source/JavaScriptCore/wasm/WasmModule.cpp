@@ -31,9 +31,85 @@
 #include "WasmLLIntPlan.h"
 #include "WasmModuleInformation.h"
 #include "WasmWorklist.h"
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/SHA1.h>
+#include <wtf/text/WTFString.h>
 
 namespace JSC { namespace Wasm {
 
+// Validated modules are immutable and already built to be shared across VMs, so when
+// the embedder compiles byte-identical sources repeatedly (e.g. the same module on
+// every worker, or on every editor relaunch within a long-lived process) we can hand
+// back the cached Module — and with it the LLInt callees and entry thunks — instead of
+// re-running the whole validation pipeline.
+class ValidatedModuleCache {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static ValidatedModuleCache& singleton()
+    {
+        static NeverDestroyed<ValidatedModuleCache> cache;
+        return cache;
+    }
+
+    RefPtr<Module> get(const Vector<uint8_t>& source)
+    {
+        Locker locker { m_lock };
+        auto iterator = m_entries.find(digest(source));
+        if (iterator == m_entries.end())
+            return nullptr;
+        // The digest alone is not proof of identity.
+        if (iterator->value.source != source)
+            return nullptr;
+        iterator->value.lastUseTick = ++m_tick;
+        return iterator->value.module;
+    }
+
+    void add(Vector<uint8_t>&& source, Module& module)
+    {
+        size_t byteBudget = Options::wasmModuleCacheByteBudget();
+        if (source.size() > byteBudget / 4)
+            return;
+        Locker locker { m_lock };
+        auto result = m_entries.add(digest(source), Entry { });
+        if (!result.isNewEntry)
+            return;
+        m_cachedBytes += source.size();
+        result.iterator->value = Entry { WTFMove(source), &module, ++m_tick };
+
+        while (m_cachedBytes > byteBudget) {
+            auto leastRecentlyUsed = m_entries.begin();
+            for (auto iterator = m_entries.begin(); iterator != m_entries.end(); ++iterator) {
+                if (iterator->value.lastUseTick < leastRecentlyUsed->value.lastUseTick)
+                    leastRecentlyUsed = iterator;
+            }
+            m_cachedBytes -= leastRecentlyUsed->value.source.size();
+            m_entries.remove(leastRecentlyUsed);
+        }
+    }
+
+private:
+    static String digest(const Vector<uint8_t>& source)
+    {
+        SHA1 sha1;
+        sha1.addBytes(source.data(), source.size());
+        SHA1::Digest digest;
+        sha1.computeHash(digest);
+        return String::fromLatin1(SHA1::hexDigest(digest).data());
+    }
+
+    struct Entry {
+        Vector<uint8_t> source;
+        RefPtr<Module> module;
+        uint64_t lastUseTick { 0 };
+    };
+
+    Lock m_lock;
+    HashMap<String, Entry> m_entries WTF_GUARDED_BY_LOCK(m_lock);
+    size_t m_cachedBytes WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    uint64_t m_tick WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+};
+
 Module::Module(LLIntPlan& plan)
     : m_moduleInformation(plan.takeModuleInformation())
     , m_llintCallees(LLIntCallees::createFromVector(plan.takeCallees()))
@@ -66,14 +142,40 @@ static Plan::CompletionTask makeValidationCallback(Module::AsyncValidationCallba
 
 Module::ValidationResult Module::validateSync(VM& vm, Vector<uint8_t>&& source)
 {
-    Ref<LLIntPlan> plan = adoptRef(*new LLIntPlan(vm, WTFMove(source), CompilerMode::Validation, Plan::dontFinalize()));
+    if (Options::useWasmModuleCache()) {
+        if (RefPtr<Module> cached = ValidatedModuleCache::singleton().get(source))
+            return ValidationResult(WTFMove(cached));
+    }
+    // The plan gets a copy because ModuleInformation may reference the source bytes,
+    // while the cache needs them to confirm a digest match.
+    Ref<LLIntPlan> plan = adoptRef(*new LLIntPlan(vm, Vector<uint8_t>(source), CompilerMode::Validation, Plan::dontFinalize()));
     Wasm::ensureWorklist().enqueue(plan.get());
     plan->waitForCompletion();
-    return makeValidationResult(plan.get());
+    ValidationResult result = makeValidationResult(plan.get());
+    if (result && Options::useWasmModuleCache())
+        ValidatedModuleCache::singleton().add(WTFMove(source), *result.value());
+    return result;
 }
 
 void Module::validateAsync(VM& vm, Vector<uint8_t>&& source, Module::AsyncValidationCallback&& callback)
 {
+    if (Options::useWasmModuleCache()) {
+        if (RefPtr<Module> cached = ValidatedModuleCache::singleton().get(source)) {
+            // Running the callback here is fine: every caller defers its real work
+            // through the DeferredWorkTimer.
+            callback->run(ValidationResult(WTFMove(cached)));
+            return;
+        }
+        Ref<Plan> plan = adoptRef(*new LLIntPlan(vm, Vector<uint8_t>(source), CompilerMode::Validation, createSharedTask<Plan::CallbackType>([source = WTFMove(source), callback = WTFMove(callback)] (Plan& plan) mutable {
+            ASSERT(!plan.hasWork());
+            Module::ValidationResult result = makeValidationResult(static_cast<LLIntPlan&>(plan));
+            if (result)
+                ValidatedModuleCache::singleton().add(WTFMove(source), *result.value());
+            callback->run(WTFMove(result));
+        })));
+        Wasm::ensureWorklist().enqueue(WTFMove(plan));
+        return;
+    }
     Ref<Plan> plan = adoptRef(*new LLIntPlan(vm, WTFMove(source), CompilerMode::Validation, makeValidationCallback(WTFMove(callback))));
     Wasm::ensureWorklist().enqueue(WTFMove(plan));
 }
@@ -111,6 +213,78 @@ void Module::compileAsync(VM& vm, MemoryMode mode, CalleeGroup::AsyncCompilation
     calleeGroup->compileAsync(vm, WTFMove(task));
 }
 
+const Module::DataSegmentsImage* Module::dataSegmentsImage()
+{
+    Locker locker { m_lock };
+    if (m_dataSegmentsImageState == DataSegmentsImageState::Uncomputed) {
+        m_dataSegmentsImageState = DataSegmentsImageState::Ineligible;
+
+        const Vector<Segment::Ptr>& data = m_moduleInformation->data;
+        Vector<std::pair<uint64_t, uint64_t>, 16> ranges;
+        uint64_t minimumMemorySize = 0;
+        bool eligible = true;
+        for (const Segment::Ptr& segment : data) {
+            if (!segment->isActive())
+                continue;
+            // Offsets read from imported globals differ per instantiation.
+            if (segment->offsetIfActive->isGlobalImport()) {
+                eligible = false;
+                break;
+            }
+            uint64_t offset = static_cast<uint32_t>(segment->offsetIfActive->constValue());
+            // Zero-length segments write nothing but their offsets are still
+            // bounds-checked at instantiation; fold that requirement into the
+            // image's minimum memory size rather than dropping them.
+            if (!segment->sizeInBytes) {
+                minimumMemorySize = std::max(minimumMemorySize, offset);
+                continue;
+            }
+            ranges.append({ offset, offset + segment->sizeInBytes });
+        }
+
+        if (eligible && !ranges.isEmpty()) {
+            // The image must tile a contiguous range: a bulk copy writes every byte of
+            // the span, and per-segment copies would leave bytes between segments
+            // untouched, which is observable when memory is imported.
+            std::sort(ranges.begin(), ranges.end(), [](auto& a, auto& b) { return a.first < b.first; });
+            uint64_t coveredEnd = ranges.first().second;
+            for (size_t i = 1; i < ranges.size(); ++i) {
+                if (ranges[i].first > coveredEnd) {
+                    eligible = false;
+                    break;
+                }
+                coveredEnd = std::max(coveredEnd, ranges[i].second);
+            }
+
+            if (eligible) {
+                uint64_t startOffset = ranges.first().first;
+                m_dataSegmentsImage.startOffset = static_cast<uint32_t>(startOffset);
+                m_dataSegmentsImage.minimumMemorySize = std::max(minimumMemorySize, coveredEnd);
+                m_dataSegmentsImage.bytes.grow(coveredEnd - startOffset);
+                // Replay in segment order so overlapping segments resolve the same way
+                // the per-segment copies would.
+                for (const Segment::Ptr& segment : data) {
+                    if (!segment->isActive() || !segment->sizeInBytes)
+                        continue;
+                    uint64_t offset = static_cast<uint32_t>(segment->offsetIfActive->constValue());
+                    memcpy(m_dataSegmentsImage.bytes.data() + offset - startOffset, &segment->byte(0), segment->sizeInBytes);
+                }
+                m_dataSegmentsImageState = DataSegmentsImageState::Computed;
+            }
+        } else if (eligible) {
+            // No non-empty active constant segments: an empty image lets instantiation
+            // skip the segment walk, as long as memory is large enough for any empty
+            // segments' offsets.
+            m_dataSegmentsImage.minimumMemorySize = minimumMemorySize;
+            m_dataSegmentsImageState = DataSegmentsImageState::Computed;
+        }
+    }
+
+    if (m_dataSegmentsImageState != DataSegmentsImageState::Computed)
+        return nullptr;
+    return &m_dataSegmentsImage;
+}
+
 void Module::copyInitialCalleeGroupToAllMemoryModes(MemoryMode initialMode)
 {
     Locker locker { m_lock };
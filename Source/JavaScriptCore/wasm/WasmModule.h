@@ -71,14 +71,32 @@ public:
 
     void copyInitialCalleeGroupToAllMemoryModes(MemoryMode);
 
+    // Coalesced image of the active data segments, shared by every instantiation of
+    // this module so that the Nth worker initializes memory with one bulk copy instead
+    // of replaying each segment. Built lazily; null when the segments have offsets that
+    // depend on imported globals or do not tile a contiguous range.
+    struct DataSegmentsImage {
+        uint32_t startOffset { 0 };
+        // Memory must be at least this large for every active segment to validate.
+        // This can exceed startOffset + bytes.size(): zero-length segments contribute
+        // no bytes but their offsets are still bounds-checked at instantiation.
+        uint64_t minimumMemorySize { 0 };
+        Vector<uint8_t> bytes;
+    };
+    const DataSegmentsImage* dataSegmentsImage();
+
 private:
     Ref<CalleeGroup> getOrCreateCalleeGroup(VM&, MemoryMode);
 
+    enum class DataSegmentsImageState : uint8_t { Uncomputed, Ineligible, Computed };
+
     Module(LLIntPlan&);
     Ref<ModuleInformation> m_moduleInformation;
     RefPtr<CalleeGroup> m_calleeGroups[numberOfMemoryModes];
     Ref<LLIntCallees> m_llintCallees;
     MacroAssemblerCodeRef<JITCompilationPtrTag> m_llintEntryThunks;
+    DataSegmentsImage m_dataSegmentsImage;
+    DataSegmentsImageState m_dataSegmentsImageState { DataSegmentsImageState::Uncomputed };
     Lock m_lock;
 };
 
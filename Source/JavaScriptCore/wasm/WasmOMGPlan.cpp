@@ -60,6 +60,16 @@ OMGPlan::OMGPlan(VM& vm, Ref<Module>&& module, uint32_t functionIndex, std::opti
     dataLogLnIf(WasmOMGPlanInternal::verbose, "Starting OMG plan for ", functionIndex, " of module: ", RawPointer(&m_module.get()));
 }
 
+uint32_t OMGPlan::priorityScore() const
+{
+    // Every queued replacement crossed the same tier-up threshold, so per byte of body
+    // a small function represents a larger share of observed execution, and compiling
+    // it frees this thread for the next plan sooner. Rank by inverse body size so hot
+    // little kernels stop queueing behind cold giants.
+    size_t functionSize = m_moduleInformation->functions[m_functionIndex].data.size();
+    return std::numeric_limits<uint32_t>::max() - static_cast<uint32_t>(std::min<size_t>(functionSize, std::numeric_limits<uint32_t>::max()));
+}
+
 void OMGPlan::dumpDisassembly(CompilationContext& context, LinkBuffer& linkBuffer)
 {
     if (UNLIKELY(shouldDumpDisassemblyFor(CompilationMode::OMGMode))) {
@@ -44,6 +44,7 @@ public:
     bool hasWork() const final { return !m_completed; }
     void work(CompilationEffort) final;
     bool multiThreaded() const final { return false; }
+    uint32_t priorityScore() const final;
 
     // Note: CompletionTask should not hold a reference to the Plan otherwise there will be a reference cycle.
     OMGPlan(VM&, Ref<Module>&&, uint32_t functionIndex, std::optional<bool> hasExceptionHandlers, MemoryMode, CompletionTask&&);
@@ -46,6 +46,9 @@ public:
     bool hasWork() const final { return !m_completed; }
     void work(CompilationEffort) final;
     bool multiThreaded() const final { return false; }
+    // An OSR-entry request means execution is spinning in this function's loop right
+    // now, so it outranks every queued replacement compile.
+    uint32_t priorityScore() const final { return std::numeric_limits<uint32_t>::max(); }
 
     // Note: CompletionTask should not hold a reference to the Plan otherwise there will be a reference cycle.
     OSREntryPlan(VM&, Ref<Module>&&, Ref<Callee>&&, uint32_t functionIndex, std::optional<bool> hasExceptionHandlers, uint32_t loopIndex, MemoryMode, CompletionTask&&);
@@ -73,6 +73,10 @@ public:
     virtual void work(CompilationEffort = All) = 0;
     virtual bool multiThreaded() const = 0;
 
+    // Orders plans of equal Worklist priority; higher runs first. Tier-up plans use
+    // this to get hot functions compiled ahead of cold giants.
+    virtual uint32_t priorityScore() const { return 0; }
+
     void waitForCompletion();
     // Returns true if it cancelled the plan.
     bool tryRemoveContextAndCancelIfLast(VM&);
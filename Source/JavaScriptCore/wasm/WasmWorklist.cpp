@@ -159,7 +159,8 @@ void Worklist::enqueue(Ref<Plan> plan)
 
     dataLogLnIf(WasmWorklistInternal::verbose, "Enqueuing plan");
     bool multiThreaded = plan->multiThreaded();
-    m_queue.enqueue({ multiThreaded ? Priority::Compilation : Priority::Preparation, nextTicket(),  WTFMove(plan) });
+    uint32_t score = plan->priorityScore();
+    m_queue.enqueue({ multiThreaded ? Priority::Compilation : Priority::Preparation, score, nextTicket(),  WTFMove(plan) });
     if (multiThreaded)
         m_planEnqueued->notifyAll(locker);
     else
@@ -227,7 +228,7 @@ Worklist::~Worklist()
 {
     {
         Locker locker { *m_lock };
-        m_queue.enqueue({ Priority::Shutdown, nextTicket(), nullptr });
+        m_queue.enqueue({ Priority::Shutdown, 0, nextTicket(), nullptr });
         m_planEnqueued->notifyAll(locker);
     }
     for (unsigned i = 0; i < m_threads.size(); ++i)
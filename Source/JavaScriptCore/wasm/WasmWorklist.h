@@ -72,6 +72,9 @@ private:
 
     struct QueueElement {
         Priority priority;
+        // Orders plans within a Priority band; taken from Plan::priorityScore() at
+        // enqueue time so hot tier-ups jump ahead of cold ones.
+        uint32_t score;
         Ticket ticket;
         RefPtr<Plan> plan;
 
@@ -80,8 +83,11 @@ private:
 
     static bool isHigherPriority(const QueueElement& left, const QueueElement& right)
     {
-        if (left.priority == right.priority)
-            return left.ticket > right.ticket;
+        if (left.priority == right.priority) {
+            if (left.score == right.score)
+                return left.ticket > right.ticket;
+            return left.score > right.score;
+        }
         return left.priority > right.priority;
     }
 
@@ -783,24 +783,46 @@ JSValue WebAssemblyModuleRecord::evaluate(JSGlobalObject* globalObject)
     if (UNLIKELY(exception))
         return exception.value();
 
-    // Validation of all segment ranges comes before all Table and Memory initialization.
-    forEachActiveDataSegment([&](uint8_t* memory, uint64_t sizeInBytes, const Wasm::Segment::Ptr& segment, uint32_t offset) {
-        if (UNLIKELY(sizeInBytes < segment->sizeInBytes)) {
-            exception = dataSegmentFail(globalObject, vm, scope, sizeInBytes, segment->sizeInBytes, offset, ", segment is too big"_s);
-            return IterationStatus::Done;
-        }
-        if (UNLIKELY(offset > sizeInBytes - segment->sizeInBytes)) {
-            exception = dataSegmentFail(globalObject, vm, scope, sizeInBytes, segment->sizeInBytes, offset, ", segment writes outside of memory"_s);
-            return IterationStatus::Done;
+    // Repeated instantiations (e.g. one module across many workers) can initialize
+    // memory with a single copy of the module's coalesced segment image. Memory
+    // meeting the image's minimum size implies every active segment validates,
+    // including zero-length ones, so the per-segment walk below is only needed when
+    // the image is unavailable or the memory is too small (in which case it
+    // reproduces the precise error).
+    bool initializedDataSegments = false;
+    if (const auto* image = module.dataSegmentsImage()) {
+        auto wasmMemory = m_instance->instance().memory();
+        uint64_t sizeInBytes = wasmMemory->size();
+        if (image->minimumMemorySize <= sizeInBytes) {
+            if (image->bytes.size()) {
+                uint8_t* memory = reinterpret_cast<uint8_t*>(wasmMemory->basePointer());
+                RELEASE_ASSERT(memory);
+                memcpy(memory + image->startOffset, image->bytes.data(), image->bytes.size());
+            }
+            initializedDataSegments = true;
         }
+    }
 
-        // Empty segments are valid, but only if memory isn't present, which would be undefined behavior in memcpy.
-        if (segment->sizeInBytes) {
-            RELEASE_ASSERT(memory);
-            memcpy(memory + offset, &segment->byte(0), segment->sizeInBytes);
-        }
-        return IterationStatus::Continue;
-    });
+    // Validation of all segment ranges comes before all Table and Memory initialization.
+    if (!initializedDataSegments) {
+        forEachActiveDataSegment([&](uint8_t* memory, uint64_t sizeInBytes, const Wasm::Segment::Ptr& segment, uint32_t offset) {
+            if (UNLIKELY(sizeInBytes < segment->sizeInBytes)) {
+                exception = dataSegmentFail(globalObject, vm, scope, sizeInBytes, segment->sizeInBytes, offset, ", segment is too big"_s);
+                return IterationStatus::Done;
+            }
+            if (UNLIKELY(offset > sizeInBytes - segment->sizeInBytes)) {
+                exception = dataSegmentFail(globalObject, vm, scope, sizeInBytes, segment->sizeInBytes, offset, ", segment writes outside of memory"_s);
+                return IterationStatus::Done;
+            }
+
+            // Empty segments are valid, but only if memory isn't present, which would be undefined behavior in memcpy.
+            if (segment->sizeInBytes) {
+                RELEASE_ASSERT(memory);
+                memcpy(memory + offset, &segment->byte(0), segment->sizeInBytes);
+            }
+            return IterationStatus::Continue;
+        });
+    }
 
     if (UNLIKELY(exception))
         return exception.value();
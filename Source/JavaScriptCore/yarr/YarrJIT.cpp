@@ -30,6 +30,7 @@
 #include "CCallHelpers.h"
 #include "LinkBuffer.h"
 #include "Options.h"
+#include "SIMDInfo.h"
 #include "VM.h"
 #include "Yarr.h"
 #include "YarrCanonicalize.h"
@@ -2357,6 +2358,77 @@ class YarrGenerator final : public YarrJITInfo {
                             static_assert(BoyerMooreFastCandidates::maxSize == 2);
                             dataLogLnIf(Options::verboseRegExpCompilation(), "Found characters fastpath lookahead ", charactersFastPath, " range:[", beginIndex, ", ", endIndex, ")");
 
+#if CPU(ARM64)
+                            // A vector compare tests charsPerVector consecutive positions per load, while the
+                            // scalar loop below tests one position and then strides. When the vector covers more
+                            // ground per iteration, prescan with vectors and leave the last sub-vector-sized
+                            // chunk of the subject to the scalar loop. Testing positions the scalar stride would
+                            // have skipped is harmless: a hit just attempts a match that the matcher rejects.
+                            // This is memchr's strategy, emitted inline so a hit resumes at the right index.
+                            // We compare raw code units, so this stays off when decoding surrogate pairs, and
+                            // off for inlined tests since we cannot clobber the enclosing code's vector registers.
+                            unsigned stride = endIndex - beginIndex;
+                            unsigned charsPerVector = m_charSize == CharSize::Char8 ? 16 : 8;
+                            Checked<unsigned> negativeOffset = op.m_checkedOffset - endIndex + 1;
+                            if (m_compileMode != JITCompileMode::InlineTest
+                                && !m_decodeSurrogatePairs
+                                && stride < charsPerVector
+                                && negativeOffset.value() <= charsPerVector) {
+                                SIMDLane simdLane = m_charSize == CharSize::Char8 ? SIMDLane::i8x16 : SIMDLane::i16x8;
+                                SIMDInfo simdInfo { simdLane, SIMDSignMode::None };
+                                // q16 and up are caller-saved and distinct from the assembler's q31 scratch.
+                                constexpr MacroAssembler::FPRegisterID inputVector = ARM64Registers::q16;
+                                constexpr MacroAssembler::FPRegisterID candidateVector0 = ARM64Registers::q17;
+                                constexpr MacroAssembler::FPRegisterID candidateVector1 = ARM64Registers::q18;
+                                constexpr MacroAssembler::FPRegisterID matchVector = ARM64Registers::q19;
+                                constexpr MacroAssembler::FPRegisterID matchVector1 = ARM64Registers::q20;
+
+                                m_jit.move(MacroAssembler::TrustedImm32(charactersFastPath.at(0)), m_regs.regT0);
+                                m_jit.vectorSplat(simdLane, m_regs.regT0, candidateVector0);
+                                if (charactersFastPath.size() > 1) {
+                                    m_jit.move(MacroAssembler::TrustedImm32(charactersFastPath.at(1)), m_regs.regT0);
+                                    m_jit.vectorSplat(simdLane, m_regs.regT0, candidateVector1);
+                                }
+
+                                // index + inputAdvance <= length iff the whole vector read is in bounds. Since
+                                // negativeOffset <= charsPerVector, this also keeps index <= length, which the
+                                // scalar loop relies on when we hand the tail over to it.
+                                int32_t inputAdvance = charsPerVector - negativeOffset.value();
+                                auto vectorLoopHead = m_jit.label();
+                                m_jit.add32(MacroAssembler::TrustedImm32(inputAdvance), m_regs.index, m_regs.regT2);
+                                auto notEnoughForVector = m_jit.branch32(MacroAssembler::Above, m_regs.regT2, m_regs.length);
+
+                                m_jit.loadVector(negativeOffsetIndexedAddress(negativeOffset, m_regs.regT0), inputVector);
+                                m_jit.compareIntegerVector(MacroAssembler::Equal, simdInfo, inputVector, candidateVector0, matchVector);
+                                if (charactersFastPath.size() > 1) {
+                                    m_jit.compareIntegerVector(MacroAssembler::Equal, simdInfo, inputVector, candidateVector1, matchVector1);
+                                    m_jit.vectorOr(simdInfo, matchVector, matchVector1, matchVector);
+                                }
+                                m_jit.vectorExtractLane(SIMDLane::i64x2, SIMDSignMode::None, MacroAssembler::TrustedImm32(0), matchVector, m_regs.regT0);
+                                m_jit.vectorExtractLane(SIMDLane::i64x2, SIMDSignMode::None, MacroAssembler::TrustedImm32(1), matchVector, m_regs.regT1);
+                                m_jit.or64(m_regs.regT0, m_regs.regT1, m_regs.regT2);
+                                auto foundCandidate = m_jit.branchTest64(MacroAssembler::NonZero, m_regs.regT2);
+                                m_jit.add32(MacroAssembler::TrustedImm32(charsPerVector), m_regs.index);
+                                m_jit.jump().linkTo(vectorLoopHead, &m_jit);
+
+                                // A lane matched. Advance index so the candidate sits at the lookahead offset
+                                // the scalar loop (and the matcher) expects.
+                                foundCandidate.link(&m_jit);
+                                auto matchInLowHalf = m_jit.branchTest64(MacroAssembler::NonZero, m_regs.regT0);
+                                m_jit.countTrailingZeros64(m_regs.regT1, m_regs.regT0);
+                                m_jit.add32(MacroAssembler::TrustedImm32(64), m_regs.regT0);
+                                auto computedBitIndex = m_jit.jump();
+                                matchInLowHalf.link(&m_jit);
+                                m_jit.countTrailingZeros64(m_regs.regT0, m_regs.regT0);
+                                computedBitIndex.link(&m_jit);
+                                m_jit.urshift32(MacroAssembler::TrustedImm32(m_charSize == CharSize::Char8 ? 3 : 4), m_regs.regT0);
+                                m_jit.add32(m_regs.regT0, m_regs.index);
+                                matched.append(m_jit.jump());
+
+                                notEnoughForVector.link(&m_jit);
+                            }
+#endif
+
                             auto loopHead = m_jit.label();
                             readCharacter(op.m_checkedOffset - endIndex + 1, m_regs.regT0);
                             matched.append(m_jit.branch32(MacroAssembler::Equal, m_regs.regT0, MacroAssembler::TrustedImm32(charactersFastPath.at(0))));
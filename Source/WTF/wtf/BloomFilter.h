@@ -26,6 +26,9 @@
 #pragma once
 
 #include <array>
+#include <wtf/MathExtras.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Span.h>
 #include <wtf/text/AtomString.h>
 
 namespace WTF {
@@ -52,9 +55,17 @@ public:
     // but never false negatives (claim it doesn't contain a key it does).
     bool mayContain(unsigned hash) const;
     template <size_t hashSize> bool mayContain(const std::array<uint8_t, hashSize>&) const;
-    
+
     void clear();
 
+    // Raw table access so a filter can be persisted and restored.
+    Span<const unsigned> bitArray() const { return { m_bitArray.data(), m_bitArray.size() }; }
+    void setBitArray(Span<const unsigned> bits)
+    {
+        ASSERT(bits.size() == m_bitArray.size());
+        std::copy(bits.begin(), bits.end(), m_bitArray.begin());
+    }
+
     void add(const AtomString& string) { add(string.impl()->existingHash()); }
     void add(const String& string) { add(string.impl()->hash()); }
     bool mayContain(const AtomString& string) const { return mayContain(string.impl()->existingHash()); }
@@ -258,7 +269,125 @@ bool CountingBloomFilter<keyBits>::isClear() const
 }
 #endif // ASSERT_ENABLED
 
+// Counting bloom filter whose table size is chosen at runtime and laid out in cache line sized
+// blocks of 8 bit counters. Both buckets for a key fall in the same block, so a query touches a
+// single cache line no matter how large the table is. Error rates are as above with m == bucketCount().
+class CountingBlockedBloomFilter {
+    WTF_MAKE_FAST_ALLOCATED;
+    WTF_MAKE_NONCOPYABLE(CountingBlockedBloomFilter);
+public:
+    static constexpr size_t bucketsPerBlock = 64;
+    static unsigned maximumCount() { return std::numeric_limits<uint8_t>::max(); }
+
+    explicit CountingBlockedBloomFilter(unsigned blockCount);
+    ~CountingBlockedBloomFilter();
+
+    unsigned blockCount() const { return m_blockCount; }
+    size_t bucketCount() const { return m_blockCount * bucketsPerBlock; }
+
+    void add(unsigned hash);
+    void remove(unsigned hash);
+
+    // The filter may give false positives (claim it may contain a key it doesn't)
+    // but never false negatives (claim it doesn't contain a key it does).
+    bool mayContain(unsigned hash) const { return firstBucket(hash) && secondBucket(hash); }
+
+    // The filter must be cleared before reuse even if all keys are removed.
+    // Otherwise overflowed keys will stick around.
+    void clear();
+
+    // Reallocates the table with the new block count. The filter comes back clear.
+    void resetWithBlockCount(unsigned);
+
+#if ASSERT_ENABLED
+    // Slow.
+    bool likelyEmpty() const;
+    bool isClear() const;
+#endif
+
+private:
+    // Buckets within the block are picked from the low bits; the block is picked from the bits above them.
+    static constexpr unsigned blockShift = 12;
+
+    uint8_t* block(unsigned hash) const { return m_buckets + bucketsPerBlock * ((hash >> blockShift) & (m_blockCount - 1)); }
+    uint8_t& firstBucket(unsigned hash) { return block(hash)[hash & (bucketsPerBlock - 1)]; }
+    uint8_t& secondBucket(unsigned hash) { return block(hash)[(hash >> 6) & (bucketsPerBlock - 1)]; }
+    const uint8_t& firstBucket(unsigned hash) const { return block(hash)[hash & (bucketsPerBlock - 1)]; }
+    const uint8_t& secondBucket(unsigned hash) const { return block(hash)[(hash >> 6) & (bucketsPerBlock - 1)]; }
+
+    uint8_t* m_buckets { nullptr };
+    unsigned m_blockCount { 0 };
+};
+
+inline CountingBlockedBloomFilter::CountingBlockedBloomFilter(unsigned blockCount)
+{
+    resetWithBlockCount(blockCount);
+}
+
+inline CountingBlockedBloomFilter::~CountingBlockedBloomFilter()
+{
+    fastAlignedFree(m_buckets);
+}
+
+inline void CountingBlockedBloomFilter::resetWithBlockCount(unsigned blockCount)
+{
+    ASSERT(hasOneBitSet(blockCount));
+    fastAlignedFree(m_buckets);
+    m_blockCount = blockCount;
+    m_buckets = static_cast<uint8_t*>(fastAlignedMalloc(bucketsPerBlock, bucketCount()));
+    clear();
+}
+
+inline void CountingBlockedBloomFilter::add(unsigned hash)
+{
+    auto& first = firstBucket(hash);
+    auto& second = secondBucket(hash);
+    if (LIKELY(first < maximumCount()))
+        ++first;
+    if (LIKELY(second < maximumCount()))
+        ++second;
+}
+
+inline void CountingBlockedBloomFilter::remove(unsigned hash)
+{
+    auto& first = firstBucket(hash);
+    auto& second = secondBucket(hash);
+    ASSERT(first);
+    ASSERT(second);
+    // In case of an overflow, the bucket sticks in the table until clear().
+    if (LIKELY(first < maximumCount()))
+        --first;
+    if (LIKELY(second < maximumCount()))
+        --second;
+}
+
+inline void CountingBlockedBloomFilter::clear()
+{
+    memset(m_buckets, 0, bucketCount());
+}
+
+#if ASSERT_ENABLED
+inline bool CountingBlockedBloomFilter::likelyEmpty() const
+{
+    for (size_t i = 0; i < bucketCount(); ++i) {
+        if (m_buckets[i] && m_buckets[i] != maximumCount())
+            return false;
+    }
+    return true;
+}
+
+inline bool CountingBlockedBloomFilter::isClear() const
+{
+    for (size_t i = 0; i < bucketCount(); ++i) {
+        if (m_buckets[i])
+            return false;
+    }
+    return true;
+}
+#endif // ASSERT_ENABLED
+
 } // namespace WTF
 
 using WTF::BloomFilter;
 using WTF::CountingBloomFilter;
+using WTF::CountingBlockedBloomFilter;
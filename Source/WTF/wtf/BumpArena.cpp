@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/BumpArena.h>
+
+namespace WTF {
+
+Ref<BumpArena> BumpArena::create(size_t chunkCapacity)
+{
+    return adoptRef(*new BumpArena(chunkCapacity));
+}
+
+BumpArena::~BumpArena()
+{
+    ASSERT(currentSlot() != this);
+    for (Chunk* chunk = m_headChunk; chunk;) {
+        Chunk* next = chunk->next;
+        fastFree(chunk);
+        chunk = next;
+    }
+}
+
+void* BumpArena::allocateSlow(size_t alignedSize)
+{
+    // Allocations that would waste most of a fresh chunk get a chunk of their own, so the
+    // remainder of the current chunk stays usable for small allocations.
+    size_t chunkPayloadSize = std::max(alignedSize, m_chunkCapacity);
+    static_assert(!(sizeof(Chunk) % alignof(std::max_align_t)));
+    Chunk* chunk = static_cast<Chunk*>(fastMalloc(sizeof(Chunk) + chunkPayloadSize));
+    chunk->size = sizeof(Chunk) + chunkPayloadSize;
+    m_memoryUse += chunk->size;
+
+    char* payload = reinterpret_cast<char*>(chunk + 1);
+    if (alignedSize < chunkPayloadSize) {
+        // The new chunk becomes the bump target.
+        chunk->next = m_headChunk;
+        m_headChunk = chunk;
+        m_current = payload + alignedSize;
+        m_end = payload + chunkPayloadSize;
+        return payload;
+    }
+
+    // Oversized chunk; keep bump-allocating from the current one.
+    if (m_headChunk) {
+        chunk->next = m_headChunk->next;
+        m_headChunk->next = chunk;
+    } else {
+        chunk->next = nullptr;
+        m_headChunk = chunk;
+    }
+    return payload;
+}
+
+BumpArena*& BumpArena::currentSlot()
+{
+    static thread_local BumpArena* current { nullptr };
+    return current;
+}
+
+} // namespace WTF
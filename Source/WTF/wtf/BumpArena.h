@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <wtf/FastMalloc.h>
+#include <wtf/Forward.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Ref.h>
+#include <wtf/RefCounted.h>
+#include <wtf/StdLibExtras.h>
+
+namespace WTF {
+
+// A bump allocator whose memory is released wholesale when the arena is destroyed, for
+// phases that build many short-lived allocations, like style resolution or layout. While a
+// BumpArenaScope is active on a thread, containers using the ArenaMalloc policy carve their
+// storage out of the scope's arena; their individual frees are no-ops, and everything comes
+// back in one shot when the arena dies. The arena must therefore outlive every container
+// allocated within it.
+class BumpArena : public RefCounted<BumpArena> {
+    WTF_MAKE_NONCOPYABLE(BumpArena);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr size_t defaultChunkCapacity = 16 * KB;
+
+    WTF_EXPORT_PRIVATE static Ref<BumpArena> create(size_t chunkCapacity = defaultChunkCapacity);
+    WTF_EXPORT_PRIVATE ~BumpArena();
+
+    void* allocate(size_t);
+
+    static BumpArena* current() { return currentSlot(); }
+
+    size_t memoryUse() const { return m_memoryUse; }
+
+private:
+    explicit BumpArena(size_t chunkCapacity)
+        : m_chunkCapacity(chunkCapacity)
+    {
+    }
+
+    WTF_EXPORT_PRIVATE void* allocateSlow(size_t);
+    WTF_EXPORT_PRIVATE static BumpArena*& currentSlot();
+
+    struct Chunk {
+        Chunk* next;
+        size_t size;
+        // Payload follows.
+    };
+
+    Chunk* m_headChunk { nullptr };
+    char* m_current { nullptr };
+    char* m_end { nullptr };
+    size_t m_chunkCapacity;
+    size_t m_memoryUse { 0 };
+
+    friend class BumpArenaScope;
+};
+
+inline void* BumpArena::allocate(size_t size)
+{
+    size_t alignedSize = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    if (LIKELY(static_cast<size_t>(m_end - m_current) >= alignedSize)) {
+        char* result = m_current;
+        m_current += alignedSize;
+        return result;
+    }
+    return allocateSlow(alignedSize);
+}
+
+// Makes an arena the current one for this thread for the duration of a scope. Scopes nest;
+// the previous arena is restored on exit.
+class BumpArenaScope {
+    WTF_MAKE_NONCOPYABLE(BumpArenaScope);
+public:
+    explicit BumpArenaScope(BumpArena& arena)
+        : m_previous(BumpArena::currentSlot())
+    {
+        BumpArena::currentSlot() = &arena;
+    }
+
+    ~BumpArenaScope()
+    {
+        BumpArena::currentSlot() = m_previous;
+    }
+
+private:
+    BumpArena* m_previous;
+};
+
+// Malloc policy for Vector and friends that allocates from the current thread's BumpArena
+// scope, falling back to FastMalloc when no scope is active. Each allocation carries a
+// header recording its owner, so a container can safely outlive the scope it grew in (but
+// not the arena itself).
+struct ArenaMalloc {
+    static constexpr size_t headerSize = 2 * sizeof(size_t);
+
+    static void* malloc(size_t size)
+    {
+        void* result = tryMalloc(size);
+        if (!result)
+            CRASH();
+        return result;
+    }
+
+    static void* tryMalloc(size_t size)
+    {
+        size_t allocationSize = headerSize + size;
+        if (allocationSize < size)
+            return nullptr;
+        size_t* header;
+        if (BumpArena* arena = BumpArena::current()) {
+            header = static_cast<size_t*>(arena->allocate(allocationSize));
+            header[0] = reinterpret_cast<size_t>(arena);
+        } else {
+            auto result = tryFastMalloc(allocationSize);
+            void* pointer;
+            if (!result.getValue(pointer))
+                return nullptr;
+            header = static_cast<size_t*>(pointer);
+            header[0] = 0;
+        }
+        header[1] = size;
+        return header + 2;
+    }
+
+    static void* zeroedMalloc(size_t size)
+    {
+        void* result = malloc(size);
+        memset(result, 0, size);
+        return result;
+    }
+
+    static void* tryZeroedMalloc(size_t size)
+    {
+        void* result = tryMalloc(size);
+        if (result)
+            memset(result, 0, size);
+        return result;
+    }
+
+    static void* realloc(void* pointer, size_t size)
+    {
+        void* result = tryRealloc(pointer, size);
+        if (!result)
+            CRASH();
+        return result;
+    }
+
+    static bool tryReallocInPlace(void* pointer, size_t size)
+    {
+        if (!pointer)
+            return false;
+        return size <= static_cast<size_t*>(pointer)[-1];
+    }
+
+    static void* tryRealloc(void* pointer, size_t size)
+    {
+        if (!pointer)
+            return tryMalloc(size);
+        size_t oldSize = static_cast<size_t*>(pointer)[-1];
+        if (size <= oldSize)
+            return pointer;
+        void* result = tryMalloc(size);
+        if (!result)
+            return nullptr;
+        memcpy(result, pointer, oldSize);
+        free(pointer);
+        return result;
+    }
+
+    static void free(void* pointer)
+    {
+        if (!pointer)
+            return;
+        size_t* header = static_cast<size_t*>(pointer) - 2;
+        // Arena-owned memory is reclaimed when the arena is destroyed.
+        if (!header[0])
+            fastFree(header);
+    }
+};
+
+// Vector that draws its storage from the current BumpArenaScope, if any.
+template<typename T, size_t inlineCapacity = 0>
+using ArenaVector = Vector<T, inlineCapacity, CrashOnOverflow, 16, ArenaMalloc>;
+
+} // namespace WTF
+
+using WTF::ArenaMalloc;
+using WTF::ArenaVector;
+using WTF::BumpArena;
+using WTF::BumpArenaScope;
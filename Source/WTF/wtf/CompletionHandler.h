@@ -75,6 +75,27 @@ public:
         return std::exchange(m_function, nullptr)(std::forward<In>(in)...);
     }
 
+    // Consumes this handler and returns one that calls it and then the continuation with its
+    // result (or with no argument when Out is void). Both callables share a single wrapper, so
+    // chaining doesn't stack an allocation per continuation.
+    template<typename ChainedCallable>
+    auto then(ChainedCallable&& chained) &&
+    {
+        ASSERT_WITH_MESSAGE(m_function, "Cannot chain onto a completion handler that was already called");
+        if constexpr (std::is_void_v<Out>) {
+            using ChainedOut = std::invoke_result_t<ChainedCallable>;
+            return CompletionHandler<ChainedOut(In...)>([function = std::exchange(m_function, nullptr), chained = std::forward<ChainedCallable>(chained)](In... in) mutable {
+                function(std::forward<In>(in)...);
+                return chained();
+            }, m_callThread);
+        } else {
+            using ChainedOut = std::invoke_result_t<ChainedCallable, Out>;
+            return CompletionHandler<ChainedOut(In...)>([function = std::exchange(m_function, nullptr), chained = std::forward<ChainedCallable>(chained)](In... in) mutable {
+                return chained(function(std::forward<In>(in)...));
+            }, m_callThread);
+        }
+    }
+
 private:
     Function<Out(In...)> m_function;
     NO_UNIQUE_ADDRESS ThreadLikeAssertion m_callThread;
@@ -136,6 +157,8 @@ public:
         RELEASE_ASSERT(m_completionHandler);
     }
     Out call(In... in) final { return m_completionHandler(std::forward<In>(in)...); }
+    CallableWrapperBase<Out, In...>* moveTo(void* storage) final { return new (NotNull, storage) CallableWrapper(WTFMove(m_completionHandler)); }
+    CallableWrapperBase<Out, In...>* moveToHeap() final { return new CallableWrapper(WTFMove(m_completionHandler)); }
 private:
     CompletionHandler<Out(In...)> m_completionHandler;
 };
@@ -70,6 +70,8 @@ private:
         static void* realloc(void* p, size_t size) { return debugHeap().realloc(p, size); } \
 \
         static void* tryRealloc(void* p, size_t size) { return debugHeap().realloc(p, size); } \
+\
+        static bool tryReallocInPlace(void*, size_t) { return false; } \
 \
         static void free(void* p) { debugHeap().free(p); } \
     }
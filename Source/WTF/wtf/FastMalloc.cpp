@@ -157,7 +157,7 @@ TryMallocReturnValue tryFastZeroedMalloc(size_t n)
 
 #include <wtf/OSAllocator.h>
 
-#if OS(WINDOWS)
+#if OS(WINDOWS) || OS(LINUX)
 #include <malloc.h>
 #endif
 
@@ -284,6 +284,22 @@ TryMallocReturnValue tryFastRealloc(void* p, size_t n)
     return realloc(p, n);
 }
 
+bool tryFastReallocInPlace(void* p, size_t newSize)
+{
+    if (!p)
+        return false;
+#if OS(DARWIN)
+    return malloc_size(p) >= newSize;
+#elif OS(WINDOWS)
+    return _msize(p) >= newSize;
+#elif OS(LINUX)
+    return malloc_usable_size(p) >= newSize;
+#else
+    UNUSED_PARAM(newSize);
+    return false;
+#endif
+}
+
 void releaseFastMallocFreeMemory() { }
 void releaseFastMallocFreeMemoryForThisThread() { }
 
@@ -645,6 +661,19 @@ TryMallocReturnValue tryFastRealloc(void* object, size_t newSize)
     return bmalloc::api::tryRealloc(object, newSize);
 }
 
+bool tryFastReallocInPlace(void* object, size_t newSize)
+{
+    if (!object)
+        return false;
+#if BENABLE(MALLOC_SIZE)
+    // No metadata update is needed: the allocation already owns its full size class.
+    return bmalloc::api::mallocSize(object) >= newSize;
+#else
+    UNUSED_PARAM(newSize);
+    return false;
+#endif
+}
+
 void releaseFastMallocFreeMemoryForThisThread()
 {
     bmalloc::api::scavengeThisThread();
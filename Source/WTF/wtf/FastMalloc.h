@@ -100,6 +100,11 @@ WTF_EXPORT_PRIVATE TryMallocReturnValue tryFastZeroedMalloc(size_t);
 WTF_EXPORT_PRIVATE TryMallocReturnValue tryFastCalloc(size_t numElements, size_t elementSize);
 WTF_EXPORT_PRIVATE TryMallocReturnValue tryFastRealloc(void*, size_t);
 
+// Attempts to grow the allocation to newSize without moving it, which succeeds when the
+// allocation's underlying size class already covers newSize. Returns false (leaving the
+// allocation untouched) when the allocator cannot tell or cannot grow in place.
+WTF_EXPORT_PRIVATE bool tryFastReallocInPlace(void*, size_t newSize);
+
 WTF_EXPORT_PRIVATE void fastFree(void*);
 
 // Allocations from fastAlignedMalloc() must be freed using fastAlignedFree().
@@ -248,7 +253,9 @@ struct FastMalloc {
             return realResult;
         return nullptr;
     }
-    
+
+    static bool tryReallocInPlace(void* p, size_t size) { return tryFastReallocInPlace(p, size); }
+
     static void free(void* p) { fastFree(p); }
 };
 
@@ -296,6 +303,7 @@ using WTF::fastZeroedMalloc;
 using WTF::tryFastAlignedMalloc;
 using WTF::tryFastCalloc;
 using WTF::tryFastMalloc;
+using WTF::tryFastReallocInPlace;
 using WTF::tryFastZeroedMalloc;
 using WTF::fastAlignedMalloc;
 using WTF::fastAlignedFree;
@@ -46,6 +46,16 @@
 #include <gio/gio.h>
 #endif
 
+#if OS(DARWIN)
+#include <sys/clonefile.h>
+#endif
+
+#if OS(LINUX)
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#endif
+
 #if HAVE(STD_FILESYSTEM) || HAVE(STD_EXPERIMENTAL_FILESYSTEM)
 #include <wtf/StdFilesystem.h>
 #endif
@@ -746,6 +756,39 @@ bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
     return !ec;
 }
 
+bool cloneFile(const String& sourcePath, const String& destinationPath)
+{
+#if OS(DARWIN)
+    auto fsSourcePath = toStdFileSystemPath(sourcePath);
+    auto fsDestinationPath = toStdFileSystemPath(destinationPath);
+    return !clonefile(fsSourcePath.c_str(), fsDestinationPath.c_str(), 0);
+#elif OS(LINUX) && defined(FICLONE)
+    auto fsSourcePath = toStdFileSystemPath(sourcePath);
+    auto fsDestinationPath = toStdFileSystemPath(destinationPath);
+    int sourceFD = open(fsSourcePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (sourceFD == -1)
+        return false;
+    auto closeSource = makeScopeExit([&] {
+        close(sourceFD);
+    });
+    int destinationFD = open(fsDestinationPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (destinationFD == -1)
+        return false;
+    auto closeDestination = makeScopeExit([&] {
+        close(destinationFD);
+    });
+    if (ioctl(destinationFD, FICLONE, sourceFD) == -1) {
+        unlink(fsDestinationPath.c_str());
+        return false;
+    }
+    return true;
+#else
+    UNUSED_PARAM(sourcePath);
+    UNUSED_PARAM(destinationPath);
+    return false;
+#endif
+}
+
 std::optional<uint64_t> hardLinkCount(const String& path)
 {
     std::error_code ec;
@@ -186,6 +186,9 @@ WTF_EXPORT_PRIVATE bool hardLink(const String& targetPath, const String& linkPat
 // Hard links a file if possible, copies it if not.
 WTF_EXPORT_PRIVATE bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath);
 WTF_EXPORT_PRIVATE std::optional<uint64_t> hardLinkCount(const String& path);
+// Clones a file using filesystem copy-on-write support (clonefile on Darwin, FICLONE on Linux).
+// Returns false when the filesystem cannot clone; the destination is not created in that case.
+WTF_EXPORT_PRIVATE bool cloneFile(const String& sourcePath, const String& destinationPath);
 
 #if USE(FILE_LOCK)
 WTF_EXPORT_PRIVATE bool lockFile(PlatformFileHandle, OptionSet<FileLockMode>);
@@ -25,9 +25,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <wtf/FastMalloc.h>
 #include <wtf/Forward.h>
+#include <wtf/StdLibExtras.h>
 
 namespace WTF {
 
@@ -39,6 +41,10 @@ class CallableWrapperBase {
 public:
     virtual ~CallableWrapperBase() { }
     virtual Out call(In...) = 0;
+    // Support for callables stored in Function's inline storage. Both move the wrapped
+    // callable out of this wrapper; the caller still destroys the moved-from wrapper.
+    virtual CallableWrapperBase* moveTo(void* storage) = 0;
+    virtual CallableWrapperBase* moveToHeap() = 0;
 };
 
 template<typename, typename, typename...> class CallableWrapper;
@@ -51,6 +57,8 @@ public:
     CallableWrapper(const CallableWrapper&) = delete;
     CallableWrapper& operator=(const CallableWrapper&) = delete;
     Out call(In... in) final { return m_callable(std::forward<In>(in)...); }
+    CallableWrapperBase<Out, In...>* moveTo(void* storage) final { return new (NotNull, storage) CallableWrapper(WTFMove(m_callable)); }
+    CallableWrapperBase<Out, In...>* moveToHeap() final { return new CallableWrapper(WTFMove(m_callable)); }
 private:
     CallableType m_callable;
 };
@@ -65,16 +73,45 @@ class Function<Out(In...)> {
 public:
     using Impl = Detail::CallableWrapperBase<Out, In...>;
 
+    // Callables whose wrapper fits in this many bytes are stored inline instead of on the heap.
+    static constexpr size_t inlineCallableStorageSize = 32;
+
     Function() = default;
     Function(std::nullptr_t) { }
 
     template<typename CallableType, class = typename std::enable_if<!(std::is_pointer<CallableType>::value && std::is_function<typename std::remove_pointer<CallableType>::type>::value) && std::is_rvalue_reference<CallableType&&>::value>::type>
     Function(CallableType&& callable)
-        : m_callableWrapper(makeUnique<Detail::CallableWrapper<CallableType, Out, In...>>(std::forward<CallableType>(callable))) { }
+    {
+        initialize(std::forward<CallableType>(callable));
+    }
 
     template<typename FunctionType, class = typename std::enable_if<std::is_pointer<FunctionType>::value && std::is_function<typename std::remove_pointer<FunctionType>::type>::value>::type>
     Function(FunctionType f)
-        : m_callableWrapper(makeUnique<Detail::CallableWrapper<FunctionType, Out, In...>>(std::forward<FunctionType>(f))) { }
+    {
+        initialize(std::forward<FunctionType>(f));
+    }
+
+    Function(Function&& other) noexcept
+    {
+        moveFrom(WTFMove(other));
+    }
+
+    Function& operator=(Function&& other) noexcept
+    {
+        if (this != &other) {
+            // Destroy the old callable only after the new one is installed, and from storage this
+            // Function no longer owns: its destructor may re-enter assignment on this Function,
+            // and that assignment must both be safe and win.
+            Function oldFunction = WTFMove(*this);
+            moveFrom(WTFMove(other));
+        }
+        return *this;
+    }
+
+    ~Function()
+    {
+        clear();
+    }
 
     Out operator()(In... in) const
     {
@@ -87,26 +124,38 @@ public:
     template<typename CallableType, class = typename std::enable_if<!(std::is_pointer<CallableType>::value && std::is_function<typename std::remove_pointer<CallableType>::type>::value) && std::is_rvalue_reference<CallableType&&>::value>::type>
     Function& operator=(CallableType&& callable)
     {
-        m_callableWrapper = makeUnique<Detail::CallableWrapper<CallableType, Out, In...>>(std::forward<CallableType>(callable));
+        // See the move assignment operator for why the old callable is moved aside first.
+        Function oldFunction = WTFMove(*this);
+        initialize(std::forward<CallableType>(callable));
         return *this;
     }
 
     template<typename FunctionType, class = typename std::enable_if<std::is_pointer<FunctionType>::value && std::is_function<typename std::remove_pointer<FunctionType>::type>::value>::type>
     Function& operator=(FunctionType f)
     {
-        m_callableWrapper = makeUnique<Detail::CallableWrapper<FunctionType, Out, In...>>(std::forward<FunctionType>(f));
+        Function oldFunction = WTFMove(*this);
+        initialize(std::forward<FunctionType>(f));
         return *this;
     }
 
     Function& operator=(std::nullptr_t)
     {
-        m_callableWrapper = nullptr;
+        Function oldFunction = WTFMove(*this);
         return *this;
     }
 
+    // Always returns a heap-allocated wrapper; an inline callable is moved to the heap first.
     Impl* leak()
     {
-        return m_callableWrapper.release();
+        if (!m_callableWrapper)
+            return nullptr;
+        Impl* impl = m_callableWrapper;
+        if (isInline()) {
+            impl = m_callableWrapper->moveToHeap();
+            m_callableWrapper->~Impl();
+        }
+        m_callableWrapper = nullptr;
+        return impl;
     }
 
 private:
@@ -118,7 +167,46 @@ private:
 
     friend Function adopt<Out, In...>(Impl*);
 
-    std::unique_ptr<Impl> m_callableWrapper;
+    bool isInline() const { return static_cast<const void*>(m_callableWrapper) == static_cast<const void*>(&m_inlineCallableStorage); }
+
+    template<typename CallableType>
+    void initialize(CallableType&& callable)
+    {
+        using Wrapper = Detail::CallableWrapper<CallableType, Out, In...>;
+        // Inline storage requires a nothrow move so moving a Function can never throw.
+        if constexpr (sizeof(Wrapper) <= inlineCallableStorageSize && alignof(Wrapper) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible<CallableType>::value)
+            m_callableWrapper = new (NotNull, &m_inlineCallableStorage) Wrapper(std::forward<CallableType>(callable));
+        else
+            m_callableWrapper = new Wrapper(std::forward<CallableType>(callable));
+    }
+
+    void moveFrom(Function&& other) noexcept
+    {
+        ASSERT(!m_callableWrapper);
+        if (!other.m_callableWrapper)
+            return;
+        if (other.isInline()) {
+            m_callableWrapper = other.m_callableWrapper->moveTo(&m_inlineCallableStorage);
+            other.m_callableWrapper->~Impl();
+        } else
+            m_callableWrapper = other.m_callableWrapper;
+        other.m_callableWrapper = nullptr;
+    }
+
+    void clear()
+    {
+        if (!m_callableWrapper)
+            return;
+        bool wasInline = isInline();
+        Impl* wrapper = std::exchange(m_callableWrapper, nullptr);
+        if (wasInline)
+            wrapper->~Impl();
+        else
+            delete wrapper;
+    }
+
+    Impl* m_callableWrapper { nullptr };
+    alignas(std::max_align_t) unsigned char m_inlineCallableStorage[inlineCallableStorageSize];
 };
 
 template<typename Out, typename... In> Function<Out(In...)> adopt(Detail::CallableWrapperBase<Out, In...>* impl)
@@ -137,6 +137,10 @@ public:
     // Same as get(), but aggressively inlined.
     MappedPeekType inlineGet(const KeyType&) const;
 
+    // Batched get() that overlaps the cache misses of independent lookups. The functor is
+    // called once per key, in order, with that key's MappedPeekType.
+    template<typename Functor> void getMany(Span<const KeyType>, const Functor&) const;
+
     ALWAYS_INLINE bool isNullStorage() const { return m_impl.isNullStorage(); }
 
     // Replaces the value but not the key if the key is already present.
@@ -479,6 +483,18 @@ ALWAYS_INLINE auto HashMap<T, U, V, W, MappedTraits, Y>::inlineGet(const KeyType
     return MappedTraits::peek(entry->value);
 }
 
+template<typename T, typename U, typename V, typename W, typename MappedTraits, typename Y>
+template<typename Functor>
+inline void HashMap<T, U, V, W, MappedTraits, Y>::getMany(Span<const KeyType> keys, const Functor& functor) const
+{
+    const_cast<HashTableType&>(m_impl).template lookupMany<IdentityTranslatorType>(keys, [&](KeyValuePairType* entry) {
+        if (!entry)
+            functor(MappedTraits::peek(MappedTraits::emptyValue()));
+        else
+            functor(MappedTraits::peek(entry->value));
+    });
+}
+
 template<typename T, typename U, typename V, typename W, typename X, typename Y>
 inline bool HashMap<T, U, V, W, X, Y>::remove(iterator it)
 {
@@ -624,6 +640,12 @@ inline bool operator!=(const HashMap<T, U, V, W, X, Y>& a, const HashMap<T, U, V
     return !(a == b);
 }
 
+// HashMap that keeps up to inlineCapacity entries in inline storage, so maps that stay small
+// never allocate. See InlineHashTableTraits for the move/swap trade-offs.
+template<typename KeyArg, typename MappedArg, unsigned inlineCapacity, typename HashArg = DefaultHash<KeyArg>, typename KeyTraitsArg = HashTraits<KeyArg>, typename MappedTraitsArg = HashTraits<MappedArg>>
+using InlineHashMap = HashMap<KeyArg, MappedArg, HashArg, KeyTraitsArg, MappedTraitsArg, InlineHashTableTraits<inlineCapacity>>;
+
 } // namespace WTF
 
 using WTF::HashMap;
+using WTF::InlineHashMap;
@@ -78,6 +78,10 @@ public:
     iterator find(const ValueType&) const;
     bool contains(const ValueType&) const;
 
+    // Batched contains() that overlaps the cache misses of independent lookups. The functor
+    // is called once per value, in order, with a bool saying whether that value is present.
+    template<typename Functor> void containsMany(Span<const ValueType>, const Functor&) const;
+
     // An alternate version of find() that finds the object by hashing and comparing
     // with some other type, to avoid the cost of type conversion. HashTranslator
     // must have the following function members:
@@ -278,6 +282,15 @@ inline bool HashSet<T, U, V, W>::contains(const ValueType& value) const
     return m_impl.contains(value); 
 }
 
+template<typename T, typename U, typename V, typename W>
+template<typename Functor>
+inline void HashSet<T, U, V, W>::containsMany(Span<const ValueType> values, const Functor& functor) const
+{
+    const_cast<HashTableType&>(m_impl).lookupMany(values, [&](const ValueType* entry) {
+        functor(!!entry);
+    });
+}
+
 template<typename Value, typename HashFunctions, typename Traits, typename TableTraits>
 template<typename HashTranslator, typename T>
 inline auto HashSet<Value, HashFunctions, Traits, TableTraits>::find(const T& value) const -> iterator
@@ -541,6 +554,12 @@ inline void HashSet<T, U, V, W>::checkConsistency() const
     m_impl.checkTableConsistency();
 }
 
+// HashSet that keeps up to inlineCapacity values in inline storage, so sets that stay small
+// never allocate. See InlineHashTableTraits for the move/swap trade-offs.
+template<typename ValueArg, unsigned inlineCapacity, typename HashArg = DefaultHash<ValueArg>, typename TraitsArg = HashTraits<ValueArg>>
+using InlineHashSet = HashSet<ValueArg, HashArg, TraitsArg, InlineHashTableTraits<inlineCapacity>>;
+
 } // namespace WTF
 
 using WTF::HashSet;
+using WTF::InlineHashSet;
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <iterator>
 #include <mutex>
@@ -33,6 +34,7 @@
 #include <wtf/HashTraits.h>
 #include <wtf/Lock.h>
 #include <wtf/MathExtras.h>
+#include <wtf/Span.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/ValueCheck.h>
 #include <wtf/WeakRandomNumber.h>
@@ -366,10 +368,10 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         static_assert(!static_cast<unsigned>(value >> 31), "HashTableNoCapacityOverflow");
     };
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     class HashTable {
     public:
-        using HashTableType = HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>;
+        using HashTableType = HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>;
         typedef HashTableIterator<HashTableType, Key, Value, Extractor, HashFunctions, Traits, KeyTraits> iterator;
         typedef HashTableConstIterator<HashTableType, Key, Value, Extractor, HashFunctions, Traits, KeyTraits> const_iterator;
         typedef Traits ValueTraits;
@@ -380,6 +382,10 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 
         using HashTableSizePolicy = HashTableCapacityForSize<1>;
 
+        // Size of the table held in inline storage. Sized so that InlineCapacity entries never
+        // trigger an expansion, and never smaller than the minimum table size.
+        static constexpr unsigned inlineTableSize = InlineCapacity ? std::max<unsigned>(HashTableCapacityForSize<InlineCapacity ? InlineCapacity : 1>::value, KeyTraits::minimumTableSize) : 0;
+
 #if DUMP_HASHTABLE_STATS_PER_TABLE
         struct Stats {
             WTF_MAKE_STRUCT_FAST_ALLOCATED;
@@ -520,6 +526,13 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         template<typename HashTranslator, typename T> ValueType* lookup(const T&);
         template<typename HashTranslator, typename T> ValueType* inlineLookup(const T&);
 
+        // Resolves a batch of independent lookups, prefetching the initial bucket for each key
+        // before probing any of them so cache misses from dependent lookups overlap instead of
+        // serializing. The functor is called once per key, in order, with a ValueType* that is
+        // null when the key is absent.
+        template<typename Functor> void lookupMany(Span<const Key> keys, const Functor& functor) { lookupMany<IdentityTranslatorType>(keys, functor); }
+        template<typename HashTranslator, typename T, typename Functor> void lookupMany(Span<const T>, const Functor&);
+
         ALWAYS_INLINE bool isNullStorage() const { return !m_table; }
 
 #if ASSERT_ENABLED
@@ -536,14 +549,29 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 #endif
 
     private:
-        static ValueType* allocateTable(unsigned size);
-        static void deallocateTable(ValueType* table);
+        ValueType* allocateTable(unsigned size);
+        void deallocateTable(ValueType* table);
+
+        ValueType* inlineBuffer() { return reinterpret_cast_ptr<ValueType*>(m_inlineStorage.buffer + metadataSize); }
+        bool isInlineBuffer(const ValueType* table) const
+        {
+            if constexpr (InlineCapacity)
+                return table == const_cast<HashTable*>(this)->inlineBuffer();
+            return false;
+        }
+        bool usesInlineStorage() const { return isInlineBuffer(m_table); }
+
+        // Takes ownership of other's table, assuming this table is currently null. Steals the
+        // heap allocation when possible; tables living in other's inline storage have their
+        // buckets moved over one by one.
+        void moveFrom(HashTable&&);
 
         typedef std::pair<ValueType*, bool> LookupType;
         typedef std::pair<LookupType, unsigned> FullLookupType;
 
         ValueType* lookupForReinsert(const Key& key) { return lookupForReinsert<IdentityTranslatorType>(key); };
         template<typename HashTranslator, typename T> ValueType* lookupForReinsert(const T&);
+        template<typename HashTranslator, typename T> ValueType* inlineLookupWithHash(const T&, unsigned hash);
         template<typename HashTranslator, typename T> FullLookupType fullLookupForWriting(const T&);
 
         template<typename HashTranslator, typename T, typename Extra> void addUniqueForInitialization(T&& key, Extra&&);
@@ -613,6 +641,12 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
             unsigned* m_tableForLLDB;
         };
 
+        struct InlineStorage {
+            alignas(std::max(alignof(ValueType), alignof(unsigned))) uint8_t buffer[metadataSize + inlineTableSize * sizeof(ValueType)];
+        };
+        struct EmptyInlineStorage { };
+        NO_UNIQUE_ADDRESS std::conditional_t<!!InlineCapacity, InlineStorage, EmptyInlineStorage> m_inlineStorage;
+
 #if CHECK_HASHTABLE_ITERATORS
     public:
         // All access to m_iterators should be guarded with m_mutex.
@@ -627,8 +661,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 #endif
     };
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::HashTable()
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::HashTable()
         : m_table(nullptr)
 #if CHECK_HASHTABLE_ITERATORS
         , m_iterators(0)
@@ -642,17 +676,17 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 
 #if !ASSERT_ENABLED
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T>
-    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::checkKey(const T&)
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::checkKey(const T&)
     {
     }
 
 #else // ASSERT_ENABLED
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::checkKey(const T& key)
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::checkKey(const T& key)
     {
         if (!HashFunctions::safeToCompareToEmptyOrDeleted)
             return;
@@ -666,16 +700,23 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 
 #endif // ASSERT_ENABLED
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T>
-    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::lookup(const T& key) -> ValueType*
+    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::lookup(const T& key) -> ValueType*
     {
         return inlineLookup<HashTranslator>(key);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    template<typename HashTranslator, typename T>
+    ALWAYS_INLINE auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::inlineLookup(const T& key) -> ValueType*
+    {
+        return inlineLookupWithHash<HashTranslator>(key, HashTranslator::hash(key));
+    }
+
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T>
-    ALWAYS_INLINE auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::inlineLookup(const T& key) -> ValueType*
+    ALWAYS_INLINE auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::inlineLookupWithHash(const T& key, unsigned h) -> ValueType*
     {
         static_assert(sizeof(Value) <= 150, "Your HashTable types are too big to efficiently move when rehashing.  Consider using UniqueRef instead");
         checkKey<HashTranslator>(key);
@@ -685,7 +726,6 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
             return nullptr;
 
         unsigned sizeMask = tableSizeMask();
-        unsigned h = HashTranslator::hash(key);
         unsigned i = h & sizeMask;
         unsigned probeCount = 0;
 
@@ -729,9 +769,38 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         }
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    template<typename HashTranslator, typename T, typename Functor>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::lookupMany(Span<const T> keys, const Functor& functor)
+    {
+        ValueType* table = m_table;
+        if (!table) {
+            for (size_t index = 0; index < keys.size(); ++index)
+                functor(static_cast<ValueType*>(nullptr));
+            return;
+        }
+
+        constexpr size_t groupSize = 8;
+        unsigned sizeMask = tableSizeMask();
+        std::array<unsigned, groupSize> hashes;
+
+        for (size_t groupStart = 0; groupStart < keys.size(); groupStart += groupSize) {
+            size_t groupEnd = std::min(groupStart + groupSize, keys.size());
+            for (size_t index = groupStart; index < groupEnd; ++index) {
+                unsigned h = HashTranslator::hash(keys[index]);
+                hashes[index - groupStart] = h;
+#if COMPILER(GCC_COMPATIBLE)
+                __builtin_prefetch(table + (h & sizeMask));
+#endif
+            }
+            for (size_t index = groupStart; index < groupEnd; ++index)
+                functor(inlineLookupWithHash<HashTranslator>(keys[index], hashes[index - groupStart]));
+        }
+    }
+
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T>
-    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::lookupForReinsert(const T& key) -> ValueType*
+    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::lookupForReinsert(const T& key) -> ValueType*
     {
         ASSERT(m_table);
         checkKey<HashTranslator>(key);
@@ -770,9 +839,9 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         }
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T>
-    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::fullLookupForWriting(const T& key) -> FullLookupType
+    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::fullLookupForWriting(const T& key) -> FullLookupType
     {
         ASSERT(m_table);
         checkKey<HashTranslator>(key);
@@ -830,9 +899,9 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         }
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T, typename Extra>
-    ALWAYS_INLINE void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::addUniqueForInitialization(T&& key, Extra&& extra)
+    ALWAYS_INLINE void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::addUniqueForInitialization(T&& key, Extra&& extra)
     {
         ASSERT(m_table);
 
@@ -867,15 +936,15 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         }
     };
     
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::initializeBucket(ValueType& bucket)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::initializeBucket(ValueType& bucket)
     {
         HashTableBucketInitializer<Traits::emptyValueIsZero>::template initialize<Traits>(bucket);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T, typename Extra>
-    ALWAYS_INLINE auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::add(T&& key, Extra&& extra) -> AddResult
+    ALWAYS_INLINE auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::add(T&& key, Extra&& extra) -> AddResult
     {
         checkKey<HashTranslator>(key);
 
@@ -957,9 +1026,9 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return AddResult(makeKnownGoodIterator(entry), true);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename HashTranslator, typename T, typename Extra>
-    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::addPassingHashCode(T&& key, Extra&& extra) -> AddResult
+    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::addPassingHashCode(T&& key, Extra&& extra) -> AddResult
     {
         checkKey<HashTranslator>(key);
 
@@ -995,8 +1064,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return AddResult(makeKnownGoodIterator(entry), true);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::reinsert(ValueType&& entry) -> ValueType*
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::reinsert(ValueType&& entry) -> ValueType*
     {
         ASSERT(m_table);
         ASSERT(!isDeletedBucket(*lookupForReinsert(Extractor::extract(entry))));
@@ -1015,9 +1084,9 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return newEntry;
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template <typename HashTranslator, typename T> 
-    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::find(const T& key) -> iterator
+    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::find(const T& key) -> iterator
     {
         if (!m_table)
             return end();
@@ -1029,9 +1098,9 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return makeKnownGoodIterator(entry);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template <typename HashTranslator, typename T> 
-    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::find(const T& key) const -> const_iterator
+    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::find(const T& key) const -> const_iterator
     {
         if (!m_table)
             return end();
@@ -1043,9 +1112,9 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return makeKnownGoodConstIterator(entry);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template <typename HashTranslator, typename T> 
-    bool HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::contains(const T& key) const
+    bool HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::contains(const T& key) const
     {
         if (!m_table)
             return false;
@@ -1053,23 +1122,23 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return const_cast<HashTable*>(this)->lookup<HashTranslator>(key);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::removeAndInvalidateWithoutEntryConsistencyCheck(ValueType* pos)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::removeAndInvalidateWithoutEntryConsistencyCheck(ValueType* pos)
     {
         invalidateIterators(this);
         remove(pos);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::removeAndInvalidate(ValueType* pos)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::removeAndInvalidate(ValueType* pos)
     {
         invalidateIterators(this);
         internalCheckTableConsistency();
         remove(pos);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::remove(ValueType* pos)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::remove(ValueType* pos)
     {
 #if DUMP_HASHTABLE_STATS
         ++HashTableStats::numRemoves;
@@ -1088,8 +1157,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         internalCheckTableConsistency();
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::remove(iterator it)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::remove(iterator it)
     {
         if (it == end())
             return;
@@ -1097,8 +1166,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         removeAndInvalidate(const_cast<ValueType*>(it.m_iterator.m_position));
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::removeWithoutEntryConsistencyCheck(iterator it)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::removeWithoutEntryConsistencyCheck(iterator it)
     {
         if (it == end())
             return;
@@ -1106,8 +1175,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         removeAndInvalidateWithoutEntryConsistencyCheck(const_cast<ValueType*>(it.m_iterator.m_position));
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::removeWithoutEntryConsistencyCheck(const_iterator it)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::removeWithoutEntryConsistencyCheck(const_iterator it)
     {
         if (it == end())
             return;
@@ -1115,15 +1184,15 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         removeAndInvalidateWithoutEntryConsistencyCheck(const_cast<ValueType*>(it.m_position));
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::remove(const KeyType& key)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::remove(const KeyType& key)
     {
         remove(find(key));
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
     template<typename Functor>
-    inline bool HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::removeIf(const Functor& functor)
+    inline bool HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::removeIf(const Functor& functor)
     {
         // We must use local copies in case "functor" or "deleteBucket"
         // make a function call, which prevents the compiler from keeping
@@ -1154,11 +1223,26 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return removedBucketCount;
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::allocateTable(unsigned size) -> ValueType*
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::allocateTable(unsigned size) -> ValueType*
     {
         static_assert(!(metadataSize % alignof(ValueType)));
 
+        if constexpr (InlineCapacity) {
+            // Tables of the inline size live in m_inlineStorage, unless it is occupied, which
+            // can happen when rehashing in place at the inline size.
+            if (size == inlineTableSize && !usesInlineStorage()) {
+                if (Traits::emptyValueIsZero) {
+                    memset(m_inlineStorage.buffer, 0, sizeof(m_inlineStorage.buffer));
+                    return inlineBuffer();
+                }
+                ValueType* result = inlineBuffer();
+                for (unsigned i = 0; i < size; i++)
+                    initializeBucket(result[i]);
+                return result;
+            }
+        }
+
         // would use a template member function with explicit specializations here, but
         // gcc doesn't appear to support that
         if (Traits::emptyValueIsZero)
@@ -1170,19 +1254,20 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return result;
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::deallocateTable(ValueType* table)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::deallocateTable(ValueType* table)
     {
         unsigned size = reinterpret_cast_ptr<unsigned*>(table)[tableSizeOffset];
         for (unsigned i = 0; i < size; ++i) {
             if (!isDeletedBucket(table[i]))
                 table[i].~ValueType();
         }
-        HashTableMalloc::free(reinterpret_cast<char*>(table) - metadataSize);
+        if (!isInlineBuffer(table))
+            HashTableMalloc::free(reinterpret_cast<char*>(table) - metadataSize);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::expand(ValueType* entry) -> ValueType*
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::expand(ValueType* entry) -> ValueType*
     {
         if (KeyTraits::hasIsReleasedWeakValueFunction)
             deleteReleasedWeakBuckets();
@@ -1199,8 +1284,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return rehash(newSize, entry);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    constexpr unsigned HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::computeBestTableSize(unsigned keyCount)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    constexpr unsigned HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::computeBestTableSize(unsigned keyCount)
     {
         unsigned bestTableSize = WTF::roundUpToPowerOfTwo(keyCount);
 
@@ -1234,15 +1319,15 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         return std::max(bestTableSize, minimumTableSize);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::shrinkToBestSize()
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::shrinkToBestSize()
     {
         unsigned minimumTableSize = KeyTraits::minimumTableSize;
         rehash(std::max(minimumTableSize, computeBestTableSize(keyCount())), nullptr);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::deleteReleasedWeakBuckets()
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::deleteReleasedWeakBuckets()
     {
         unsigned tableSize = this->tableSize();
         for (unsigned i = 0; i < tableSize; ++i) {
@@ -1255,8 +1340,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         }
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::rehash(unsigned newTableSize, ValueType* entry) -> ValueType*
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::rehash(unsigned newTableSize, ValueType* entry) -> ValueType*
     {
         internalCheckTableConsistencyExceptSize();
 
@@ -1309,15 +1394,15 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
             }
         }
 
-        if (oldTable)
+        if (oldTable && !isInlineBuffer(oldTable))
             HashTableMalloc::free(reinterpret_cast<char*>(oldTable) - metadataSize);
 
         internalCheckTableConsistency();
         return newEntry;
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::clear()
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::clear()
     {
         invalidateIterators(this);
         if (!m_table)
@@ -1326,8 +1411,8 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
         deallocateTable(std::exchange(m_table, nullptr));
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::HashTable(const HashTable& other)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::HashTable(const HashTable& other)
         : m_table(nullptr)
 #if CHECK_HASHTABLE_ITERATORS
         , m_iterators(nullptr)
@@ -1352,12 +1437,25 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
             addUniqueForInitialization<IdentityTranslatorType>(Extractor::extract(otherValue), otherValue);
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::swap(HashTable& other)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::swap(HashTable& other)
     {
         invalidateIterators(this);
         invalidateIterators(&other);
 
+        if constexpr (InlineCapacity) {
+            if (usesInlineStorage() || other.usesInlineStorage()) {
+                HashTable temp(WTFMove(other));
+                other.moveFrom(WTFMove(*this));
+                moveFrom(WTFMove(temp));
+#if DUMP_HASHTABLE_STATS_PER_TABLE
+                other.m_stats = WTFMove(m_stats);
+                m_stats = WTFMove(temp.m_stats);
+#endif
+                return;
+            }
+        }
+
         std::swap(m_table, other.m_table);
 
 #if DUMP_HASHTABLE_STATS_PER_TABLE
@@ -1365,16 +1463,16 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 #endif
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::operator=(const HashTable& other) -> HashTable&
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::operator=(const HashTable& other) -> HashTable&
     {
         HashTable tmp(other);
         swap(tmp);
         return *this;
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::HashTable(HashTable&& other)
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::HashTable(HashTable&& other)
 #if CHECK_HASHTABLE_ITERATORS
         : m_iterators(nullptr)
         , m_mutex(makeUnique<Lock>())
@@ -1382,7 +1480,7 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
     {
         invalidateIterators(&other);
 
-        m_table = std::exchange(other.m_table, nullptr);
+        moveFrom(WTFMove(other));
 
 #if DUMP_HASHTABLE_STATS_PER_TABLE
         m_stats = WTFMove(other.m_stats);
@@ -1390,8 +1488,42 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 #endif
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::operator=(HashTable&& other) -> HashTable&
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::moveFrom(HashTable&& other)
+    {
+        ASSERT(!m_table);
+
+        if constexpr (InlineCapacity) {
+            if (other.usesInlineStorage()) {
+                ValueType* otherTable = other.m_table;
+                unsigned otherTableSize = other.tableSize();
+                m_table = allocateTable(otherTableSize);
+                setTableSize(otherTableSize);
+                setTableSizeMask(otherTableSize - 1);
+                setKeyCount(other.keyCount());
+                setDeletedCount(0);
+
+                for (unsigned i = 0; i < otherTableSize; ++i) {
+                    auto& bucket = otherTable[i];
+                    if (isEmptyOrDeletedBucket(bucket))
+                        continue;
+                    if (isReleasedWeakBucket(bucket)) {
+                        setKeyCount(keyCount() - 1);
+                        continue;
+                    }
+                    reinsert(WTFMove(bucket));
+                }
+
+                other.deallocateTable(std::exchange(other.m_table, nullptr));
+                return;
+            }
+        }
+
+        m_table = std::exchange(other.m_table, nullptr);
+    }
+
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    inline auto HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::operator=(HashTable&& other) -> HashTable&
     {
         HashTable temp = WTFMove(other);
         swap(temp);
@@ -1400,16 +1532,16 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 
 #if ASSERT_ENABLED
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::checkTableConsistency() const
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::checkTableConsistency() const
     {
         checkTableConsistencyExceptSize();
         ASSERT(!m_table || !shouldExpand());
         ASSERT(!shouldShrink());
     }
 
-    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>::checkTableConsistencyExceptSize() const
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, unsigned InlineCapacity>
+    void HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, InlineCapacity>::checkTableConsistencyExceptSize() const
     {
         if (!m_table)
             return;
@@ -1513,7 +1645,18 @@ DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HashTable);
 
     struct HashTableTraits {
         template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
-        using TableType = HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits>;
+        using TableType = HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, 0>;
+    };
+
+    // Table traits that keep up to inlineCapacity entries in storage inside the HashMap/HashSet
+    // itself, so small tables never allocate. Once a table outgrows the inline storage it moves
+    // to the heap and stays there. Moving or swapping a table that is using its inline storage
+    // has to move the buckets one by one, so inline capacity is best suited to tables that are
+    // rarely moved, like members of heap-allocated objects.
+    template<unsigned inlineCapacity>
+    struct InlineHashTableTraits {
+        template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits>
+        using TableType = HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, inlineCapacity>;
     };
 
     // iterator adapters
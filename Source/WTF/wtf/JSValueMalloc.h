@@ -71,6 +71,7 @@ struct JSValueMalloc {
     static void* malloc(size_t size) { return jsValueMalloc(size); }
     static void* tryMalloc(size_t size) { return tryJSValueMalloc(size); }
     static void* realloc(void* p, size_t size) { return jsValueRealloc(p, size); }
+    static bool tryReallocInPlace(void*, size_t) { return false; }
     static void free(void* p) { jsValueFree(p); }
 };
 
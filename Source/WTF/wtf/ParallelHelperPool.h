@@ -61,6 +61,10 @@ class AutomaticThreadCondition;
 // each instance decides to start parallel marking at the same time. In that case, threads choose
 // a task at random. So long as any client has a task, all threads in the pool will continue
 // running the available tasks. Threads go idle when no client has tasks to run.
+//
+// Tasks that want fine-grained load balancing across the threads running them should use a
+// WorkStealingDeque per thread (see wtf/WorkStealingDeque.h): drain your own deque, steal from
+// a random victim when it runs dry.
 
 class ParallelHelperClient;
 
@@ -77,6 +77,8 @@ struct SystemMalloc {
         return ::realloc(p, size);
     }
 
+    static bool tryReallocInPlace(void*, size_t) { return false; }
+
     static void free(void* p)
     {
         ::free(p);
@@ -1097,6 +1097,18 @@ URLParser::URLParser(String&& input, const URL& base, const URLTextEncoding* non
         addNonSpecialDotSlash();
 }
 
+// Performance notes for anyone revisiting the hot subresource-parsing path:
+// the common case — reparsing an already-canonical absolute URL — does not
+// allocate. The syntax-violation mechanism below copies into m_asciiBuffer only
+// once the input is known to differ from its canonical form; otherwise the
+// original string is adopted wholesale. That also bounds the value of a
+// parse-result cache: the cacheable case is the cheap one, and string identity
+// alone is not a valid key anyway, since the result depends on the base URL and
+// query encoding. Character classification is one table load per code point;
+// turning that into wider span scans means restructuring the per-code-point
+// state machine (the query/fragment states are the only long uniform runs).
+// Origin interning does not belong here — SecurityOrigin is mutable via
+// document.domain and is isolated-copied across threads by design.
 template<typename CharacterType>
 void URLParser::parse(const CharacterType* input, const unsigned length, const URL& base, const URLTextEncoding* nonUTF8QueryEncoding)
 {
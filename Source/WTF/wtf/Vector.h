@@ -41,6 +41,7 @@
 
 #if ASAN_ENABLED
 extern "C" void __sanitizer_annotate_contiguous_container(const void* begin, const void* end, const void* old_mid, const void* new_mid);
+extern "C" void __asan_unpoison_memory_region(void const volatile*, size_t);
 #endif
 
 namespace JSC {
@@ -342,6 +343,22 @@ public:
         m_buffer = static_cast<T*>(Malloc::realloc(m_buffer, sizeToAllocate));
     }
 
+    // Attempts to grow the existing allocation without moving it, which succeeds when its
+    // underlying size class already covers the requested capacity. Works for any element type
+    // since no elements move.
+    bool tryExtendBufferInPlace(size_t newCapacity)
+    {
+        if (!m_buffer)
+            return false;
+        if (newCapacity > std::numeric_limits<unsigned>::max() / sizeof(T))
+            return false;
+        size_t sizeToAllocate = newCapacity * sizeof(T);
+        if (!Malloc::tryReallocInPlace(m_buffer, sizeToAllocate))
+            return false;
+        m_capacity = sizeToAllocate / sizeof(T);
+        return true;
+    }
+
     void deallocateBuffer(T* bufferToDeallocate)
     {
         if (!bufferToDeallocate)
@@ -437,6 +454,7 @@ public:
     using Base::tryAllocateBuffer;
     using Base::shouldReallocateBuffer;
     using Base::reallocateBuffer;
+    using Base::tryExtendBufferInPlace;
     using Base::deallocateBuffer;
 
     using Base::buffer;
@@ -525,6 +543,14 @@ public:
         Base::reallocateBuffer(newCapacity);
     }
 
+    bool tryExtendBufferInPlace(size_t newCapacity)
+    {
+        // The inline buffer cannot be extended.
+        if (buffer() == inlineBuffer())
+            return false;
+        return Base::tryExtendBufferInPlace(newCapacity);
+    }
+
     void swap(VectorBuffer& other, size_t mySize, size_t otherSize)
     {
         if (buffer() == inlineBuffer() && other.buffer() == other.inlineBuffer()) {
@@ -1287,6 +1313,17 @@ bool Vector<T, inlineCapacity, OverflowHandler, minCapacity, Malloc>::reserveCap
 
     asanSetBufferSizeToFullCapacity();
 
+    // Growing in place avoids both the new allocation and the element moves.
+    if (Base::tryExtendBufferInPlace(newCapacity)) {
+#if ASAN_ENABLED
+        // The container annotation at the old capacity boundary is stale now that the buffer
+        // covers more of the allocation; unpoison the whole region before re-annotating it.
+        __asan_unpoison_memory_region(buffer(), capacity() * sizeof(T));
+#endif
+        asanSetInitialBufferSizeTo(size());
+        return true;
+    }
+
     bool success = Base::template allocateBuffer<action>(newCapacity);
     if constexpr (action == FailureAction::Report) {
         if (UNLIKELY(!success)) {
@@ -27,6 +27,7 @@
 
 #include <wtf/Algorithms.h>
 #include <wtf/HashSet.h>
+#include <wtf/Vector.h>
 #include <wtf/WeakPtr.h>
 
 namespace WTF {
@@ -107,8 +108,23 @@ public:
     template <typename U>
     AddResult add(const U& value)
     {
+        auto& impl = *static_cast<const T&>(value).weakPtrFactory().template createWeakPtr<T>(const_cast<U&>(value), assertionsPolicy).m_impl;
+        if (UNLIKELY(m_iterationDepth)) {
+            // Additions during forEach() are deferred so they cannot rehash the table out from
+            // under the active iteration; deferred entries are not visited by that iteration,
+            // and the returned AddResult carries no iterator.
+            auto& deferred = ensureDeferredMutations();
+            deferred.removals.remove(&impl);
+            AddResult result;
+            if (m_set.contains(impl))
+                return result;
+            result.isNewEntry = !deferred.additions.containsIf([&](auto& addition) { return addition.ptr() == &impl; });
+            if (result.isNewEntry)
+                deferred.additions.append(impl);
+            return result;
+        }
         amortizedCleanupIfNeeded();
-        return m_set.add(*static_cast<const T&>(value).weakPtrFactory().template createWeakPtr<T>(const_cast<U&>(value), assertionsPolicy).m_impl);
+        return m_set.add(impl);
     }
 
     template <typename U>
@@ -116,13 +132,29 @@ public:
     {
         amortizedCleanupIfNeeded();
         auto& weakPtrImpl = value.weakPtrFactory().m_impl;
-        if (auto* pointer = weakPtrImpl.pointer(); pointer && *pointer)
+        if (auto* pointer = weakPtrImpl.pointer(); pointer && *pointer) {
+            if (UNLIKELY(m_iterationDepth)) {
+                auto& deferred = ensureDeferredMutations();
+                if (deferred.additions.removeFirstMatching([&](auto& addition) { return addition.ptr() == pointer; }))
+                    return true;
+                if (!m_set.contains(*pointer))
+                    return false;
+                return deferred.removals.add(pointer).isNewEntry;
+            }
             return m_set.remove(*pointer);
+        }
         return false;
     }
 
     void clear()
     {
+        if (UNLIKELY(m_iterationDepth)) {
+            auto& deferred = ensureDeferredMutations();
+            deferred.additions.clear();
+            for (auto& item : m_set)
+                deferred.removals.add(item.ptr());
+            return;
+        }
         m_set.clear();
         m_operationCountSinceLastCleanup = 0;
     }
@@ -132,8 +164,15 @@ public:
     {
         increaseOperationCountSinceLastCleanup();
         auto& weakPtrImpl = value.weakPtrFactory().m_impl;
-        if (auto* pointer = weakPtrImpl.pointer(); pointer && *pointer)
+        if (auto* pointer = weakPtrImpl.pointer(); pointer && *pointer) {
+            if (UNLIKELY(m_deferredMutations)) {
+                if (m_deferredMutations->removals.contains(pointer))
+                    return false;
+                if (m_deferredMutations->additions.containsIf([&](auto& addition) { return addition.ptr() == pointer; }))
+                    return true;
+            }
             return m_set.contains(*pointer);
+        }
         return false;
     }
 
@@ -148,23 +187,41 @@ public:
 
     unsigned computeSize() const
     {
+        if (UNLIKELY(m_iterationDepth)) {
+            unsigned size = 0;
+            for (auto& item : m_set) {
+                if (item->template get<T>() && !(m_deferredMutations && m_deferredMutations->removals.contains(item.ptr())))
+                    ++size;
+            }
+            if (m_deferredMutations) {
+                for (auto& addition : m_deferredMutations->additions) {
+                    if (addition->template get<T>())
+                        ++size;
+                }
+            }
+            return size;
+        }
         const_cast<WeakHashSet&>(*this).removeNullReferences();
         return m_set.size();
     }
 
+    // Iterates in place without copying the set. Mutations made by the callback are deferred
+    // until the outermost iteration finishes: entries added during iteration are not visited,
+    // and entries removed during iteration are skipped if not yet visited.
     void forEach(const Function<void(T&)>& callback)
     {
         increaseOperationCountSinceLastCleanup();
-        auto items = map(m_set, [](const Ref<WeakPtrImpl>& item) {
+        ++m_iterationDepth;
+        for (auto& item : m_set) {
             auto* pointer = static_cast<T*>(item->template get<T>());
-            return WeakPtr<T, WeakPtrImpl> { pointer };
-        });
-        for (auto& item : items) {
-            // FIXME: This contains check is only necessary if the set is being mutated during iteration.
-            // Change it to an assertion, or make this function use begin() and end().
-            if (item && m_set.contains(*item.m_impl))
-                callback(*item);
+            if (!pointer)
+                continue;
+            if (UNLIKELY(m_deferredMutations) && m_deferredMutations->removals.contains(item.ptr()))
+                continue;
+            callback(*pointer);
         }
+        if (!--m_iterationDepth)
+            applyDeferredMutations();
     }
 
 #if ASSERT_ENABLED
@@ -174,8 +231,35 @@ public:
 #endif
 
 private:
+    struct DeferredMutations {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        Vector<Ref<WeakPtrImpl>> additions;
+        HashSet<WeakPtrImpl*> removals;
+    };
+
+    DeferredMutations& ensureDeferredMutations()
+    {
+        ASSERT(m_iterationDepth);
+        if (!m_deferredMutations)
+            m_deferredMutations = makeUnique<DeferredMutations>();
+        return *m_deferredMutations;
+    }
+
+    void applyDeferredMutations()
+    {
+        ASSERT(!m_iterationDepth);
+        if (!m_deferredMutations)
+            return;
+        auto deferredMutations = std::exchange(m_deferredMutations, nullptr);
+        if (!deferredMutations->removals.isEmpty())
+            m_set.removeIf([&](auto& item) { return deferredMutations->removals.contains(item.ptr()); });
+        for (auto& addition : deferredMutations->additions)
+            m_set.add(WTFMove(addition));
+    }
+
     ALWAYS_INLINE void removeNullReferences()
     {
+        ASSERT(!m_iterationDepth);
         m_set.removeIf([] (auto& value) { return !value.get(); });
         m_operationCountSinceLastCleanup = 0;
     }
@@ -188,13 +272,17 @@ private:
 
     ALWAYS_INLINE void amortizedCleanupIfNeeded() const
     {
+        if (m_iterationDepth)
+            return;
         unsigned currentCount = increaseOperationCountSinceLastCleanup();
         if (currentCount / 2 > m_set.size())
             const_cast<WeakHashSet&>(*this).removeNullReferences();
     }
 
     WeakPtrImplSet m_set;
+    std::unique_ptr<DeferredMutations> m_deferredMutations;
     mutable unsigned m_operationCountSinceLastCleanup { 0 };
+    unsigned m_iterationDepth { 0 };
 };
 
 template<typename MapFunction, typename T, typename WeakMapImpl>
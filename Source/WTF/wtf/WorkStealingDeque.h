@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <wtf/Atomics.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/MathExtras.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+
+// A Chase-Lev work-stealing deque. The owning thread pushes and pops at the bottom without
+// contention on the fast path; any number of other threads may concurrently steal from the
+// top. This is the load-balancing structure tasks run on a ParallelHelperPool are expected
+// to use: each worker drains its own deque and steals from a random victim when it runs dry.
+//
+// Elements must be trivially copyable, since concurrent stealers read slots that the owner
+// may be about to overwrite; think pointers or small PODs.
+template<typename T>
+class WorkStealingDeque {
+    WTF_MAKE_NONCOPYABLE(WorkStealingDeque);
+    WTF_MAKE_FAST_ALLOCATED;
+    static_assert(std::is_trivially_copyable_v<T>, "Stealers race with the owner on slot reuse, so elements must be trivially copyable");
+public:
+    explicit WorkStealingDeque(size_t initialCapacity = 32)
+    {
+        m_buffer.store(Buffer::create(roundUpToPowerOfTwo(initialCapacity)), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque()
+    {
+        Buffer::destroy(m_buffer.load(std::memory_order_relaxed));
+        for (Buffer* buffer : m_retiredBuffers)
+            Buffer::destroy(buffer);
+    }
+
+    // Owner only.
+    void push(T value)
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+        if (bottom - top > static_cast<int64_t>(buffer->capacityMask)) {
+            buffer = grow(buffer, bottom, top);
+        }
+
+        buffer->slot(bottom).store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only.
+    bool pop(T& result)
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Deque was already empty.
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        result = buffer->slot(bottom).load(std::memory_order_relaxed);
+        if (top != bottom)
+            return true;
+
+        // Last element; race against stealers for it.
+        bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    // Safe from any thread.
+    bool steal(T& result)
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return false;
+
+        Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+        result = buffer->slot(top).load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // Approximate when other threads are active.
+    bool isEmpty() const { return size() <= 0; }
+    int64_t size() const
+    {
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        return bottom - top;
+    }
+
+private:
+    struct Buffer {
+        size_t capacityMask;
+        // Slots follow.
+
+        static Buffer* create(size_t capacity)
+        {
+            Buffer* buffer = static_cast<Buffer*>(fastMalloc(sizeof(Buffer) + capacity * sizeof(std::atomic<T>)));
+            buffer->capacityMask = capacity - 1;
+            return buffer;
+        }
+
+        static void destroy(Buffer* buffer) { fastFree(buffer); }
+
+        std::atomic<T>& slot(int64_t index)
+        {
+            return reinterpret_cast<std::atomic<T>*>(this + 1)[index & capacityMask];
+        }
+    };
+
+    Buffer* grow(Buffer* oldBuffer, int64_t bottom, int64_t top)
+    {
+        Buffer* newBuffer = Buffer::create((oldBuffer->capacityMask + 1) * 2);
+        for (int64_t i = top; i < bottom; ++i)
+            newBuffer->slot(i).store(oldBuffer->slot(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_buffer.store(newBuffer, std::memory_order_release);
+        // Concurrent stealers may still be reading the old buffer, so retire it instead of
+        // freeing it; it dies with the deque.
+        m_retiredBuffers.append(oldBuffer);
+        return newBuffer;
+    }
+
+    std::atomic<int64_t> m_top { 0 };
+    std::atomic<int64_t> m_bottom { 0 };
+    std::atomic<Buffer*> m_buffer { nullptr };
+    Vector<Buffer*, 4> m_retiredBuffers;
+};
+
+} // namespace WTF
+
+using WTF::WorkStealingDeque;
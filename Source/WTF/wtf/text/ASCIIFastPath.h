@@ -30,6 +30,10 @@
 #include <emmintrin.h>
 #endif
 
+#if CPU(ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace WTF {
 
 template <uintptr_t mask>
@@ -79,6 +83,40 @@ inline bool isAllASCII(MachineWord word)
 template<typename CharacterType>
 inline bool charactersAreAllASCII(const CharacterType* characters, size_t length)
 {
+#if CPU(X86_SSE2)
+    constexpr size_t charactersPerVector = 16 / sizeof(CharacterType);
+    if (length >= charactersPerVector) {
+        // OR all the input into one accumulator vector; unaligned loads are cheap, and the
+        // final (possibly partial) vector is handled with an overlapping load.
+        const CharacterType* end = characters + length;
+        __m128i accumulator = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end - charactersPerVector));
+        for (; length >= charactersPerVector; length -= charactersPerVector, characters += charactersPerVector)
+            accumulator = _mm_or_si128(accumulator, _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters)));
+        if constexpr (sizeof(CharacterType) == 1)
+            return !_mm_movemask_epi8(accumulator);
+        else {
+            __m128i nonASCII = _mm_and_si128(accumulator, _mm_set1_epi16(static_cast<short>(0xFF80)));
+            return _mm_movemask_epi8(_mm_cmpeq_epi16(nonASCII, _mm_setzero_si128())) == 0xFFFF;
+        }
+    }
+#elif CPU(ARM64)
+    constexpr size_t charactersPerVector = 16 / sizeof(CharacterType);
+    if (length >= charactersPerVector) {
+        const CharacterType* end = characters + length;
+        if constexpr (sizeof(CharacterType) == 1) {
+            uint8x16_t accumulator = vld1q_u8(reinterpret_cast<const uint8_t*>(end - charactersPerVector));
+            for (; length >= charactersPerVector; length -= charactersPerVector, characters += charactersPerVector)
+                accumulator = vorrq_u8(accumulator, vld1q_u8(reinterpret_cast<const uint8_t*>(characters)));
+            return !(vmaxvq_u8(accumulator) & 0x80);
+        } else {
+            uint16x8_t accumulator = vld1q_u16(reinterpret_cast<const uint16_t*>(end - charactersPerVector));
+            for (; length >= charactersPerVector; length -= charactersPerVector, characters += charactersPerVector)
+                accumulator = vorrq_u16(accumulator, vld1q_u16(reinterpret_cast<const uint16_t*>(characters)));
+            return !vmaxvq_u16(vandq_u16(accumulator, vdupq_n_u16(0xFF80)));
+        }
+    }
+#endif
+
     MachineWord allCharBits = 0;
     const CharacterType* end = characters + length;
 
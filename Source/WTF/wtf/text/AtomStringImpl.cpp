@@ -42,31 +42,31 @@ using namespace Unicode;
 class AtomStringTableLocker : public LockHolder {
     WTF_MAKE_NONCOPYABLE(AtomStringTableLocker);
 
-    static Lock s_stringTableLock;
+    static Lock s_stringTableLocks[AtomStringTable::shardCount];
 public:
-    AtomStringTableLocker()
-        : LockHolder(s_stringTableLock)
+    explicit AtomStringTableLocker(unsigned hash)
+        : LockHolder(s_stringTableLocks[AtomStringTable::shardIndex(hash)])
     {
     }
 };
 
-Lock AtomStringTableLocker::s_stringTableLock;
+Lock AtomStringTableLocker::s_stringTableLocks[AtomStringTable::shardCount];
 
 #else
 
 class AtomStringTableLocker {
     WTF_MAKE_NONCOPYABLE(AtomStringTableLocker);
 public:
-    AtomStringTableLocker() { }
+    explicit AtomStringTableLocker(unsigned) { }
 };
 
 #endif // USE(WEB_THREAD)
 
 using StringTableImpl = AtomStringTable::StringTableImpl;
 
-static ALWAYS_INLINE StringTableImpl& stringTable()
+static ALWAYS_INLINE StringTableImpl& stringTable(unsigned hash)
 {
-    return Thread::current().atomStringTable()->table();
+    return Thread::current().atomStringTable()->table(hash);
 }
 
 template<typename T, typename HashTranslator>
@@ -84,8 +84,9 @@ static inline Ref<AtomStringImpl> addToStringTable(AtomStringTableLocker&, Strin
 template<typename T, typename HashTranslator>
 static inline Ref<AtomStringImpl> addToStringTable(const T& value)
 {
-    AtomStringTableLocker locker;
-    return addToStringTable<T, HashTranslator>(locker, stringTable(), value);
+    unsigned hash = HashTranslator::hash(value);
+    AtomStringTableLocker locker { hash };
+    return addToStringTable<T, HashTranslator>(locker, stringTable(hash), value);
 }
 
 using UCharBuffer = HashTranslatorCharBuffer<UChar>;
@@ -195,6 +196,17 @@ struct SubstringLocation {
     StringImpl* baseString;
     unsigned start;
     unsigned length;
+    unsigned hash;
+
+    SubstringLocation(StringImpl* baseString, unsigned start, unsigned length)
+        : baseString(baseString)
+        , start(start)
+        , length(length)
+        , hash(baseString->is8Bit()
+            ? StringHasher::computeHashAndMaskTop8Bits(baseString->characters8() + start, length)
+            : StringHasher::computeHashAndMaskTop8Bits(baseString->characters16() + start, length))
+    {
+    }
 };
 
 struct SubstringTranslator {
@@ -210,7 +222,7 @@ struct SubstringTranslator {
 struct SubstringTranslator8 : SubstringTranslator {
     static unsigned hash(const SubstringLocation& buffer)
     {
-        return StringHasher::computeHashAndMaskTop8Bits(buffer.baseString->characters8() + buffer.start, buffer.length);
+        return buffer.hash;
     }
 
     static bool equal(AtomStringTable::StringEntry const& string, const SubstringLocation& buffer)
@@ -222,7 +234,7 @@ struct SubstringTranslator8 : SubstringTranslator {
 struct SubstringTranslator16 : SubstringTranslator {
     static unsigned hash(const SubstringLocation& buffer)
     {
-        return StringHasher::computeHashAndMaskTop8Bits(buffer.baseString->characters16() + buffer.start, buffer.length);
+        return buffer.hash;
     }
 
     static bool equal(AtomStringTable::StringEntry const& string, const SubstringLocation& buffer)
@@ -316,40 +328,41 @@ Ref<AtomStringImpl> AtomStringImpl::addLiteral(const char* characters, unsigned
     return addToStringTable<LCharBuffer, BufferFromStaticDataTranslator<LChar>>(buffer);
 }
 
-static Ref<AtomStringImpl> addSymbol(AtomStringTableLocker& locker, StringTableImpl& atomStringTable, StringImpl& base)
+static Ref<AtomStringImpl> addSymbol(AtomStringTable& stringTable, StringImpl& base)
 {
     ASSERT(base.length());
     ASSERT(base.isSymbol());
 
     SubstringLocation buffer = { &base, 0, base.length() };
+    AtomStringTableLocker locker { buffer.hash };
     if (base.is8Bit())
-        return addToStringTable<SubstringLocation, SubstringTranslator8>(locker, atomStringTable, buffer);
-    return addToStringTable<SubstringLocation, SubstringTranslator16>(locker, atomStringTable, buffer);
+        return addToStringTable<SubstringLocation, SubstringTranslator8>(locker, stringTable.table(buffer.hash), buffer);
+    return addToStringTable<SubstringLocation, SubstringTranslator16>(locker, stringTable.table(buffer.hash), buffer);
 }
 
 static inline Ref<AtomStringImpl> addSymbol(StringImpl& base)
 {
-    AtomStringTableLocker locker;
-    return addSymbol(locker, stringTable(), base);
+    return addSymbol(*Thread::current().atomStringTable(), base);
 }
 
-static Ref<AtomStringImpl> addStatic(AtomStringTableLocker& locker, StringTableImpl& atomStringTable, const StringImpl& base)
+static Ref<AtomStringImpl> addStatic(AtomStringTable& stringTable, const StringImpl& base)
 {
     ASSERT(base.length());
     ASSERT(base.isStatic());
 
     if (base.is8Bit()) {
         LCharBuffer buffer { base.characters8(), base.length(), base.hash() };
-        return addToStringTable<LCharBuffer, BufferFromStaticDataTranslator<LChar>>(locker, atomStringTable, buffer);
+        AtomStringTableLocker locker { buffer.hash };
+        return addToStringTable<LCharBuffer, BufferFromStaticDataTranslator<LChar>>(locker, stringTable.table(buffer.hash), buffer);
     }
     UCharBuffer buffer { base.characters16(), base.length(), base.hash() };
-    return addToStringTable<UCharBuffer, BufferFromStaticDataTranslator<UChar>>(locker, atomStringTable, buffer);
+    AtomStringTableLocker locker { buffer.hash };
+    return addToStringTable<UCharBuffer, BufferFromStaticDataTranslator<UChar>>(locker, stringTable.table(buffer.hash), buffer);
 }
 
 static inline Ref<AtomStringImpl> addStatic(const StringImpl& base)
 {
-    AtomStringTableLocker locker;
-    return addStatic(locker, stringTable(), base);
+    return addStatic(*Thread::current().atomStringTable(), base);
 }
 
 RefPtr<AtomStringImpl> AtomStringImpl::add(const StaticStringImpl* string)
@@ -374,8 +387,9 @@ Ref<AtomStringImpl> AtomStringImpl::addSlowCase(StringImpl& string)
 
     ASSERT_WITH_MESSAGE(!string.isAtom(), "AtomStringImpl should not hit the slow case if the string is already an atom.");
 
-    AtomStringTableLocker locker;
-    auto addResult = stringTable().add(&string);
+    unsigned hash = string.hash();
+    AtomStringTableLocker locker { hash };
+    auto addResult = stringTable(hash).add(&string);
 
     if (addResult.isNewEntry) {
         ASSERT(addResult.iterator->get() == &string);
@@ -400,8 +414,9 @@ Ref<AtomStringImpl> AtomStringImpl::addSlowCase(Ref<StringImpl>&& string)
 
     ASSERT_WITH_MESSAGE(!string->isAtom(), "AtomStringImpl should not hit the slow case if the string is already an atom.");
 
-    AtomStringTableLocker locker;
-    auto addResult = stringTable().add(string.ptr());
+    unsigned hash = string->hash();
+    AtomStringTableLocker locker { hash };
+    auto addResult = stringTable(hash).add(string.ptr());
 
     if (addResult.isNewEntry) {
         ASSERT(addResult.iterator->get() == string.ptr());
@@ -419,20 +434,17 @@ Ref<AtomStringImpl> AtomStringImpl::addSlowCase(AtomStringTable& stringTable, St
     if (!string.length())
         return *static_cast<AtomStringImpl*>(StringImpl::empty());
 
-    if (string.isStatic()) {
-        AtomStringTableLocker locker;
-        return addStatic(locker, stringTable.table(), string);
-    }
+    if (string.isStatic())
+        return addStatic(stringTable, string);
 
-    if (string.isSymbol()) {
-        AtomStringTableLocker locker;
-        return addSymbol(locker, stringTable.table(), string);
-    }
+    if (string.isSymbol())
+        return addSymbol(stringTable, string);
 
     ASSERT_WITH_MESSAGE(!string.isAtom(), "AtomStringImpl should not hit the slow case if the string is already an atom.");
 
-    AtomStringTableLocker locker;
-    auto addResult = stringTable.table().add(&string);
+    unsigned hash = string.hash();
+    AtomStringTableLocker locker { hash };
+    auto addResult = stringTable.table(hash).add(&string);
 
     if (addResult.isNewEntry) {
         ASSERT(addResult.iterator->get() == &string);
@@ -451,8 +463,9 @@ struct AtomStringTableRemovalHashTranslator {
 void AtomStringImpl::remove(AtomStringImpl* string)
 {
     ASSERT(string->isAtom());
-    AtomStringTableLocker locker;
-    auto& atomStringTable = stringTable();
+    unsigned hash = string->existingHash();
+    AtomStringTableLocker locker { hash };
+    auto& atomStringTable = stringTable(hash);
     auto iterator = atomStringTable.find<AtomStringTableRemovalHashTranslator>(string);
     ASSERT_WITH_MESSAGE(iterator != atomStringTable.end(), "The string being removed is an atom in the string table of an other thread!");
     ASSERT(string == iterator->get());
@@ -466,8 +479,9 @@ RefPtr<AtomStringImpl> AtomStringImpl::lookUpSlowCase(StringImpl& string)
     if (!string.length())
         return static_cast<AtomStringImpl*>(StringImpl::empty());
 
-    AtomStringTableLocker locker;
-    auto& atomStringTable = stringTable();
+    unsigned hash = string.hash();
+    AtomStringTableLocker locker { hash };
+    auto& atomStringTable = stringTable(hash);
     auto iterator = atomStringTable.find(&string);
     if (iterator != atomStringTable.end())
         return static_cast<AtomStringImpl*>(iterator->get());
@@ -488,10 +502,9 @@ RefPtr<AtomStringImpl> AtomStringImpl::addUTF8(const char* charactersStart, cons
 
 RefPtr<AtomStringImpl> AtomStringImpl::lookUp(const LChar* characters, unsigned length)
 {
-    AtomStringTableLocker locker;
-    auto& table = stringTable();
-
     LCharBuffer buffer = { characters, length };
+    AtomStringTableLocker locker { buffer.hash };
+    auto& table = stringTable(buffer.hash);
     auto iterator = table.find<LCharBufferTranslator>(buffer);
     if (iterator != table.end())
         return static_cast<AtomStringImpl*>(iterator->get());
@@ -500,10 +513,9 @@ RefPtr<AtomStringImpl> AtomStringImpl::lookUp(const LChar* characters, unsigned
 
 RefPtr<AtomStringImpl> AtomStringImpl::lookUp(const UChar* characters, unsigned length)
 {
-    AtomStringTableLocker locker;
-    auto& table = stringTable();
-
     UCharBuffer buffer { characters, length };
+    AtomStringTableLocker locker { buffer.hash };
+    auto& table = stringTable(buffer.hash);
     auto iterator = table.find<UCharBufferTranslator>(buffer);
     if (iterator != table.end())
         return static_cast<AtomStringImpl*>(iterator->get());
@@ -513,8 +525,9 @@ RefPtr<AtomStringImpl> AtomStringImpl::lookUp(const UChar* characters, unsigned
 #if ASSERT_ENABLED
 bool AtomStringImpl::isInAtomStringTable(StringImpl* string)
 {
-    AtomStringTableLocker locker;
-    return stringTable().contains(string);
+    unsigned hash = string->hash();
+    AtomStringTableLocker locker { hash };
+    return stringTable(hash).contains(string);
 }
 #endif
 
@@ -27,8 +27,10 @@ namespace WTF {
 
 AtomStringTable::~AtomStringTable()
 {
-    for (const auto& string : m_table)
-        string->setIsAtom(false);
+    for (auto& table : m_tables) {
+        for (const auto& string : table)
+            string->setIsAtom(false);
+    }
 }
 
 }
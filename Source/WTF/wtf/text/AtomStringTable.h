@@ -40,12 +40,20 @@ public:
     using StringEntry = std::conditional_t<CompactPtrTraits<StringImpl>::is32Bit, CompactPtr<StringImpl>, PackedPtr<StringImpl>>;
     using StringTableImpl = HashSet<StringEntry>;
 
+    // The table is sharded by string hash so that callers which serialize access with a lock
+    // (the USE(WEB_THREAD) configuration) only contend when two strings land in the same shard.
+    // String hashes are masked to 24 bits (see StringHasher) and HashTable consumes them from
+    // the low end, so the shard is picked from the top of the usable range to keep buckets
+    // within a shard fully distributed.
+    static constexpr unsigned shardCount = 8;
+    static constexpr unsigned shardIndex(unsigned hash) { return (hash >> 21) & (shardCount - 1); }
+
     WTF_EXPORT_PRIVATE ~AtomStringTable();
 
-    StringTableImpl& table() { return m_table; }
+    StringTableImpl& table(unsigned hash) { return m_tables[shardIndex(hash)]; }
 
 private:
-    StringTableImpl m_table;
+    StringTableImpl m_tables[shardCount];
 };
 
 }
@@ -63,8 +63,12 @@ public:
 
     void resize(unsigned newLength)
     {
-        if (newLength > m_length)
-            m_data = static_cast<CharType*>(StringBufferMalloc::realloc(m_data, Checked<size_t>(newLength) * sizeof(CharType)));
+        if (newLength > m_length) {
+            size_t newSizeInBytes = Checked<size_t>(newLength) * sizeof(CharType);
+            // Growing within the allocation's size class avoids the copy entirely.
+            if (!(m_data && StringBufferMalloc::tryReallocInPlace(m_data, newSizeInBytes)))
+                m_data = static_cast<CharType*>(StringBufferMalloc::realloc(m_data, newSizeInBytes));
+        }
         m_length = newLength;
     }
 
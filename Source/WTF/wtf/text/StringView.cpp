@@ -139,6 +139,30 @@ size_t StringView::reverseFind(const LChar* match, unsigned matchLength, unsigne
 
 void StringView::SplitResult::Iterator::findNextSubstring()
 {
+    if (auto* stripMatchedCharacters = m_result.m_stripMatchedCharacters) {
+        while (true) {
+            size_t separatorPosition = m_result.m_string.find(m_result.m_separator, m_position);
+            unsigned start = m_position;
+            unsigned end = separatorPosition == notFound ? m_result.m_string.length() : separatorPosition;
+            while (start < end && stripMatchedCharacters(m_result.m_string[start]))
+                ++start;
+            while (end > start && stripMatchedCharacters(m_result.m_string[end - 1]))
+                --end;
+            if (end > start) {
+                m_position = start;
+                m_length = end - start;
+                return;
+            }
+            if (separatorPosition == notFound) {
+                m_position = m_result.m_string.length();
+                m_length = 0;
+                m_isDone = true;
+                return;
+            }
+            m_position = separatorPosition + 1;
+        }
+    }
+
     for (size_t separatorPosition; (separatorPosition = m_result.m_string.find(m_result.m_separator, m_position)) != notFound; ++m_position) {
         if (m_result.m_allowEmptyEntries || separatorPosition > m_position) {
             m_length = separatorPosition - m_position;
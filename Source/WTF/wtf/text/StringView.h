@@ -151,6 +151,9 @@ public:
     class SplitResult;
     SplitResult split(UChar) const;
     SplitResult splitAllowingEmptyEntries(UChar) const;
+    // Strips characters matching the predicate from both ends of each entry; entries that are
+    // empty after stripping are skipped. This keeps tokenizing header-style lists allocation-free.
+    SplitResult splitStrippingMatchedCharacters(UChar, bool (*)(UChar)) const;
 
     size_t find(UChar, unsigned start = 0) const;
     template<typename CodeUnitMatchFunction, std::enable_if_t<std::is_invocable_r_v<bool, CodeUnitMatchFunction, UChar>>* = nullptr>
@@ -750,7 +753,7 @@ inline bool equalIgnoringASCIICase(StringView a, ASCIILiteral b)
 class StringView::SplitResult {
     WTF_MAKE_FAST_ALLOCATED;
 public:
-    SplitResult(StringView, UChar separator, bool allowEmptyEntries);
+    SplitResult(StringView, UChar separator, bool allowEmptyEntries, bool (*stripMatchedCharacters)(UChar) = nullptr);
 
     class Iterator;
     Iterator begin() const;
@@ -760,6 +763,7 @@ private:
     StringView m_string;
     UChar m_separator;
     bool m_allowEmptyEntries;
+    bool (*m_stripMatchedCharacters)(UChar);
 };
 
 class StringView::GraphemeClusters {
@@ -1054,11 +1058,18 @@ inline auto StringView::splitAllowingEmptyEntries(UChar separator) const -> Spli
     return SplitResult { *this, separator, true };
 }
 
-inline StringView::SplitResult::SplitResult(StringView stringView, UChar separator, bool allowEmptyEntries)
+inline auto StringView::splitStrippingMatchedCharacters(UChar separator, bool (*stripMatchedCharacters)(UChar)) const -> SplitResult
+{
+    return SplitResult { *this, separator, false, stripMatchedCharacters };
+}
+
+inline StringView::SplitResult::SplitResult(StringView stringView, UChar separator, bool allowEmptyEntries, bool (*stripMatchedCharacters)(UChar))
     : m_string { stringView }
     , m_separator { separator }
     , m_allowEmptyEntries { allowEmptyEntries }
+    , m_stripMatchedCharacters { stripMatchedCharacters }
 {
+    ASSERT(!(allowEmptyEntries && stripMatchedCharacters));
 }
 
 inline auto StringView::SplitResult::begin() const -> Iterator
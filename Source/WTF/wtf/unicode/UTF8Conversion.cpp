@@ -28,25 +28,115 @@
 #include <wtf/unicode/UTF8Conversion.h>
 
 #include <wtf/ASCIICType.h>
+#include <wtf/text/ASCIIFastPath.h>
 #include <wtf/text/StringHasher.h>
 #include <wtf/unicode/CharacterNames.h>
 
 namespace WTF::Unicode {
 
+// The helpers below copy the leading ASCII run of the source, a vector at a time where the
+// platform allows, stopping at the first non-ASCII character or when either buffer runs out.
+// ASCII is the overwhelmingly common case in both web content and IPC traffic, and it converts
+// to UTF-8 and UTF-16 by plain widening or narrowing.
+
+static inline void copyASCIIRun(const LChar*& source, const LChar* sourceEnd, char* target, int32_t& i, int32_t targetCapacity)
+{
+#if CPU(X86_SSE2)
+    while (sourceEnd - source >= 16 && targetCapacity - i >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        if (_mm_movemask_epi8(chunk))
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), chunk);
+        source += 16;
+        i += 16;
+    }
+#elif CPU(ARM64)
+    while (sourceEnd - source >= 16 && targetCapacity - i >= 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(source));
+        if (vmaxvq_u8(chunk) & 0x80)
+            break;
+        vst1q_u8(reinterpret_cast<uint8_t*>(target + i), chunk);
+        source += 16;
+        i += 16;
+    }
+#endif
+    while (source < sourceEnd && isASCII(*source) && i < targetCapacity)
+        target[i++] = *source++;
+}
+
+static inline void copyASCIIRun(const UChar*& source, const UChar* sourceEnd, char* target, int32_t& i, int32_t targetCapacity)
+{
+#if CPU(X86_SSE2)
+    while (sourceEnd - source >= 8 && targetCapacity - i >= 8) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        __m128i nonASCII = _mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xFF80)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonASCII, _mm_setzero_si128())) != 0xFFFF)
+            break;
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(target + i), _mm_packus_epi16(chunk, chunk));
+        source += 8;
+        i += 8;
+    }
+#elif CPU(ARM64)
+    while (sourceEnd - source >= 8 && targetCapacity - i >= 8) {
+        uint16x8_t chunk = vld1q_u16(reinterpret_cast<const uint16_t*>(source));
+        if (vmaxvq_u16(vandq_u16(chunk, vdupq_n_u16(0xFF80))))
+            break;
+        vst1_u8(reinterpret_cast<uint8_t*>(target + i), vmovn_u16(chunk));
+        source += 8;
+        i += 8;
+    }
+#endif
+    while (source < sourceEnd && isASCII(*source) && i < targetCapacity)
+        target[i++] = *source++;
+}
+
+static inline void copyASCIIRun(const uint8_t* source, int& sourceOffset, int sourceLength, UChar* target, int& targetOffset, int targetCapacity)
+{
+#if CPU(X86_SSE2)
+    while (sourceLength - sourceOffset >= 16 && targetCapacity - targetOffset >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + sourceOffset));
+        if (_mm_movemask_epi8(chunk))
+            break;
+        __m128i zero = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + targetOffset), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + targetOffset + 8), _mm_unpackhi_epi8(chunk, zero));
+        sourceOffset += 16;
+        targetOffset += 16;
+    }
+#elif CPU(ARM64)
+    while (sourceLength - sourceOffset >= 16 && targetCapacity - targetOffset >= 16) {
+        uint8x16_t chunk = vld1q_u8(source + sourceOffset);
+        if (vmaxvq_u8(chunk) & 0x80)
+            break;
+        vst1q_u16(reinterpret_cast<uint16_t*>(target + targetOffset), vmovl_u8(vget_low_u8(chunk)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(target + targetOffset + 8), vmovl_u8(vget_high_u8(chunk)));
+        sourceOffset += 16;
+        targetOffset += 16;
+    }
+#endif
+    while (sourceOffset < sourceLength && isASCII(source[sourceOffset]) && targetOffset < targetCapacity)
+        target[targetOffset++] = source[sourceOffset++];
+}
+
 bool convertLatin1ToUTF8(const LChar** sourceStart, const LChar* sourceEnd, char** targetStart, char* targetEnd)
 {
-    const LChar* source;
+    const LChar* source = *sourceStart;
     char* target = *targetStart;
+    int32_t targetCapacity = targetEnd - *targetStart;
     int32_t i = 0;
-    for (source = *sourceStart; source < sourceEnd; ++source) {
+    while (source < sourceEnd) {
+        copyASCIIRun(source, sourceEnd, target, i, targetCapacity);
+        if (source == sourceEnd)
+            break;
         UBool sawError = false;
         // Work around bug in either Windows compiler or old version of ICU, where passing a uint8_t to
         // U8_APPEND warns, by converting from uint8_t to a wider type.
         UChar32 character = *source;
-        U8_APPEND(reinterpret_cast<uint8_t*>(target), i, targetEnd - *targetStart, character, sawError);
+        U8_APPEND(reinterpret_cast<uint8_t*>(target), i, targetCapacity, character, sawError);
         ASSERT_WITH_MESSAGE(!sawError, "UTF8 destination buffer was not big enough");
         if (sawError)
             return false;
+        ++source;
     }
     *sourceStart = source;
     *targetStart = target + i;
@@ -61,6 +151,9 @@ ConversionResult convertUTF16ToUTF8(const UChar** sourceStart, const UChar* sour
     UBool sawError = false;
     int32_t i = 0;
     while (source < sourceEnd) {
+        copyASCIIRun(source, sourceEnd, target, i, targetEnd - target);
+        if (source == sourceEnd)
+            break;
         UChar32 ch;
         int j = 0;
         U16_NEXT(source, j, sourceEnd - source, ch);
@@ -97,6 +190,9 @@ bool convertUTF8ToUTF16Impl(const char* source, const char* sourceEnd, UChar** t
     UChar32 orAllData = 0;
     int targetOffset = 0;
     for (int sourceOffset = 0; sourceOffset < sourceEnd - source; ) {
+        copyASCIIRun(reinterpret_cast<const uint8_t*>(source), sourceOffset, sourceEnd - source, target, targetOffset, targetEnd - target);
+        if (sourceOffset >= sourceEnd - source)
+            break;
         UChar32 character;
         if constexpr (replaceInvalidSequences) {
             U8_NEXT_OR_FFFD(reinterpret_cast<const uint8_t*>(source), sourceOffset, sourceEnd - source, character);
@@ -47,8 +47,10 @@ ExceptionOr<RefPtr<Uint8Array>> CompressionStreamEncoder::encode(const BufferSou
     auto compressedData = compressedDataCheck.returnValue();
     if (!compressedData->byteLength())
         return nullptr;
-    
-    return Uint8Array::tryCreate(static_cast<uint8_t *>(compressedData->data()), compressedData->byteLength());
+
+    // The buffer was created by compress() and is uniquely owned, so view it instead of copying it.
+    auto length = compressedData->byteLength();
+    return Uint8Array::tryCreate(WTFMove(compressedData), 0, length);
 }
 
 ExceptionOr<RefPtr<Uint8Array>> CompressionStreamEncoder::flush()
@@ -62,11 +64,12 @@ ExceptionOr<RefPtr<Uint8Array>> CompressionStreamEncoder::flush()
     auto compressedData = compressedDataCheck.returnValue();
     if (!compressedData->byteLength())
         return nullptr;
-    
-    return Uint8Array::tryCreate(static_cast<uint8_t *>(compressedData->data()), compressedData->byteLength());
+
+    auto length = compressedData->byteLength();
+    return Uint8Array::tryCreate(WTFMove(compressedData), 0, length);
 }
 
-ExceptionOr<bool> CompressionStreamEncoder::initialize() 
+ExceptionOr<bool> CompressionStreamEncoder::initialize()
 {
     int result = Z_OK;
 
@@ -142,7 +145,7 @@ ExceptionOr<RefPtr<JSC::ArrayBuffer>> CompressionStreamEncoder::compress(const u
                 allocateSize *= 2;
         }
 
-        storage.append(output);
+        storage.append(WTFMove(output));
     }
 
     auto compressedData = storage.takeAsArrayBuffer();
@@ -45,8 +45,10 @@ ExceptionOr<RefPtr<Uint8Array>> DecompressionStreamDecoder::decode(const BufferS
     auto compressedData = compressedDataCheck.returnValue();
     if (!compressedData->byteLength())
         return nullptr;
-    
-    return Uint8Array::tryCreate(static_cast<uint8_t *>(compressedData->data()), compressedData->byteLength());
+
+    // The buffer was created by decompress() and is uniquely owned, so view it instead of copying it.
+    auto length = compressedData->byteLength();
+    return Uint8Array::tryCreate(WTFMove(compressedData), 0, length);
 }
 
 ExceptionOr<RefPtr<Uint8Array>> DecompressionStreamDecoder::flush()
@@ -60,8 +62,9 @@ ExceptionOr<RefPtr<Uint8Array>> DecompressionStreamDecoder::flush()
     auto compressedData = compressedDataCheck.returnValue();
     if (!compressedData->byteLength())
         return nullptr;
-    
-    return Uint8Array::tryCreate(static_cast<uint8_t *>(compressedData->data()), compressedData->byteLength());
+
+    auto length = compressedData->byteLength();
+    return Uint8Array::tryCreate(WTFMove(compressedData), 0, length);
 }
 
 inline ExceptionOr<RefPtr<JSC::ArrayBuffer>> DecompressionStreamDecoder::decompress(const uint8_t* input, const size_t inputLength)
@@ -150,7 +153,7 @@ ExceptionOr<RefPtr<JSC::ArrayBuffer>> DecompressionStreamDecoder::decompressZlib
                 allocateSize *= 2;
         }
 
-        storage.append(output);
+        storage.append(WTFMove(output));
     }
 
     auto decompressedData = storage.takeAsArrayBuffer();
@@ -222,7 +225,7 @@ ExceptionOr<RefPtr<JSC::ArrayBuffer>> DecompressionStreamDecoder::decompressAppl
                 allocateSize *= 2;
         }
 
-        storage.append(output);
+        storage.append(WTFMove(output));
     }
 
     auto decompressedData = storage.takeAsArrayBuffer();
@@ -382,6 +382,15 @@ void FetchBodyConsumer::resolve(Ref<DeferredPromise>&& promise, const String& co
 void FetchBodyConsumer::append(const SharedBuffer& buffer)
 {
     if (m_source) {
+        // This copy is deliberate. The chunk handed to the stream is a mutable
+        // ArrayBuffer, while SharedBuffer contents are immutable and may be
+        // referenced elsewhere (the memory cache, other consumers of the same
+        // load), so wrapping the segment bytes via ArrayBuffer::createFromBytes
+        // would let script mutate shared data. Zero-copy enqueue needs chunks
+        // whose backing store is provably uniquely owned by this consumer.
+        // FIXME: Chunks are pushed here as the network delivers them; nothing
+        // defers the load when the stream stops pulling, so a slow reader
+        // accumulates the response in the stream queue.
         m_source->enqueue(buffer.tryCreateArrayBuffer());
         return;
     }
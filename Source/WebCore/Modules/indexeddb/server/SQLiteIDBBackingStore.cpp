@@ -1929,6 +1929,13 @@ IDBError SQLiteIDBBackingStore::updateAllIndexesForAddRecord(const IDBObjectStor
     return error;
 }
 
+// All records written under one IDB transaction already share a single SQLite
+// transaction (SQLiteIDBTransaction owns it) and every statement here is prepared
+// once and cached, so bulk-load throughput is bounded by the per-record IPC
+// round trip and the existence probe in UniqueIDBDatabase::performPutOrAdd rather
+// than by statement execution. FIXME: If a batched put API reaches the web-facing
+// front end, thread the whole batch down to this layer so the probe, the Records
+// insert and the index maintenance can each run as one multi-row pass.
 IDBError SQLiteIDBBackingStore::addRecord(const IDBResourceIdentifier& transactionIdentifier, const IDBObjectStoreInfo& objectStoreInfo, const IDBKeyData& keyData, const IndexIDToIndexKeyMap& indexKeys, const IDBValue& value)
 {
     LOG(IndexedDB, "SQLiteIDBBackingStore::addRecord - key %s, object store %" PRIu64, keyData.loggingString().utf8().data(), objectStoreInfo.identifier());
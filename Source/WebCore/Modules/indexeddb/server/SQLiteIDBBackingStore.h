@@ -83,6 +83,12 @@ public:
     IDBObjectStoreInfo* infoForObjectStore(uint64_t objectStoreIdentifier) final;
     void deleteBackingStore() final;
 
+    // All transactions share one SQLite connection, so only one can have a SQLite
+    // transaction open at a time even though the database files are in WAL mode and
+    // the scheduler in UniqueIDBDatabase can interleave non-overlapping transactions.
+    // FIXME: Route read-only transactions to a pool of read-only WAL connections
+    // (each with its own statement cache and IDBKEY collation) so reads no longer
+    // queue behind a long-running writer.
     bool supportsSimultaneousTransactions() final { return false; }
     bool isEphemeral() final { return false; }
     String fullDatabasePath() const final;
@@ -345,7 +345,9 @@ bool SQLiteIDBCursor::prefetchOneRecord()
 
 void SQLiteIDBCursor::increaseCountToPrefetch()
 {
-    m_prefetchCount = m_prefetchCount ? m_prefetchCount * 2 : 1;
+    // Records beyond prefetchLimit are never fetched, so there is no point letting
+    // the count grow (and eventually wrap) past it on very long scans.
+    m_prefetchCount = m_prefetchCount ? std::min<size_t>(m_prefetchCount * 2, prefetchLimit) : 1;
 }
 
 bool SQLiteIDBCursor::prefetch()
@@ -478,6 +478,15 @@ void SourceBuffer::scheduleEvent(const AtomString& eventName)
     queueTaskToDispatchEvent(*this, TaskSource::MediaElement, Event::create(eventName, Event::CanBubble::No, Event::IsCancelable::No));
 }
 
+// The copy into m_pendingAppendData below cannot become a zero-copy detach of
+// the caller's ArrayBuffer: appendBuffer does not detach per spec, so scripts
+// may legitimately mutate or reuse the buffer the moment this returns, and we
+// must snapshot the bytes first. The demux itself is not done here either way —
+// the SharedBuffer is handed to the platform SourceBufferPrivate, whose parsers
+// run on their own streaming threads (e.g. the GStreamer append pipeline); what
+// this class contributes to the main thread is the copy plus the spec-mandated
+// buffer-full bookkeeping, which is proportional to the append size, not to
+// the demux cost.
 ExceptionOr<void> SourceBuffer::appendBufferInternal(const unsigned char* data, unsigned size)
 {
     // Section 3.2 appendBuffer()
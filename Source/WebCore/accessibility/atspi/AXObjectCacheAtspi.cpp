@@ -42,6 +42,15 @@ void AXObjectCache::attachWrapper(AccessibilityObject* axObject)
     m_performCacheUpdateTimer.startOneShot(0_s);
 }
 
+// FIXME: Unlike Cocoa with ENABLE(ACCESSIBILITY_ISOLATED_TREE), ATSPI wrappers
+// answer assistive-technology queries against the live AccessibilityObject
+// graph, so a screen reader's property storm reaches the main thread and can
+// force layout. Adopting the isolated tree here means making AXIsolatedObject
+// carry every property the ATSPI interfaces serve (component, text, value,
+// table, collection), generating it from this deferred-update hook, and
+// pointing AccessibilityObjectAtspi at the isolated snapshot so D-Bus replies
+// never touch the live tree. Until then, churn-heavy pages pay main-thread
+// AX cost whenever an AT is connected.
 void AXObjectCache::platformPerformDeferredCacheUpdate()
 {
     auto handleParentChanged = [&](const AXCoreObject& axObject) {
@@ -125,6 +125,20 @@ void DocumentTimelinesController::updateAnimationsAndSendEvents(ReducedResolutio
                 continue;
             }
 
+            // An animation that is neither pending, running, nor expecting events cannot produce
+            // new effect output this frame: its current time is held and any timing or keyframe
+            // mutation invalidates its effect directly. Skip sampling it, but still perform the
+            // removal and completed-transition bookkeeping the tick would have fed.
+            if (!animation->needsTick()) {
+                if (!animation->isRelevant())
+                    animationsToRemove.append(animation);
+                if (auto* transition = dynamicDowncast<CSSTransition>(animation.get())) {
+                    if (transition->playState() == WebAnimation::PlayState::Finished && transition->owningElement())
+                        completedTransitions.append(*transition);
+                }
+                continue;
+            }
+
             // Even though this animation is relevant, its frame rate may be such that it should
             // be disregarded during this update. If it does not specify an explicit frame rate,
             // this means this animation uses the default frame rate at which we typically schedule
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "CachedScriptSourceProvider.h"
+
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <wtf/CheckedArithmetic.h>
+#include <wtf/FileSystem.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Scope.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace WebCore {
+
+static String& bytecodeDiskCachePath()
+{
+    static NeverDestroyed<String> path;
+    return path;
+}
+
+void CachedScriptSourceProvider::setBytecodeDiskCachePath(const String& path)
+{
+    ASSERT(isMainThread());
+    bytecodeDiskCachePath() = path;
+}
+
+bool CachedScriptSourceProvider::bytecodeDiskCacheEnabled() const
+{
+    return isMainThread() && !bytecodeDiskCachePath().isEmpty();
+}
+
+String CachedScriptSourceProvider::bytecodeCachePath() const
+{
+    if (!bytecodeDiskCacheEnabled())
+        return { };
+    // The file name is the script's content hash, so a redeployed resource misses
+    // cleanly and identical content hits regardless of URL.
+    return FileSystem::pathByAppendingComponent(bytecodeDiskCachePath(), makeString(m_cachedScript->scriptHash(), ".bytecode-cache"_s));
+}
+
+RefPtr<JSC::CachedBytecode> CachedScriptSourceProvider::cachedBytecode() const
+{
+    if (!m_cachedBytecode)
+        loadBytecode();
+    return m_cachedBytecode.copyRef();
+}
+
+void CachedScriptSourceProvider::loadBytecode() const
+{
+    String filename = bytecodeCachePath();
+    if (filename.isNull())
+        return;
+
+    auto fd = FileSystem::openAndLockFile(filename, FileSystem::FileOpenMode::Read, { FileSystem::FileLockMode::Shared, FileSystem::FileLockMode::Nonblocking });
+    if (!FileSystem::isHandleValid(fd))
+        return;
+
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::unlockAndCloseFile(fd);
+    });
+
+    bool success;
+    FileSystem::MappedFileData mappedFileData(fd, FileSystem::MappedFileMode::Private, success);
+    if (!success)
+        return;
+
+    m_cachedBytecode = JSC::CachedBytecode::create(WTFMove(mappedFileData));
+}
+
+void CachedScriptSourceProvider::cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const
+{
+    if (!bytecodeDiskCacheEnabled())
+        return;
+    if (!m_cachedBytecode)
+        m_cachedBytecode = JSC::CachedBytecode::create();
+    if (auto update = generator())
+        m_cachedBytecode->addGlobalUpdate(*update);
+}
+
+void CachedScriptSourceProvider::updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!bytecodeDiskCacheEnabled() || !m_cachedBytecode)
+        return;
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (cachedBytecode && !error.isValid())
+        m_cachedBytecode->addFunctionUpdate(executable, kind, *cachedBytecode);
+}
+
+void CachedScriptSourceProvider::commitCachedBytecode() const
+{
+    if (!bytecodeDiskCacheEnabled() || !m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+
+    auto clearBytecode = makeScopeExit([&] {
+        m_cachedBytecode = nullptr;
+    });
+
+    String filename = bytecodeCachePath();
+    auto fd = FileSystem::openAndLockFile(filename, FileSystem::FileOpenMode::Write, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking });
+    if (!FileSystem::isHandleValid(fd))
+        return;
+
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::unlockAndCloseFile(fd);
+    });
+
+    auto fileSize = FileSystem::fileSize(fd);
+    if (!fileSize)
+        return;
+
+    size_t cacheFileSize;
+    if (!WTF::convertSafely(*fileSize, cacheFileSize) || cacheFileSize != m_cachedBytecode->size()) {
+        // Another page already updated the cache file behind us.
+        return;
+    }
+
+    if (!FileSystem::truncateFile(fd, m_cachedBytecode->sizeForUpdate()))
+        return;
+
+    m_cachedBytecode->commitUpdates([&] (off_t offset, const void* data, size_t size) {
+        long long result = FileSystem::seekFile(fd, offset, FileSystem::FileSeekOrigin::Beginning);
+        ASSERT_UNUSED(result, result != -1);
+        size_t bytesWritten = static_cast<size_t>(FileSystem::writeToFile(fd, data, size));
+        ASSERT_UNUSED(bytesWritten, bytesWritten == size);
+    });
+}
+
+} // namespace WebCore
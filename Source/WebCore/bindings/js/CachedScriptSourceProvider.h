@@ -40,12 +40,22 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+        commitCachedBytecode();
         m_cachedScript->removeClient(*this);
     }
 
     unsigned hash() const override { return m_cachedScript->scriptHash(); }
     StringView source() const override { return m_cachedScript->script(); }
 
+    // Scripts whose bytecode should persist across navigations are cached on disk in
+    // this directory, keyed by content hash. Null (the default) disables the cache.
+    WEBCORE_EXPORT static void setBytecodeDiskCachePath(const String&);
+
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const override;
+    void cacheBytecode(const JSC::BytecodeCacheGenerator&) const override;
+    void updateCache(const JSC::UnlinkedFunctionExecutable*, const JSC::SourceCode&, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*) const override;
+    void commitCachedBytecode() const override;
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), TextPosition(), sourceType)
@@ -54,7 +64,12 @@ private:
         m_cachedScript->addClient(*this);
     }
 
+    bool bytecodeDiskCacheEnabled() const;
+    String bytecodeCachePath() const;
+    void loadBytecode() const;
+
     CachedResourceHandle<CachedScript> m_cachedScript;
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
 };
 
 } // namespace WebCore
@@ -638,6 +638,15 @@ JSC::JSObject* JSDOMGlobalObject::moduleLoaderCreateImportMetaProperties(JSC::JS
     return constructEmptyObject(globalObject->vm(), globalObject->nullPrototypeObjectStructure());
 }
 
+// This is already the lightweight same-VM alternative to a sandbox iframe: a
+// ShadowRealm gets a bare JSShadowRealmGlobalScope (no Document, no Frame, no
+// DOM wrapper world of its own) whose cost is dominated by the fresh set of
+// ECMAScript intrinsics. Those intrinsics are the floor. A realm's prototypes
+// must be mutable by the code running inside it, so they cannot be shared
+// immutably across realms, and a global object cannot be pooled and reissued
+// without leaking the previous tenant's monkey-patches — which is exactly the
+// isolation a realm promises. What lazy intrinsic materialization can defer,
+// JSGlobalObject::init already defers.
 JSC::JSGlobalObject* JSDOMGlobalObject::deriveShadowRealmGlobalObject(JSC::JSGlobalObject* globalObject)
 {
     auto& vm = globalObject->vm();
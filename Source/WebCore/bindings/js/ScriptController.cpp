@@ -157,6 +157,11 @@ ValueOrException ScriptController::evaluateInWorld(const ScriptSourceCode& sourc
 
     InspectorInstrumentation::didEvaluateScript(m_frame);
 
+    // Persist any bytecode generated for this script so the next navigation can
+    // map it back in instead of re-parsing. This is a no-op unless the provider
+    // accumulated cache updates.
+    jsSourceCode.provider()->commitCachedBytecode();
+
     std::optional<ExceptionDetails> optionalDetails;
     if (evaluationException) {
         ExceptionDetails details;
@@ -169,6 +169,15 @@ private:
     size_t m_memoryCost { 0 };
 };
 
+// These coders only run when a value crosses a process boundary (MessagePorts
+// routed through the network process, session storage and the like). Worker and
+// same-process postMessage hand the SerializedScriptValue itself across threads by
+// reference, and transferred ArrayBuffer contents travel in
+// m_arrayBufferContentsArray without being copied, so large payloads that use
+// transferables are already written once. FIXME: For the cross-process case, bytes
+// above some threshold could ride in shared memory (IPC::SharedBufferReference
+// style) instead of being re-copied into the stream; both sides of each message
+// carrying a serialized value would need to agree on the dual encoding.
 template<class Encoder>
 void SerializedScriptValue::encode(Encoder& encoder) const
 {
@@ -191,6 +191,16 @@ static void addUniversalActionsToDFA(DFA& dfa, UniversalActionSet&& universalAct
     root.setActions(actionsStart, static_cast<uint16_t>(actionsLength));
 }
 
+// Compilation is serial by construction: processNFAs() carves NFAs out of one
+// shared prefix tree destructively, so NFA generation cannot be partitioned, and
+// maxNFASize below is tuned for one NFA-to-DFA conversion in flight at a time.
+// The stage that could overlap is the per-NFA convert/minimize/lower pipeline,
+// since DFA order in the output only matters for the first DFA (it carries the
+// universal actions); running conversions on a pool would multiply peak memory
+// by the number of workers and would need that tuning redone. Patching compiled
+// bytecode for a small rule delta is not possible at all: every DFA is a
+// minimized product of many combined rules, so there is no per-rule region to
+// splice.
 template<typename Functor>
 static bool compileToBytecode(CombinedURLFilters&& filters, UniversalActionSet&& universalActions, Functor writeBytecodeToClient)
 {
@@ -27,6 +27,7 @@
 #include "DFABytecodeInterpreter.h"
 
 #include "ContentExtensionsDebugging.h"
+#include <wtf/Vector.h>
 #include <wtf/text/CString.h>
 
 #if ENABLE(CONTENT_EXTENSIONS)
@@ -202,13 +203,12 @@ void DFABytecodeInterpreter::interpretTestFlagsAndAppendAction(uint32_t& program
     }
 }
 
-template<bool caseSensitive>
 inline void DFABytecodeInterpreter::interpetJumpTable(Span<const char> url, uint32_t& urlIndex, uint32_t& programCounter)
 {
     DFABytecodeJumpSize jumpSize = getJumpSize(m_bytecode, programCounter);
 
-    char c = urlIndex < url.size() ? url[urlIndex] : 0;
-    char character = caseSensitive ? c : toASCIILower(c);
+    // Case-insensitive jump tables are handled by passing the lowercased URL here.
+    char character = urlIndex < url.size() ? url[urlIndex] : 0;
     uint8_t firstCharacter = getBits<uint8_t>(m_bytecode, programCounter + sizeof(DFABytecodeInstruction));
     uint8_t lastCharacter = getBits<uint8_t>(m_bytecode, programCounter + sizeof(DFABytecodeInstruction) + sizeof(uint8_t));
     if (character >= firstCharacter && character <= lastCharacter) {
@@ -242,6 +242,12 @@ auto DFABytecodeInterpreter::actionsMatchingEverything() -> Actions
     return actions;
 }
 
+// FIXME: Large rule sets compile to many DFAs and each of them rescans the URL
+// from the start, so matching stays proportional to the number of DFAs. To skip
+// most of them per URL, the compiler would need to extract a required literal from
+// every rule and serialize a multi-substring prefilter alongside the bytecode;
+// that is a compiled-format change that has to go through the content extension
+// store version.
 auto DFABytecodeInterpreter::interpret(const String& urlString, ResourceFlags flags) -> Actions
 {
     CString urlCString;
@@ -253,7 +259,15 @@ auto DFABytecodeInterpreter::interpret(const String& urlString, ResourceFlags fl
         url = { urlCString.data(), urlCString.length() };
     }
     ASSERT(url.data());
-    
+
+    // Case-insensitive edges are the common case, and every DFA rescans the URL,
+    // so lowercase it once up front instead of per character per DFA.
+    Vector<char, 256> lowercasedURLBuffer;
+    lowercasedURLBuffer.reserveInitialCapacity(url.size());
+    for (auto character : url)
+        lowercasedURLBuffer.uncheckedAppend(toASCIILower(character));
+    Span<const char> lowercasedURL { lowercasedURLBuffer.data(), lowercasedURLBuffer.size() };
+
     Actions actions;
     
     uint32_t programCounter = 0;
@@ -315,7 +329,7 @@ auto DFABytecodeInterpreter::interpret(const String& urlString, ResourceFlags fl
                     goto nextDFA;
 
                 // Check to see if the next character in the url is the value stored with the bytecode.
-                char character = urlIndex < url.size() ? toASCIILower(url[urlIndex]) : 0;
+                char character = urlIndex < url.size() ? lowercasedURL[urlIndex] : 0;
                 DFABytecodeJumpSize jumpSize = getJumpSize(m_bytecode, programCounter);
                 if (character == getBits<uint8_t>(m_bytecode, programCounter + sizeof(DFABytecodeInstruction))) {
                     uint32_t jumpLocation = programCounter + sizeof(DFABytecodeInstruction) + sizeof(uint8_t);
@@ -330,13 +344,13 @@ auto DFABytecodeInterpreter::interpret(const String& urlString, ResourceFlags fl
                 if (urlIndex > url.size())
                     goto nextDFA;
 
-                interpetJumpTable<false>(url, urlIndex, programCounter);
+                interpetJumpTable(lowercasedURL, urlIndex, programCounter);
                 break;
             case DFABytecodeInstruction::JumpTableCaseSensitive:
                 if (urlIndex > url.size())
                     goto nextDFA;
 
-                interpetJumpTable<true>(url, urlIndex, programCounter);
+                interpetJumpTable(url, urlIndex, programCounter);
                 break;
                     
             case DFABytecodeInstruction::CheckValueRangeCaseSensitive: {
@@ -359,7 +373,7 @@ auto DFABytecodeInterpreter::interpret(const String& urlString, ResourceFlags fl
                 if (urlIndex > url.size())
                     goto nextDFA;
                 
-                char character = urlIndex < url.size() ? toASCIILower(url[urlIndex]) : 0;
+                char character = urlIndex < url.size() ? lowercasedURL[urlIndex] : 0;
                 DFABytecodeJumpSize jumpSize = getJumpSize(m_bytecode, programCounter);
                 if (character >= getBits<uint8_t>(m_bytecode, programCounter + sizeof(DFABytecodeInstruction))
                     && character <= getBits<uint8_t>(m_bytecode, programCounter + sizeof(DFABytecodeInstruction) + sizeof(uint8_t))) {
@@ -49,7 +49,6 @@ private:
     void interpretAppendAction(unsigned& programCounter, Actions&);
     void interpretTestFlagsAndAppendAction(unsigned& programCounter, ResourceFlags, Actions&);
 
-    template<bool caseSensitive>
     void interpetJumpTable(Span<const char> url, uint32_t& urlIndex, uint32_t& programCounter);
 
     const Span<const uint8_t> m_bytecode;
@@ -28,6 +28,7 @@
 
 #include "CSSKeyframeRule.h"
 #include "CSSParser.h"
+#include "CSSParserImpl.h"
 #include "CSSRuleList.h"
 #include "CSSStyleSheet.h"
 #include "Document.h"
@@ -41,6 +42,14 @@ StyleRuleKeyframes::StyleRuleKeyframes(const AtomString& name)
 {
 }
 
+StyleRuleKeyframes::StyleRuleKeyframes(const AtomString& name, String&& deferredBlockText, const CSSParserContext& context)
+    : StyleRuleBase(StyleRuleType::Keyframes)
+    , m_name(name)
+    , m_deferredBlockText(WTFMove(deferredBlockText))
+    , m_deferredParserContext(context)
+{
+}
+
 StyleRuleKeyframes::StyleRuleKeyframes(const StyleRuleKeyframes& o)
     : StyleRuleBase(o)
     , m_keyframes(o.keyframes())
@@ -53,15 +62,30 @@ Ref<StyleRuleKeyframes> StyleRuleKeyframes::create(const AtomString& name)
     return adoptRef(*new StyleRuleKeyframes(name));
 }
 
+Ref<StyleRuleKeyframes> StyleRuleKeyframes::createDeferred(const AtomString& name, String&& blockText, const CSSParserContext& context)
+{
+    return adoptRef(*new StyleRuleKeyframes(name, WTFMove(blockText), context));
+}
+
 StyleRuleKeyframes::~StyleRuleKeyframes() = default;
 
+void StyleRuleKeyframes::parseDeferredKeyframesIfNeeded() const
+{
+    ASSERT(m_keyframes.isEmpty());
+    auto context = *std::exchange(m_deferredParserContext, std::nullopt);
+    m_keyframes = CSSParserImpl::parseDeferredKeyframeList(std::exchange(m_deferredBlockText, String()), context);
+}
+
 const Vector<Ref<StyleRuleKeyframe>>& StyleRuleKeyframes::keyframes() const
 {
+    if (UNLIKELY(m_deferredParserContext))
+        parseDeferredKeyframesIfNeeded();
     return m_keyframes;
 }
 
 void StyleRuleKeyframes::parserAppendKeyframe(RefPtr<StyleRuleKeyframe>&& keyframe)
 {
+    ASSERT(!m_deferredParserContext);
     if (!keyframe)
         return;
     m_keyframes.append(keyframe.releaseNonNull());
@@ -69,11 +93,13 @@ void StyleRuleKeyframes::parserAppendKeyframe(RefPtr<StyleRuleKeyframe>&& keyfra
 
 void StyleRuleKeyframes::wrapperAppendKeyframe(Ref<StyleRuleKeyframe>&& keyframe)
 {
+    keyframes();
     m_keyframes.append(WTFMove(keyframe));
 }
 
 void StyleRuleKeyframes::wrapperRemoveKeyframe(unsigned index)
 {
+    keyframes();
     m_keyframes.remove(index);
 }
 
@@ -82,7 +108,7 @@ std::optional<size_t> StyleRuleKeyframes::findKeyframeIndex(const String& key) c
     auto keys = CSSParser::parseKeyframeKeyList(key);
     if (keys.isEmpty())
         return std::nullopt;
-    for (auto i = m_keyframes.size(); i--; ) {
+    for (auto i = keyframes().size(); i--; ) {
         if (m_keyframes[i]->keys() == keys)
             return i;
     }
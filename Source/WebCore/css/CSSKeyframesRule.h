@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "CSSParserContext.h"
 #include "CSSRule.h"
 #include "StyleRule.h"
 #include <memory>
@@ -40,8 +41,11 @@ class StyleRuleKeyframe;
 class StyleRuleKeyframes final : public StyleRuleBase {
 public:
     static Ref<StyleRuleKeyframes> create(const AtomString& name);
+    // The rule body is retained as text and only built into keyframe objects on first access,
+    // so sheets full of animations that never run don't pay for the object model.
+    static Ref<StyleRuleKeyframes> createDeferred(const AtomString& name, String&& blockText, const CSSParserContext&);
     ~StyleRuleKeyframes();
-    
+
     const Vector<Ref<StyleRuleKeyframe>>& keyframes() const;
 
     void parserAppendKeyframe(RefPtr<StyleRuleKeyframe>&&);
@@ -59,10 +63,15 @@ public:
 
 private:
     explicit StyleRuleKeyframes(const AtomString&);
+    StyleRuleKeyframes(const AtomString&, String&& deferredBlockText, const CSSParserContext&);
     StyleRuleKeyframes(const StyleRuleKeyframes&);
-    
+
+    void parseDeferredKeyframesIfNeeded() const;
+
     mutable Vector<Ref<StyleRuleKeyframe>> m_keyframes;
     AtomString m_name;
+    mutable String m_deferredBlockText;
+    mutable std::optional<CSSParserContext> m_deferredParserContext;
 };
 
 class CSSKeyframesRule final : public CSSRule {
@@ -191,10 +191,20 @@ CSSStyleSheet::WhetherContentsWereClonedForMutation CSSStyleSheet::willMutateRul
     return ContentsWereClonedForMutation;
 }
 
-void CSSStyleSheet::didMutateRuleFromCSSStyleDeclaration()
+void CSSStyleSheet::didMutateRuleFromCSSStyleDeclaration(StyleRule* mutatedStyleRule)
 {
     ASSERT(m_contents->isMutable());
     ASSERT(m_contents->hasOneClient());
+
+    // When the caller can tell the mutation was limited to the declaration block of a plain style
+    // rule, the style scopes can invalidate the matching elements without rebuilding the resolver.
+    if (mutatedStyleRule) {
+        forEachStyleScope([&](auto& scope) {
+            scope.didMutateRuleDeclarations(*mutatedStyleRule);
+        });
+        return;
+    }
+
     didMutate();
 }
 
@@ -47,6 +47,7 @@ class Document;
 class Element;
 class WeakPtrImplWithEventTargetData;
 class ShadowRoot;
+class StyleRule;
 class StyleRuleKeyframes;
 class StyleSheetContents;
 class TreeScope;
@@ -142,7 +143,7 @@ public:
 
     WhetherContentsWereClonedForMutation willMutateRules();
     void didMutateRules(RuleMutationType, WhetherContentsWereClonedForMutation, StyleRuleKeyframes* insertedKeyframesRule, const String& modifiedKeyframesRuleName);
-    void didMutateRuleFromCSSStyleDeclaration();
+    void didMutateRuleFromCSSStyleDeclaration(StyleRule* mutatedStyleRule);
     void didMutate();
     
     void clearChildRuleCSSOMWrappers();
@@ -24,6 +24,7 @@
 
 #include "CSSPropertyParser.h"
 #include "CSSRule.h"
+#include "CSSStyleRule.h"
 #include "CSSStyleSheet.h"
 #include "CustomElementReactionQueue.h"
 #include "DOMWindow.h"
@@ -403,7 +404,7 @@ bool StyleRuleCSSStyleDeclaration::willMutate()
 {
     if (!m_parentRule || !m_parentRule->parentStyleSheet())
         return false;
-    m_parentRule->parentStyleSheet()->willMutateRules();
+    m_contentsWereClonedForMutation = m_parentRule->parentStyleSheet()->willMutateRules() == CSSStyleSheet::ContentsWereClonedForMutation;
     return true;
 }
 
@@ -415,8 +416,15 @@ void StyleRuleCSSStyleDeclaration::didMutate(MutationType type)
     if (type == PropertyChanged)
         m_cssomValueWrappers.clear();
 
+    // Mutating a declaration block can't change the rule structure, so for plain style rules the
+    // mutated rule is passed along to allow invalidating just the elements it matches. Cloned
+    // contents mean the active resolver still references the pre-clone sheet and needs a rebuild.
+    StyleRule* mutatedStyleRule = nullptr;
+    if (type == PropertyChanged && !m_contentsWereClonedForMutation && m_parentRuleType == StyleRuleType::Style)
+        mutatedStyleRule = &downcast<CSSStyleRule>(*m_parentRule).styleRule();
+
     // Style sheet mutation needs to be signaled even if the change failed. willMutate*/didMutate* must pair.
-    m_parentRule->parentStyleSheet()->didMutateRuleFromCSSStyleDeclaration();
+    m_parentRule->parentStyleSheet()->didMutateRuleFromCSSStyleDeclaration(mutatedStyleRule);
 }
 
 CSSStyleSheet* StyleRuleCSSStyleDeclaration::parentStyleSheet() const
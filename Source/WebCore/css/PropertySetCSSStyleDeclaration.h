@@ -120,6 +120,7 @@ private:
 
     unsigned m_refCount;
     StyleRuleType m_parentRuleType;
+    bool m_contentsWereClonedForMutation { false };
     CSSRule* m_parentRule;
 };
 
@@ -109,6 +109,24 @@ void SelectorFilter::pushParent(Element* parent)
     size_t count = parentFrame.identifierHashes.size();
     for (size_t i = 0; i < count; ++i)
         m_ancestorIdentifierFilter.add(parentFrame.identifierHashes[i]);
+    m_ancestorIdentifierCount += count;
+    growFilterIfNeeded();
+}
+
+void SelectorFilter::growFilterIfNeeded()
+{
+    // Each key occupies up to two buckets. Past roughly 1/8 occupancy the false positive rate
+    // of the two-probe filter starts to climb quickly.
+    if (LIKELY(2 * m_ancestorIdentifierCount <= m_ancestorIdentifierFilter.bucketCount() / 8))
+        return;
+    unsigned blockCount = m_ancestorIdentifierFilter.blockCount();
+    if (blockCount >= maximumBloomFilterBlockCount)
+        return;
+    m_ancestorIdentifierFilter.resetWithBlockCount(blockCount * 2);
+    for (auto& frame : m_parentStack) {
+        for (unsigned hash : frame.identifierHashes)
+            m_ancestorIdentifierFilter.add(hash);
+    }
 }
 
 void SelectorFilter::pushParentInitializingIfNeeded(Element& parent)
@@ -127,10 +145,15 @@ void SelectorFilter::popParent()
     size_t count = parentFrame.identifierHashes.size();
     for (size_t i = 0; i < count; ++i)
         m_ancestorIdentifierFilter.remove(parentFrame.identifierHashes[i]);
+    m_ancestorIdentifierCount -= count;
     m_parentStack.removeLast();
     if (m_parentStack.isEmpty()) {
         ASSERT(m_ancestorIdentifierFilter.likelyEmpty());
-        m_ancestorIdentifierFilter.clear();
+        ASSERT(!m_ancestorIdentifierCount);
+        if (m_ancestorIdentifierFilter.blockCount() != initialBloomFilterBlockCount)
+            m_ancestorIdentifierFilter.resetWithBlockCount(initialBloomFilterBlockCount);
+        else
+            m_ancestorIdentifierFilter.clear();
     }
 }
 
@@ -63,6 +63,7 @@ public:
 
 private:
     void initializeParentStack(Element& parent);
+    void growFilterIfNeeded();
     enum class IncludeRightmost : bool { Yes, No };
     static void collectSelectorHashes(CollectedSelectorHashes&, const CSSSelector& rightmostSelector, IncludeRightmost);
     static Hashes chooseSelectorHashesForFilter(const CollectedSelectorHashes&);
@@ -75,9 +76,14 @@ private:
     };
     Vector<ParentStackFrame> m_parentStack;
 
-    // With 100 unique strings in the filter, 2^12 slot table has false positive rate of ~0.2%.
-    static const unsigned bloomFilterKeyBits = 12;
-    CountingBloomFilter<bloomFilterKeyBits> m_ancestorIdentifierFilter;
+    // A block is one cache line of counters, so each lookup touches a single line. 64 blocks make a
+    // 4KB table; with 100 unique strings in the filter it has a false positive rate of ~0.2%.
+    static constexpr unsigned initialBloomFilterBlockCount = 64;
+    // Class-heavy pages can push thousands of identifiers into a deep ancestor chain. The filter
+    // grows with the identifier count so the false positive rate doesn't climb with tree depth.
+    static constexpr unsigned maximumBloomFilterBlockCount = 1024;
+    CountingBlockedBloomFilter m_ancestorIdentifierFilter { initialBloomFilterBlockCount };
+    unsigned m_ancestorIdentifierCount { 0 };
 };
 
 inline bool SelectorFilter::fastRejectSelector(const Hashes& hashes) const
@@ -47,6 +47,7 @@
 #include "StylePropertyShorthandFunctions.h"
 #include "StyleSheetContents.h"
 #include <bitset>
+#include <wtf/Hasher.h>
 #include <wtf/text/StringBuilder.h>
 
 #ifndef NDEBUG
@@ -1793,6 +1794,39 @@ bool StyleProperties::propertyMatches(CSSPropertyID propertyID, const CSSValue*
     return propertyAt(foundPropertyIndex).value()->equals(*propertyValue);
 }
 
+bool StyleProperties::contentsEqual(const StyleProperties& other) const
+{
+    if (propertyCount() != other.propertyCount())
+        return false;
+    if (cssParserMode() != other.cssParserMode())
+        return false;
+    for (unsigned i = 0; i < propertyCount(); ++i) {
+        auto property = propertyAt(i);
+        auto otherProperty = other.propertyAt(i);
+        if (property.id() != otherProperty.id() || property.isImportant() != otherProperty.isImportant())
+            return false;
+        if (!property.value() != !otherProperty.value())
+            return false;
+        if (property.value() && !property.value()->equals(*otherProperty.value()))
+            return false;
+    }
+    return true;
+}
+
+unsigned ImmutableStyleProperties::contentHash() const
+{
+    if (!m_contentHash) {
+        Hasher hasher;
+        WTF::add(hasher, cssParserMode(), propertyCount());
+        for (auto property : *this)
+            WTF::add(hasher, property.cssText());
+        unsigned hash = hasher.hash();
+        // Zero is reserved to mean the hash hasn't been computed yet.
+        m_contentHash = hash ? hash : 1;
+    }
+    return m_contentHash;
+}
+
 Ref<MutableStyleProperties> StyleProperties::mutableCopy() const
 {
     return adoptRef(*new MutableStyleProperties(*this));
@@ -155,6 +155,9 @@ public:
 
     bool propertyMatches(CSSPropertyID, const CSSValue*) const;
 
+    // Value equality, unlike the identity comparison RefPtr gives.
+    bool contentsEqual(const StyleProperties&) const;
+
     StyleProperties() = default;
 
 protected:
@@ -223,7 +226,13 @@ public:
 
     int findPropertyIndex(CSSPropertyID) const;
     int findCustomPropertyIndex(const String& propertyName) const;
-    
+
+    // Computed lazily and memoized; safe because immutable property sets never change.
+    unsigned contentHash() const;
+
+    mutable unsigned m_contentHash { 0 };
+    // The metadata and value arrays are allocated in place of and beyond m_storage, so it has to
+    // remain the last member.
     void* m_storage;
 
 private:
@@ -97,6 +97,7 @@ public:
 
     void parserAddNamespace(const AtomString& prefix, const AtomString& uri);
     void parserAppendRule(Ref<StyleRuleBase>&&);
+    void parserReserveChildRules(unsigned estimatedRuleCount) { m_childRules.reserveCapacity(estimatedRuleCount); }
     void parserSetEncodingFromCharsetRule(const String& encoding); 
     void parserSetUsesStyleBasedEditability() { m_usesStyleBasedEditability = true; }
 
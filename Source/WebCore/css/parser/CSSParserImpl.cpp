@@ -189,6 +189,9 @@ RefPtr<StyleRuleBase> CSSParserImpl::parseRule(const String& string, const CSSPa
 void CSSParserImpl::parseStyleSheet(const String& string, const CSSParserContext& context, StyleSheetContents& styleSheet)
 {
     CSSParserImpl parser(context, string, &styleSheet, nullptr);
+    // A top-level rule runs tens of tokens, so this estimate lets a large sheet build its
+    // child rule vector without repeated reallocation; shrinkToFit below trims the excess.
+    styleSheet.parserReserveChildRules(parser.tokenizer()->tokenCount() / 32);
     bool firstRuleValid = parser.consumeRuleList(parser.tokenizer()->tokenRange(), TopLevelRuleList, [&](RefPtr<StyleRuleBase> rule) {
         if (rule->isCharsetRule())
             return;
@@ -854,16 +857,33 @@ RefPtr<StyleRuleKeyframes> CSSParserImpl::consumeKeyframesRule(CSSParserTokenRan
         m_observerWrapper->observer().endRuleBody(m_observerWrapper->endOffset(block));
     }
 
-    RefPtr<StyleRuleKeyframes> keyframeRule = StyleRuleKeyframes::create(name);
-    consumeRuleList(block, KeyframesRuleList, [keyframeRule](const RefPtr<StyleRuleBase>& keyframe) {
-        keyframeRule->parserAppendKeyframe(downcast<const StyleRuleKeyframe>(keyframe.get()));
-    });
+    if (m_observerWrapper) {
+        // The inspector needs to observe the individual keyframes, so parse them eagerly.
+        RefPtr<StyleRuleKeyframes> keyframeRule = StyleRuleKeyframes::create(name);
+        consumeRuleList(block, KeyframesRuleList, [keyframeRule](const RefPtr<StyleRuleBase>& keyframe) {
+            keyframeRule->parserAppendKeyframe(downcast<const StyleRuleKeyframe>(keyframe.get()));
+        });
+        keyframeRule->shrinkToFit();
+        return keyframeRule;
+    }
 
     // FIXME-NEWPARSER: Find out why this is done. Behavior difference when prefixed?
     // keyframeRule->setVendorPrefixed(webkitPrefixed);
-    
-    keyframeRule->shrinkToFit();
-    return keyframeRule;
+
+    // Keep the rule body as text; it is parsed into keyframe objects when the animation is first used.
+    return StyleRuleKeyframes::createDeferred(name, block.serialize(), m_context);
+}
+
+Vector<Ref<StyleRuleKeyframe>> CSSParserImpl::parseDeferredKeyframeList(const String& string, const CSSParserContext& context)
+{
+    CSSParserImpl parser(context, string);
+    Vector<Ref<StyleRuleKeyframe>> keyframes;
+    parser.consumeRuleList(parser.tokenizer()->tokenRange(), KeyframesRuleList, [&keyframes](const RefPtr<StyleRuleBase>& keyframe) {
+        if (RefPtr<StyleRuleKeyframe> styleRuleKeyframe = downcast<StyleRuleKeyframe>(keyframe.get()))
+            keyframes.append(styleRuleKeyframe.releaseNonNull());
+    });
+    keyframes.shrinkToFit();
+    return keyframes;
 }
 
 RefPtr<StyleRulePage> CSSParserImpl::consumePageRule(CSSParserTokenRange prelude, CSSParserTokenRange block)
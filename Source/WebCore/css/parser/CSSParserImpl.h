@@ -99,6 +99,7 @@ public:
     static CSSSelectorList parsePageSelector(CSSParserTokenRange, StyleSheetContents*);
 
     static Vector<double> parseKeyframeKeyList(const String&);
+    static Vector<Ref<StyleRuleKeyframe>> parseDeferredKeyframeList(const String&, const CSSParserContext&);
 
     bool supportsDeclaration(CSSParserTokenRange&);
     const CSSParserContext& context() const { return m_context; }
@@ -36,6 +36,7 @@
 #include "Element.h"
 #include "ElementData.h"
 #include "ElementRareData.h"
+#include "ElementTraversal.h"
 #include "FunctionCall.h"
 #include "HTMLDocument.h"
 #include "HTMLNames.h"
@@ -68,7 +69,12 @@ extern "C" {
 
 static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationAddStyleRelationFunction, void, (SelectorChecker::CheckingContext*, const Element*));
 static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementIsActive, bool, (const Element*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementIsFirstOfType, bool, (const Element*));
 static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementIsHovered, bool, (const Element*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementIsLastOfType, bool, (const Element*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementIsOnlyOfType, bool, (const Element*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementMatchesNthOfType, bool, (const Element*, const CSSSelector*));
+static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationElementMatchesNthLastOfType, bool, (const Element*, const CSSSelector*));
 static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationIsPlaceholderShown, bool, (const Element*));
 static JSC_DECLARE_JIT_OPERATION_WITHOUT_WTF_INTERNAL(operationMakeContextStyleUniqueIfNecessaryAndTestIsPlaceholderShown, bool, (const Element*, SelectorChecker::CheckingContext*));
 #if CPU(ARM_THUMB2) && !CPU(APPLE_ARMV7S)
@@ -287,6 +293,8 @@ struct SelectorFragment {
     Vector<NthChildOfSelectorInfo> nthChildOfFilters;
     Vector<std::pair<int, int>, 2> nthLastChildFilters;
     Vector<NthChildOfSelectorInfo> nthLastChildOfFilters;
+    Vector<const CSSSelector*, 2> nthOfTypeFilters;
+    Vector<const CSSSelector*, 2> nthLastOfTypeFilters;
     SelectorList notFilters;
     Vector<SelectorList> matchesFilters;
     Vector<Vector<SelectorFragment>> anyFilters;
@@ -400,6 +408,11 @@ private:
     void generateElementIsNthChildOf(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementIsNthLastChild(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementIsNthLastChildOf(Assembler::JumpList& failureCases, const SelectorFragment&);
+    void generateElementIsFirstOfType(Assembler::JumpList& failureCases, const SelectorFragment&);
+    void generateElementIsLastOfType(Assembler::JumpList& failureCases, const SelectorFragment&);
+    void generateElementIsOnlyOfType(Assembler::JumpList& failureCases, const SelectorFragment&);
+    void generateElementIsNthOfType(Assembler::JumpList& failureCases, const SelectorFragment&);
+    void generateElementIsNthLastOfType(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementMatchesNotPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementMatchesAnyPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementMatchesMatchesPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment&);
@@ -1003,15 +1016,34 @@ static inline FunctionType addPseudoClassType(const CSSSelector& selector, Selec
         return FunctionType::CannotMatchAnything;
 
     // FIXME: Compile these pseudoclasses, too!
+    case CSSSelector::PseudoClassDrag:
+    case CSSSelector::PseudoClassHas:
+    case CSSSelector::PseudoClassRelativeScope:
+        return FunctionType::CannotCompile;
+
     case CSSSelector::PseudoClassFirstOfType:
     case CSSSelector::PseudoClassLastOfType:
     case CSSSelector::PseudoClassOnlyOfType:
+        fragment.pseudoClasses.add(type);
+        if (selectorContext == SelectorContext::QuerySelector)
+            return FunctionType::SimpleSelectorChecker;
+        return FunctionType::SelectorCheckerWithCheckingContext;
+
     case CSSSelector::PseudoClassNthOfType:
     case CSSSelector::PseudoClassNthLastOfType:
-    case CSSSelector::PseudoClassDrag:
-    case CSSSelector::PseudoClassHas:
-    case CSSSelector::PseudoClassRelativeScope:
-        return FunctionType::CannotCompile;
+        {
+            // The element count is always positive.
+            if (selector.nthA() <= 0 && selector.nthB() < 1)
+                return FunctionType::CannotMatchAnything;
+
+            if (type == CSSSelector::PseudoClassNthOfType)
+                fragment.nthOfTypeFilters.append(&selector);
+            else
+                fragment.nthLastOfTypeFilters.append(&selector);
+            if (selectorContext == SelectorContext::QuerySelector)
+                return FunctionType::SimpleSelectorChecker;
+            return FunctionType::SelectorCheckerWithCheckingContext;
+        }
 
     // Optimized pseudo selectors.
     case CSSSelector::PseudoClassAnyLink:
@@ -2967,6 +2999,16 @@ void SelectorCodeGenerator::generateElementMatching(Assembler::JumpList& matchin
         generateElementIsNthChild(matchingPostTagNameFailureCases, fragment);
     if (!fragment.nthLastChildFilters.isEmpty())
         generateElementIsNthLastChild(matchingPostTagNameFailureCases, fragment);
+    if (fragment.pseudoClasses.contains(CSSSelector::PseudoClassFirstOfType))
+        generateElementIsFirstOfType(matchingPostTagNameFailureCases, fragment);
+    if (fragment.pseudoClasses.contains(CSSSelector::PseudoClassLastOfType))
+        generateElementIsLastOfType(matchingPostTagNameFailureCases, fragment);
+    if (fragment.pseudoClasses.contains(CSSSelector::PseudoClassOnlyOfType))
+        generateElementIsOnlyOfType(matchingPostTagNameFailureCases, fragment);
+    if (!fragment.nthOfTypeFilters.isEmpty())
+        generateElementIsNthOfType(matchingPostTagNameFailureCases, fragment);
+    if (!fragment.nthLastOfTypeFilters.isEmpty())
+        generateElementIsNthLastOfType(matchingPostTagNameFailureCases, fragment);
     if (!fragment.notFilters.isEmpty())
         generateElementMatchesNotPseudoClass(matchingPostTagNameFailureCases, fragment);
     if (!fragment.anyFilters.isEmpty())
@@ -4163,6 +4205,135 @@ void SelectorCodeGenerator::generateElementIsNthLastChildOf(Assembler::JumpList&
     }
 }
 
+// The sibling walks below compare tag names through Element::hasTagName() to get the same
+// prefix-insensitive matching as the interpreted isFirstOfType()/isLastOfType().
+
+JSC_DEFINE_JIT_OPERATION(operationElementIsFirstOfType, bool, (const Element* element))
+{
+    const QualifiedName& type = element->tagQName();
+    for (const Element* sibling = ElementTraversal::previousSibling(*element); sibling; sibling = ElementTraversal::previousSibling(*sibling)) {
+        if (sibling->hasTagName(type))
+            return false;
+    }
+    return true;
+}
+
+JSC_DEFINE_JIT_OPERATION(operationElementIsLastOfType, bool, (const Element* element))
+{
+    const QualifiedName& type = element->tagQName();
+    for (const Element* sibling = ElementTraversal::nextSibling(*element); sibling; sibling = ElementTraversal::nextSibling(*sibling)) {
+        if (sibling->hasTagName(type))
+            return false;
+    }
+    return true;
+}
+
+JSC_DEFINE_JIT_OPERATION(operationElementIsOnlyOfType, bool, (const Element* element))
+{
+    const QualifiedName& type = element->tagQName();
+    for (const Element* sibling = ElementTraversal::previousSibling(*element); sibling; sibling = ElementTraversal::previousSibling(*sibling)) {
+        if (sibling->hasTagName(type))
+            return false;
+    }
+    for (const Element* sibling = ElementTraversal::nextSibling(*element); sibling; sibling = ElementTraversal::nextSibling(*sibling)) {
+        if (sibling->hasTagName(type))
+            return false;
+    }
+    return true;
+}
+
+JSC_DEFINE_JIT_OPERATION(operationElementMatchesNthOfType, bool, (const Element* element, const CSSSelector* selector))
+{
+    const QualifiedName& type = element->tagQName();
+    int count = 1;
+    for (const Element* sibling = ElementTraversal::previousSibling(*element); sibling; sibling = ElementTraversal::previousSibling(*sibling)) {
+        if (sibling->hasTagName(type))
+            ++count;
+    }
+    return selector->matchNth(count);
+}
+
+JSC_DEFINE_JIT_OPERATION(operationElementMatchesNthLastOfType, bool, (const Element* element, const CSSSelector* selector))
+{
+    const QualifiedName& type = element->tagQName();
+    int count = 1;
+    for (const Element* sibling = ElementTraversal::nextSibling(*element); sibling; sibling = ElementTraversal::nextSibling(*sibling)) {
+        if (sibling->hasTagName(type))
+            ++count;
+    }
+    return selector->matchNth(count);
+}
+
+void SelectorCodeGenerator::generateElementIsFirstOfType(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
+{
+    generateNthChildParentCheckAndRelationUpdate(failureCases, fragment);
+
+    FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+    functionCall.setFunctionAddress(operationElementIsFirstOfType);
+    functionCall.setOneArgument(elementAddressRegister);
+    failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+}
+
+void SelectorCodeGenerator::generateElementIsLastOfType(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
+{
+    generateNthLastChildParentCheckAndRelationUpdate(failureCases, fragment);
+
+    FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+    functionCall.setFunctionAddress(operationElementIsLastOfType);
+    functionCall.setOneArgument(elementAddressRegister);
+    failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+}
+
+void SelectorCodeGenerator::generateElementIsOnlyOfType(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
+{
+    // Only-of-type is a combination of first-of-type and last-of-type, so the tree marking
+    // combines the forward and backward positional updates, including the check that the
+    // parent finished parsing its children.
+    generateNthChildParentCheckAndRelationUpdate(failureCases, fragment);
+    generateNthLastChildParentCheckAndRelationUpdate(failureCases, fragment);
+
+    FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+    functionCall.setFunctionAddress(operationElementIsOnlyOfType);
+    functionCall.setOneArgument(elementAddressRegister);
+    failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+}
+
+void SelectorCodeGenerator::generateElementIsNthOfType(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
+{
+    generateNthChildParentCheckAndRelationUpdate(failureCases, fragment);
+
+    for (const CSSSelector* selector : fragment.nthOfTypeFilters) {
+        if (nthFilterIsAlwaysSatisified(selector->nthA(), selector->nthB()))
+            continue;
+
+        LocalRegisterWithPreference selectorRegister(m_registerAllocator, JSC::GPRInfo::argumentGPR1);
+        m_assembler.move(Assembler::TrustedImmPtr(selector), selectorRegister);
+
+        FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+        functionCall.setFunctionAddress(operationElementMatchesNthOfType);
+        functionCall.setTwoArguments(elementAddressRegister, selectorRegister);
+        failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+    }
+}
+
+void SelectorCodeGenerator::generateElementIsNthLastOfType(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
+{
+    generateNthLastChildParentCheckAndRelationUpdate(failureCases, fragment);
+
+    for (const CSSSelector* selector : fragment.nthLastOfTypeFilters) {
+        if (nthFilterIsAlwaysSatisified(selector->nthA(), selector->nthB()))
+            continue;
+
+        LocalRegisterWithPreference selectorRegister(m_registerAllocator, JSC::GPRInfo::argumentGPR1);
+        m_assembler.move(Assembler::TrustedImmPtr(selector), selectorRegister);
+
+        FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+        functionCall.setFunctionAddress(operationElementMatchesNthLastOfType);
+        functionCall.setTwoArguments(elementAddressRegister, selectorRegister);
+        failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+    }
+}
+
 void SelectorCodeGenerator::generateElementMatchesNotPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
 {
     Assembler::JumpList localFailureCases;
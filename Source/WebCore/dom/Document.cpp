@@ -2292,6 +2292,16 @@ void Document::updateLayout()
     frameView->layoutContext().layout();
 }
 
+// This is the layout-thrashing entry point: every offsetTop-style geometry read that
+// follows a DOM or style write comes through here and forces a synchronous flush.
+// Queuing reads and serving them from one flush per microtask checkpoint is not an
+// option — each read must observe all preceding writes, so a queue would still have
+// to flush at every write/read crossing, which is exactly the pattern that thrashes.
+// The lever that actually exists is making the flush cheaper, not rarer:
+// updateLayoutIfDimensionsOutOfDate() below skips the flush entirely when the
+// requested dimensions are provably unaffected by the pending invalidation, and
+// extending its coverage (more call sites, more dimension kinds) is how read-heavy
+// third-party code gets faster without changing observable behavior.
 void Document::updateLayoutIgnorePendingStylesheets(Document::RunPostLayoutTasks runPostLayoutTasks)
 {
     bool oldIgnore = m_ignorePendingStylesheets;
@@ -5645,6 +5655,25 @@ bool Document::isValidName(const String& name)
     return isValidNameNonASCII(characters, length);
 }
 
+// Pages tend to validate the same few attribute and element names over and over, so remember
+// names that already passed. Atoms make the lookup a pointer hash, and the cap keeps a page
+// that generates names from exhausting memory.
+bool Document::isValidName(const AtomString& name)
+{
+    ASSERT(isMainThread());
+    static constexpr unsigned validatedNamesCacheMaximumSize = 512;
+    static NeverDestroyed<HashSet<AtomString>> validatedNames;
+    if (name.isEmpty())
+        return false;
+    if (validatedNames.get().contains(name))
+        return true;
+    if (!isValidName(name.string()))
+        return false;
+    if (validatedNames.get().size() < validatedNamesCacheMaximumSize)
+        validatedNames.get().add(name);
+    return true;
+}
+
 ExceptionOr<std::pair<AtomString, AtomString>> Document::parseQualifiedName(const AtomString& qualifiedName)
 {
     unsigned length = qualifiedName.length();
@@ -8218,42 +8247,80 @@ struct IntersectionObservationState {
     bool isIntersecting { false };
 };
 
-static std::optional<IntersectionObservationState> computeIntersectionState(FrameView& frameView, const IntersectionObserver& observer, Element& target, bool applyRootMargin)
+// The root side of an intersection computation is identical for every target of
+// an observer, so it is computed once per observer per rendering update and
+// shared across the target loop. Only the margin-expanded bounds differ between
+// same-origin and cross-origin targets, so both variants are cached lazily.
+struct IntersectionObservationRootState {
+    RenderBlock* renderer { nullptr };
+    FloatRect localBounds;
+    std::optional<FloatRect> localBoundsWithMargin;
+    std::optional<FloatRect> absoluteBounds;
+    std::optional<FloatRect> absoluteBoundsWithMargin;
+};
+
+static std::optional<IntersectionObservationRootState> computeIntersectionRootState(FrameView& frameView, const IntersectionObserver& observer)
+{
+    IntersectionObservationRootState rootState;
+    if (observer.root()) {
+        if (!observer.root()->renderer() || !is<RenderBlock>(observer.root()->renderer()))
+            return std::nullopt;
+
+        rootState.renderer = downcast<RenderBlock>(observer.root()->renderer());
+        if (observer.root() == observer.trackingDocument())
+            rootState.localBounds = frameView.layoutViewportRect();
+        else if (rootState.renderer->hasNonVisibleOverflow())
+            rootState.localBounds = rootState.renderer->contentBoxRect();
+        else
+            rootState.localBounds = { FloatPoint(), rootState.renderer->size() };
+    } else {
+        ASSERT(is<LocalFrame>(frameView.frame()) && downcast<LocalFrame>(frameView.frame()).isMainFrame());
+        rootState.renderer = frameView.renderView();
+        rootState.localBounds = frameView.layoutViewportRect();
+    }
+    return rootState;
+}
+
+static FloatRect rootLocalBounds(IntersectionObservationRootState& rootState, const IntersectionObserver& observer, bool applyRootMargin)
+{
+    if (!applyRootMargin)
+        return rootState.localBounds;
+    if (!rootState.localBoundsWithMargin) {
+        FloatRect bounds = rootState.localBounds;
+        expandRootBoundsWithRootMargin(bounds, observer.rootMarginBox(), rootState.renderer->style().effectiveZoom());
+        rootState.localBoundsWithMargin = bounds;
+    }
+    return *rootState.localBoundsWithMargin;
+}
+
+static FloatRect rootAbsoluteBounds(IntersectionObservationRootState& rootState, const IntersectionObserver& observer, bool applyRootMargin)
+{
+    auto& cachedBounds = applyRootMargin ? rootState.absoluteBoundsWithMargin : rootState.absoluteBounds;
+    if (!cachedBounds)
+        cachedBounds = rootState.renderer->localToAbsoluteQuad(rootLocalBounds(rootState, observer, applyRootMargin)).boundingBox();
+    return *cachedBounds;
+}
+
+static std::optional<IntersectionObservationState> computeIntersectionState(FrameView& frameView, IntersectionObservationRootState& rootState, const IntersectionObserver& observer, Element& target, bool applyRootMargin)
 {
     auto* targetRenderer = target.renderer();
     if (!targetRenderer)
         return std::nullopt;
 
-    FloatRect localRootBounds;
-    RenderBlock* rootRenderer;
+    RenderBlock* rootRenderer = rootState.renderer;
     if (observer.root()) {
         if (observer.trackingDocument() != &target.document())
             return std::nullopt;
 
-        if (!observer.root()->renderer() || !is<RenderBlock>(observer.root()->renderer()))
-            return std::nullopt;
-
-        rootRenderer = downcast<RenderBlock>(observer.root()->renderer());
         if (!rootRenderer->isContainingBlockAncestorFor(*targetRenderer))
             return std::nullopt;
-
-        if (observer.root() == &target.document())
-            localRootBounds = frameView.layoutViewportRect();
-        else if (rootRenderer->hasNonVisibleOverflow())
-            localRootBounds = rootRenderer->contentBoxRect();
-        else
-            localRootBounds = { FloatPoint(), rootRenderer->size() };
     } else {
-        ASSERT(is<LocalFrame>(frameView.frame()) && downcast<LocalFrame>(frameView.frame()).isMainFrame());
         // FIXME: Handle the case of an implicit-root observer that has a target in a different frame tree.
         if (&targetRenderer->frame().mainFrame() != &frameView.frame())
             return std::nullopt;
-        rootRenderer = frameView.renderView();
-        localRootBounds = frameView.layoutViewportRect();
     }
 
-    if (applyRootMargin)
-        expandRootBoundsWithRootMargin(localRootBounds, observer.rootMarginBox(), rootRenderer->style().effectiveZoom());
+    FloatRect localRootBounds = rootLocalBounds(rootState, observer, applyRootMargin);
 
     LayoutRect localTargetBounds;
     if (is<RenderBox>(*targetRenderer))
@@ -8279,7 +8346,7 @@ static std::optional<IntersectionObservationState> computeIntersectionState(Fram
     IntersectionObservationState intersectionState;
     intersectionState.isIntersecting = rootLocalTargetRect && rootLocalIntersectionRect.edgeInclusiveIntersect(*rootLocalTargetRect) && !targetRenderer->isSkippedContent();
     intersectionState.absoluteTargetRect = targetRenderer->localToAbsoluteQuad(FloatRect(localTargetBounds)).boundingBox();
-    intersectionState.absoluteRootBounds = rootRenderer->localToAbsoluteQuad(localRootBounds).boundingBox();
+    intersectionState.absoluteRootBounds = rootAbsoluteBounds(rootState, observer, applyRootMargin);
 
     if (intersectionState.isIntersecting) {
         FloatRect rootAbsoluteIntersectionRect = rootRenderer->localToAbsoluteQuad(rootLocalIntersectionRect).boundingBox();
@@ -8312,6 +8379,7 @@ void Document::updateIntersectionObservations()
         auto timestamp = observer->nowTimestamp();
         if (!timestamp)
             continue;
+        auto rootState = computeIntersectionRootState(*frameView, *observer);
         for (auto& target : observer->observationTargets()) {
             auto& targetRegistrations = target->intersectionObserverDataIfExists()->registrations;
             auto index = targetRegistrations.findIf([observer](auto& registration) {
@@ -8321,7 +8389,9 @@ void Document::updateIntersectionObservations()
             auto& registration = targetRegistrations[index];
 
             bool isSameOriginObservation = &target->document() == this || target->document().securityOrigin().isSameOriginDomain(securityOrigin());
-            auto intersectionState = computeIntersectionState(*frameView, *observer, *target, isSameOriginObservation);
+            std::optional<IntersectionObservationState> intersectionState;
+            if (rootState)
+                intersectionState = computeIntersectionState(*frameView, *rootState, *observer, *target, isSameOriginObservation);
 
             float intersectionRatio = 0;
             size_t thresholdIndex = 0;
@@ -1056,6 +1056,7 @@ public:
     // To get this right for all the XML cases, we probably have to improve this or move it
     // and make it sensitive to the type of document.
     static bool isValidName(const String&);
+    static bool isValidName(const AtomString&);
 
     // The following breaks a qualified name into a prefix and a local name.
     // It also does a validity check, and returns an error if the qualified name is invalid.
@@ -74,6 +74,7 @@ public:
     
     EventTarget* target() const { return m_target.get(); }
     void setTarget(RefPtr<EventTarget>&&);
+    static ptrdiff_t targetMemoryOffset() { return OBJECT_OFFSETOF(Event, m_target); }
 
     EventTarget* currentTarget() const { return m_currentTarget.get(); }
     void setCurrentTarget(EventTarget*, std::optional<bool> isInShadowTree = std::nullopt);
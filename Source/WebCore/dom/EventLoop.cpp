@@ -26,11 +26,48 @@
 #include "config.h"
 #include "EventLoop.h"
 
+#include "Logging.h"
 #include "Microtasks.h"
 #include "ScriptExecutionContext.h"
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
 
+// Tasks running at least this long get attributed to their task source in the
+// EventLoop log channel, to make it possible to tell which source is backing up
+// the queue when input latency regresses.
+static constexpr Seconds longRunningTaskDuration { 50_ms };
+
+static ASCIILiteral taskSourceName(TaskSource source)
+{
+    switch (source) {
+    case TaskSource::DOMManipulation: return "DOMManipulation"_s;
+    case TaskSource::DatabaseAccess: return "DatabaseAccess"_s;
+    case TaskSource::FileReading: return "FileReading"_s;
+    case TaskSource::FontLoading: return "FontLoading"_s;
+    case TaskSource::Gamepad: return "Gamepad"_s;
+    case TaskSource::Geolocation: return "Geolocation"_s;
+    case TaskSource::IdleTask: return "IdleTask"_s;
+    case TaskSource::IndexedDB: return "IndexedDB"_s;
+    case TaskSource::MediaElement: return "MediaElement"_s;
+    case TaskSource::Microtask: return "Microtask"_s;
+    case TaskSource::Networking: return "Networking"_s;
+    case TaskSource::PerformanceTimeline: return "PerformanceTimeline"_s;
+    case TaskSource::Permission: return "Permission"_s;
+    case TaskSource::PostedMessageQueue: return "PostedMessageQueue"_s;
+    case TaskSource::Reporting: return "Reporting"_s;
+    case TaskSource::ScreenWakelock: return "ScreenWakelock"_s;
+    case TaskSource::Speech: return "Speech"_s;
+    case TaskSource::UserInteraction: return "UserInteraction"_s;
+    case TaskSource::WebGL: return "WebGL"_s;
+    case TaskSource::WebXR: return "WebXR"_s;
+    case TaskSource::WebSocket: return "WebSocket"_s;
+    case TaskSource::InternalAsyncTask: return "InternalAsyncTask"_s;
+    }
+    ASSERT_NOT_REACHED();
+    return ""_s;
+}
+
 void EventLoop::queueTask(std::unique_ptr<EventLoopTask>&& task)
 {
     ASSERT(task->taskSource() != TaskSource::Microtask);
@@ -121,9 +158,13 @@ void EventLoop::run()
                 continue;
             }
 
+            auto taskStartTime = MonotonicTime::now();
             task->execute();
             didPerformMicrotaskCheckpoint = true;
             microtaskQueue().performMicrotaskCheckpoint();
+            auto taskDuration = MonotonicTime::now() - taskStartTime;
+            if (UNLIKELY(taskDuration >= longRunningTaskDuration))
+                RELEASE_LOG(EventLoop, "EventLoop::run: task from source %" PUBLIC_LOG_STRING " took %.1f ms (including microtasks), %zu tasks queued during this turn", taskSourceName(task->taskSource()).characters(), taskDuration.milliseconds(), m_tasks.size());
         }
         for (auto& task : m_tasks)
             remainingTasks.append(WTFMove(task));
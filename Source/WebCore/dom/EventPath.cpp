@@ -107,6 +107,15 @@ void EventPath::buildPath(Node& originalTarget, Event& event)
 
     RefPtr node = nodeOrHostIfPseudoElement(&originalTarget);
     RefPtr target = node ? eventTargetRespectingTargetRules(*node) : nullptr;
+
+    // Reserve one slot per ancestor up front so that deep trees build the path with a single
+    // allocation instead of geometric growth. Slot reassignment can make the path longer than
+    // this estimate; that only costs an ordinary grow.
+    size_t contextCountEstimate = 1;
+    for (auto* ancestor = node.get(); ancestor; ancestor = ancestor->parentOrShadowHostNode())
+        contextCountEstimate++;
+    m_path.reserveInitialCapacity(contextCountEstimate);
+
     int closedShadowDepth = 0;
     // Depths are used to decided which nodes are excluded in event.composedPath when the tree is mutated during event dispatching.
     // They could be negative for nodes outside the shadow tree of the target node.
@@ -107,6 +107,10 @@ ExceptionOr<void> MutationObserver::observe(Node& node, const Init& init)
     if (!validateOptions(options))
         return Exception { TypeError };
 
+    // Coalesced delivery is per observer, not per registration, so opting in once sticks.
+    if (init.coalesceRecords)
+        m_shouldCoalesceRecords = true;
+
     node.registerMutationObserver(*this, options, attributeFilter);
 
     return { };
@@ -147,7 +151,8 @@ void MutationObserver::enqueueMutationRecord(Ref<MutationRecord>&& mutation)
     Ref document = mutation->target()->document();
 
     m_pendingTargets.add(*mutation->target());
-    m_records.append(WTFMove(mutation));
+    if (!m_shouldCoalesceRecords || m_records.isEmpty() || !m_records.last()->tryCoalesce(mutation.get()))
+        m_records.append(WTFMove(mutation));
 
     Ref eventLoop = document->windowEventLoop();
     eventLoop->activeMutationObservers().add(this);
@@ -87,6 +87,7 @@ public:
         std::optional<bool> attributeOldValue;
         std::optional<bool> characterDataOldValue;
         std::optional<Vector<AtomString>> attributeFilter;
+        bool coalesceRecords;
     };
 
     ExceptionOr<void> observe(Node&, const Init&);
@@ -128,6 +129,7 @@ private:
     HashSet<GCReachableRef<Node>> m_pendingTargets;
     WeakHashSet<MutationObserverRegistration> m_registrations;
     unsigned m_priority;
+    bool m_shouldCoalesceRecords { false };
 };
 
 } // namespace WebCore
@@ -69,6 +69,30 @@ private:
     Node* previousSibling() override { return m_previousSibling.get(); }
     Node* nextSibling() override { return m_nextSibling.get(); }
 
+    bool tryCoalesce(MutationRecord& next) override
+    {
+        // Merge a pure insertion that continues an insertion run on the same parent,
+        // e.g. the parser or innerHTML appending children one by one.
+        if (next.type() != type() || next.target() != target())
+            return false;
+        if (auto* nextRemoved = next.removedNodes(); nextRemoved && nextRemoved->length())
+            return false;
+        auto* nextAdded = next.addedNodes();
+        if (!nextAdded || !nextAdded->length())
+            return false;
+        if (!m_addedNodes || !m_addedNodes->length())
+            return false;
+        if (next.previousSibling() != m_addedNodes->item(m_addedNodes->length() - 1))
+            return false;
+
+        ASSERT(!m_addedNodes->isLiveNodeList());
+        auto& addedNodes = static_cast<StaticNodeList&>(*m_addedNodes);
+        for (unsigned i = 0; i < nextAdded->length(); ++i)
+            addedNodes.append(*nextAdded->item(i));
+        m_nextSibling = next.nextSibling();
+        return true;
+    }
+
     void visitNodesConcurrently(JSC::AbstractSlotVisitor& visitor) const final
     {
         addWebCoreOpaqueRoot(visitor, m_target.get());
@@ -131,6 +155,14 @@ private:
     const AtomString& attributeName() override { return m_attributeName; }
     const AtomString& attributeNamespace() override { return m_attributeNamespace; }
 
+    bool tryCoalesce(MutationRecord& next) override
+    {
+        // A later change to the same attribute is subsumed: this record keeps the oldest
+        // oldValue and the callback reads the final value off the element.
+        return next.type() == type() && next.target() == target()
+            && next.attributeName() == m_attributeName && next.attributeNamespace() == m_attributeNamespace;
+    }
+
     AtomString m_attributeName;
     AtomString m_attributeNamespace;
 };
@@ -144,6 +176,11 @@ public:
 
 private:
     const AtomString& type() override;
+
+    bool tryCoalesce(MutationRecord& next) override
+    {
+        return next.type() == type() && next.target() == target();
+    }
 };
 
 class MutationRecordWithNullOldValue final : public MutationRecord {
@@ -165,6 +202,8 @@ private:
 
     String oldValue() override { return String(); }
 
+    bool tryCoalesce(MutationRecord& next) override { return m_record->tryCoalesce(next); }
+
     void visitNodesConcurrently(JSC::AbstractSlotVisitor& visitor) const final
     {
         m_record->visitNodesConcurrently(visitor);
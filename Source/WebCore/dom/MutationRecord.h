@@ -73,6 +73,11 @@ public:
 
     virtual String oldValue() { return String(); }
 
+    // Attempts to absorb the immediately following record so the pair can be delivered as one.
+    // Only valid for records that have not yet been exposed to script; used by observers that
+    // opted into coalesced delivery.
+    virtual bool tryCoalesce(MutationRecord&) { return false; }
+
     virtual void visitNodesConcurrently(JSC::AbstractSlotVisitor&) const = 0;
 };
 
@@ -29,6 +29,7 @@
 
 #include "CSSParser.h"
 #include "CommonAtomStrings.h"
+#include "Document.h"
 #include "ElementIterator.h"
 #include "HTMLNames.h"
 #include "SelectorChecker.h"
@@ -76,7 +77,35 @@ static IdMatchingType findIdMatchingType(const CSSSelector& firstSelector)
     return IdMatchingType::None;
 }
 
+// Document::domTreeVersion() ticks for child list, attribute and character data changes, but not
+// for dynamic state like :hover, :checked or :valid. Only selectors built entirely from tag,
+// id, class and attribute matches may reuse results keyed on that counter.
+static bool canCacheMatchedElements(const CSSSelectorList& selectorList)
+{
+    for (const CSSSelector* complexSelector = selectorList.first(); complexSelector; complexSelector = CSSSelectorList::next(complexSelector)) {
+        for (const CSSSelector* selector = complexSelector; selector; selector = selector->tagHistory()) {
+            switch (selector->match()) {
+            case CSSSelector::Tag:
+            case CSSSelector::Id:
+            case CSSSelector::Class:
+            case CSSSelector::Exact:
+            case CSSSelector::Set:
+            case CSSSelector::List:
+            case CSSSelector::Hyphen:
+            case CSSSelector::Contain:
+            case CSSSelector::Begin:
+            case CSSSelector::End:
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 SelectorDataList::SelectorDataList(const CSSSelectorList& selectorList)
+    : m_queryAllResultsAreCacheable(canCacheMatchedElements(selectorList))
 {
     unsigned selectorCount = 0;
     for (const CSSSelector* selector = selectorList.first(); selector; selector = CSSSelectorList::next(selector))
@@ -166,8 +195,34 @@ struct AllElementExtractorSelectorQueryTrait {
 
 Ref<NodeList> SelectorDataList::queryAll(ContainerNode& rootNode) const
 {
+    uint64_t domTreeVersion = rootNode.document().domTreeVersion();
+    if (m_queryAllResultsAreCacheable && m_cachedQueryAllScope.get() == &rootNode && m_cachedQueryAllDOMTreeVersion == domTreeVersion) {
+        // Any removal that could have destroyed a matched element also bumps the tree version,
+        // so the weak pointers should all be alive; recompute if that ever fails to hold.
+        Vector<Ref<Element>> cachedResult;
+        cachedResult.reserveInitialCapacity(m_cachedQueryAllResults.size());
+        bool allElementsAlive = true;
+        for (auto& element : m_cachedQueryAllResults) {
+            if (UNLIKELY(!element)) {
+                allElementsAlive = false;
+                break;
+            }
+            cachedResult.uncheckedAppend(*element);
+        }
+        if (LIKELY(allElementsAlive))
+            return StaticElementList::create(WTFMove(cachedResult));
+    }
+
     Vector<Ref<Element>> result;
     execute<AllElementExtractorSelectorQueryTrait>(rootNode, result);
+
+    if (m_queryAllResultsAreCacheable) {
+        m_cachedQueryAllScope = rootNode;
+        m_cachedQueryAllDOMTreeVersion = domTreeVersion;
+        m_cachedQueryAllResults = WTF::map(result, [](auto& element) -> WeakPtr<Element, WeakPtrImplWithEventTargetData> {
+            return element.get();
+        });
+    }
     return StaticElementList::create(WTFMove(result));
 }
 
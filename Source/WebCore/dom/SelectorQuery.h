@@ -31,6 +31,7 @@
 #include "SelectorCompiler.h"
 #include <wtf/HashMap.h>
 #include <wtf/Vector.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/text/AtomStringHash.h>
 
 namespace WebCore {
@@ -39,6 +40,7 @@ class CSSSelector;
 class ContainerNode;
 class Document;
 class Element;
+class WeakPtrImplWithEventTargetData;
 
 class SelectorDataList {
 public:
@@ -73,6 +75,12 @@ private:
 #endif // ENABLE(CSS_SELECTOR_JIT)
 
     Vector<SelectorData> m_selectors;
+    // queryAll results can be reused while Document::domTreeVersion() stands still, but only
+    // for selectors whose outcome is fully determined by tree structure, attributes and text.
+    bool m_queryAllResultsAreCacheable { false };
+    mutable WeakPtr<const ContainerNode, WeakPtrImplWithEventTargetData> m_cachedQueryAllScope;
+    mutable uint64_t m_cachedQueryAllDOMTreeVersion { 0 };
+    mutable Vector<WeakPtr<Element, WeakPtrImplWithEventTargetData>> m_cachedQueryAllResults;
     mutable enum MatchType {
         CompilableSingle,
         CompilableSingleWithRootFilter,
@@ -45,6 +45,8 @@ public:
     unsigned length() const override;
     Node* item(unsigned index) const override;
 
+    void append(Ref<Node>&& node) { m_nodes.append(WTFMove(node)); }
+
 private:
     StaticNodeList(Vector<Ref<Node>>&& nodes)
         : m_nodes(WTFMove(nodes))
@@ -148,8 +148,13 @@ const Vector<Element*>* TreeScope::getAllElementsById(const AtomString& elementI
 
 void TreeScope::addElementById(const AtomStringImpl& elementId, Element& element, bool notifyObservers)
 {
-    if (!m_elementsById)
+    if (!m_elementsById) {
         m_elementsById = makeUnique<TreeScopeOrderedMap>();
+        // A document that registers one id during parsing usually registers many more;
+        // starting from a larger table avoids rehashing several times while the tree is built.
+        if (documentScope().parsing())
+            m_elementsById->reserveInitialCapacity(64);
+    }
     m_elementsById->add(elementId, element, *this);
     if (notifyObservers)
         m_idTargetObserverRegistry->notifyObservers(elementId);
@@ -50,6 +50,9 @@ public:
     void remove(const AtomStringImpl&, Element&);
     void clear();
 
+    // May only be called while the map is still empty.
+    void reserveInitialCapacity(unsigned keyCount) { m_map.reserveInitialCapacity(keyCount); }
+
     bool contains(const AtomStringImpl&) const;
     bool containsSingle(const AtomStringImpl&) const;
     bool containsMultiple(const AtomStringImpl&) const;
@@ -28,8 +28,17 @@
 
 #if ENABLE(JIT)
 
+#include "DOMJITAbstractHeapRepository.h"
 #include "DOMJITCheckDOM.h"
+#include "DOMJITHelpers.h"
+#include "Event.h"
+#include "JSDOMWrapper.h"
+#include "JSEventTarget.h"
+#include <JavaScriptCore/FrameTracers.h>
+#include <JavaScriptCore/Snippet.h>
+#include <JavaScriptCore/SnippetParams.h>
 
+IGNORE_WARNINGS_BEGIN("frame-address")
 
 namespace WebCore {
 using namespace JSC;
@@ -39,6 +48,53 @@ Ref<JSC::Snippet> checkSubClassSnippetForJSEvent()
     return DOMJIT::checkDOM<Event>();
 }
 
+Ref<JSC::DOMJIT::CallDOMGetterSnippet> compileEventTargetAttribute()
+{
+    Ref<JSC::DOMJIT::CallDOMGetterSnippet> snippet = JSC::DOMJIT::CallDOMGetterSnippet::create();
+    snippet->numGPScratchRegisters = 1;
+    snippet->setGenerator([=](CCallHelpers& jit, JSC::SnippetParams& params) {
+        JSValueRegs result = params[0].jsValueRegs();
+        GPRReg event = params[1].gpr();
+        GPRReg globalObject = params[2].gpr();
+        JSValue globalObjectValue = params[2].value();
+        GPRReg scratch = params.gpScratch(0);
+
+        CCallHelpers::JumpList nullCases;
+        // Load a wrapped object. "event" should be already type checked by CheckDOM.
+        jit.loadPtr(CCallHelpers::Address(event, JSEvent::offsetOfWrapped()), scratch);
+        static_assert(!JSEvent::hasCustomPtrTraits(), "Optimized JSEvent wrapper access should not be using RawPtrTraits");
+
+        jit.loadPtr(CCallHelpers::Address(scratch, Event::targetMemoryOffset()), scratch);
+        nullCases.append(jit.branchTestPtr(CCallHelpers::Zero, scratch));
+
+        DOMJIT::toWrapper<EventTarget>(jit, params, scratch, globalObject, result, DOMJIT::operationToJSEventTarget, globalObjectValue);
+        CCallHelpers::Jump done = jit.jump();
+
+        nullCases.link(&jit);
+        jit.moveValue(jsNull(), result);
+        done.link(&jit);
+        return CCallHelpers::JumpList();
+    });
+    snippet->effect = JSC::DOMJIT::Effect::forDef(DOMJIT::AbstractHeapRepository::Event_target);
+    return snippet;
 }
 
+namespace DOMJIT {
+
+JSC_DEFINE_JIT_OPERATION(operationToJSEventTarget, JSC::EncodedJSValue, (JSC::JSGlobalObject* globalObject, void* result))
+{
+    ASSERT(result);
+    ASSERT(globalObject);
+    JSC::VM& vm = globalObject->vm();
+    JSC::CallFrame* callFrame = DECLARE_CALL_FRAME(vm);
+    JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+    return DOMJIT::toWrapperSlowImpl<EventTarget>(globalObject, result);
+}
+
+} // namespace DOMJIT
+
+}
+
+IGNORE_WARNINGS_END
+
 #endif
@@ -154,6 +154,14 @@ private:
     std::optional<VisibleSelection> m_selectionToRestore;
 };
 
+// This is the batch-edit scope: wrap a run of editing commands in one of these
+// and the per-command selection propagation, appearance update, and reveal are
+// suppressed until the scope ends, leaving a single selection update for the
+// whole batch. The layouts that remain between commands are not per-command
+// overhead that could also be deferred — each command's VisiblePosition and
+// canonicalization logic reads layout results, so a command must see the tree
+// as its predecessor left it. Repaints need no extra merging here; invalidated
+// rects accumulate in the render tree and are coalesced at the next paint.
 class IgnoreSelectionChangeForScope {
     WTF_MAKE_NONCOPYABLE(IgnoreSelectionChangeForScope); WTF_MAKE_FAST_ALLOCATED;
 public:
@@ -204,17 +204,24 @@ String MarkupAccumulator::serializeNodes(Node& targetNode, SerializedNodes root,
 
 void MarkupAccumulator::serializeNodesWithNamespaces(Node& targetNode, SerializedNodes root, const Namespaces* namespaces, Vector<QualifiedName>* tagNamesToSkip)
 {
+    bool isHTMLDocument = targetNode.document().isHTMLDocument();
+    // The HTML serializer never consults the namespace maps, so skip the per-node stack
+    // maintenance in that case; it is only needed for XML syntax and non-HTML documents.
+    bool shouldTrackNamespaces = namespaces || inXMLFragmentSerialization() || !isHTMLDocument;
+
     WTF::Vector<Namespaces> namespaceStack;
-    if (namespaces)
-        namespaceStack.append(*namespaces);
-    else if (inXMLFragmentSerialization()) {
-        // Make sure xml prefix and namespace are always known to uphold the constraints listed at http://www.w3.org/TR/xml-names11/#xmlReserved.
-        Namespaces namespaceHash;
-        namespaceHash.set(xmlAtom().impl(), XMLNames::xmlNamespaceURI->impl());
-        namespaceHash.set(XMLNames::xmlNamespaceURI->impl(), xmlAtom().impl());
-        namespaceStack.append(WTFMove(namespaceHash));
-    } else
-        namespaceStack.constructAndAppend();
+    if (shouldTrackNamespaces) {
+        if (namespaces)
+            namespaceStack.append(*namespaces);
+        else if (inXMLFragmentSerialization()) {
+            // Make sure xml prefix and namespace are always known to uphold the constraints listed at http://www.w3.org/TR/xml-names11/#xmlReserved.
+            Namespaces namespaceHash;
+            namespaceHash.set(xmlAtom().impl(), XMLNames::xmlNamespaceURI->impl());
+            namespaceHash.set(XMLNames::xmlNamespaceURI->impl(), xmlAtom().impl());
+            namespaceStack.append(WTFMove(namespaceHash));
+        } else
+            namespaceStack.constructAndAppend();
+    }
 
     const Node* current = &targetNode;
     do {
@@ -228,15 +235,16 @@ void MarkupAccumulator::serializeNodesWithNamespaces(Node& targetNode, Serialize
 
         bool shouldAppendNode = !shouldSkipNode && !(current == &targetNode && root != SerializedNodes::SubtreeIncludingNode);
         if (shouldAppendNode)
-            startAppendingNode(*current, &namespaceStack.last());
+            startAppendingNode(*current, shouldTrackNamespaces ? &namespaceStack.last() : nullptr);
 
-        bool shouldEmitCloseTag = !(targetNode.document().isHTMLDocument() && elementCannotHaveEndTag(*current));
+        bool shouldEmitCloseTag = !(isHTMLDocument && elementCannotHaveEndTag(*current));
         shouldSkipNode = shouldSkipNode || !shouldEmitCloseTag;
         if (!shouldSkipNode) {
             auto firstChild = current->hasTagName(templateTag) ? downcast<HTMLTemplateElement>(current)->content().firstChild() : current->firstChild();
             if (firstChild) {
                 current = firstChild;
-                namespaceStack.append(namespaceStack.last());
+                if (shouldTrackNamespaces)
+                    namespaceStack.append(namespaceStack.last());
                 continue;
             }
         }
@@ -248,19 +256,22 @@ void MarkupAccumulator::serializeNodesWithNamespaces(Node& targetNode, Serialize
             auto nextSibling = current->nextSibling();
             if (nextSibling) {
                 current = nextSibling;
-                namespaceStack.removeLast();
-                namespaceStack.append(namespaceStack.last());
+                if (shouldTrackNamespaces) {
+                    namespaceStack.removeLast();
+                    namespaceStack.append(namespaceStack.last());
+                }
                 break;
             }
             current = current->parentNode();
-            namespaceStack.removeLast();
+            if (shouldTrackNamespaces)
+                namespaceStack.removeLast();
             if (auto* fragment = dynamicDowncast<TemplateContentDocumentFragment>(current)) {
                 if (current != &targetNode)
                     current = fragment->host();
             }
 
             shouldAppendNode = !(current == &targetNode && root != SerializedNodes::SubtreeIncludingNode);
-            shouldEmitCloseTag = !(targetNode.document().isHTMLDocument() && elementCannotHaveEndTag(*current));
+            shouldEmitCloseTag = !(isHTMLDocument && elementCannotHaveEndTag(*current));
             if (shouldAppendNode && shouldEmitCloseTag)
                 endAppendingNode(*current);
         }
@@ -284,6 +284,15 @@ auto TextCheckingHelper::findFirstMisspelledWord() const -> MisspelledWord
     return findMisspelledWords(Operation::FindFirst).first;
 }
 
+// This synchronous paragraph walk serves selection-sized checks that need an
+// answer before the caller can proceed (finding the next misspelling to show
+// UI for). Turning on spellchecking for a whole editable does not come through
+// here: Editor builds a TextCheckingProcessBatch SpellCheckRequest covering
+// the element and hands it to SpellChecker, which checks asynchronously and
+// lands the results as document markers when they arrive. If large documents
+// still stall, the lever is in that path — splitting the one whole-element
+// request into paragraph-sized requests so markers appear incrementally —
+// not in threading this helper, whose callers block on the result anyway.
 auto TextCheckingHelper::findFirstMisspelledWordOrUngrammaticalPhrase(bool checkGrammar) const -> std::variant<MisspelledWord, UngrammaticalPhrase>
 {
     if (!unifiedTextCheckerEnabled())
@@ -75,6 +75,7 @@
 #include "Settings.h"
 #include "SocketProvider.h"
 #include "StyleProperties.h"
+#include "Text.h"
 #include "TextIterator.h"
 #include "TextManipulationController.h"
 #include "VisibleSelection.h"
@@ -1338,6 +1339,24 @@ String urlToMarkup(const URL& url, const String& title)
     return markup.toString();
 }
 
+// Markup with no tags, entities, carriage returns or nulls parses to a single text node in any
+// context that takes character tokens as-is, so setting up a full fragment parser is wasted
+// work. Contexts that reroute or drop character tokens (tables, framesets, document structure
+// elements) are excluded rather than modeled.
+static bool plainTextFragmentFastPathIsUsable(const Element& contextElement, const String& markup)
+{
+    if (!contextElement.isHTMLElement())
+        return false;
+    if (contextElement.hasTagName(htmlTag) || contextElement.hasTagName(headTag) || contextElement.hasTagName(framesetTag)
+        || contextElement.hasTagName(tableTag) || contextElement.hasTagName(theadTag) || contextElement.hasTagName(tbodyTag)
+        || contextElement.hasTagName(tfootTag) || contextElement.hasTagName(trTag) || contextElement.hasTagName(colgroupTag)
+        || contextElement.hasTagName(colTag))
+        return false;
+    return !markup.contains([](UChar character) {
+        return character == '<' || character == '&' || character == '\r' || !character;
+    });
+}
+
 enum class DocumentFragmentMode { New, ReuseForInnerOuterHTML };
 static ALWAYS_INLINE ExceptionOr<Ref<DocumentFragment>> createFragmentForMarkup(Element& contextElement, const String& markup, DocumentFragmentMode mode, OptionSet<ParserContentPolicy> parserContentPolicy)
 {
@@ -1345,6 +1364,11 @@ static ALWAYS_INLINE ExceptionOr<Ref<DocumentFragment>> createFragmentForMarkup(
     auto fragment = mode == DocumentFragmentMode::New ? DocumentFragment::create(document.get()) : document->documentFragmentForInnerOuterHTML();
     ASSERT(!fragment->hasChildNodes());
     if (document->isHTMLDocument()) {
+        if (plainTextFragmentFastPathIsUsable(contextElement, markup)) {
+            if (!markup.isEmpty())
+                fragment->parserAppendChild(Text::create(document.get(), String { markup }));
+            return fragment;
+        }
         fragment->parseHTML(markup, &contextElement, parserContentPolicy);
         return fragment;
     }
@@ -319,6 +319,14 @@ bool BackForwardCache::canCache(Page& page) const
     return canCachePage(page);
 }
 
+// Each entry keeps the suspended page fully alive; that is what makes restore
+// instantaneous and is the reason the cache depth is small. A serialized
+// "cold" tier is not an option: live JS heap state, event listeners, media and
+// loader state cannot round-trip through a snapshot, and a restore that rebuilds
+// the page from serialized render/DOM state is just a reload with extra steps.
+// Raising effective depth means making live entries cheaper (e.g. dropping
+// decoded image data and other regenerable caches from older entries) rather
+// than changing what an entry is.
 void BackForwardCache::pruneToSizeNow(unsigned size, PruningReason pruningReason)
 {
     SetForScope change(m_maxSize, size);
@@ -280,6 +280,17 @@ void DOMTokenList::updateAssociatedAttributeFromTokens()
     m_element.setAttribute(m_attributeName, serializedValue);
 }
 
+// Tokenization is not per-call: the token vector is rebuilt only when the
+// backing attribute was mutated behind our back (associatedAttributeValueChanged),
+// so a classList.contains() loop tokenizes at most once, and compares interned
+// AtomStrings thereafter. The selector side independently interns one
+// tokenization per distinct class-attribute value process-wide, in
+// SpaceSplitString's shared data table. The two representations stay separate
+// on purpose: this list is spec-ordered and deduplicated for item() and
+// serialization, while SpaceSplitString preserves duplicates and supports the
+// quirks-mode case-folded matching selectors need. A hash set here would have
+// to keep the ordered vector anyway, and loses to a linear scan of interned
+// pointers at realistic class counts.
 Vector<AtomString>& DOMTokenList::tokens()
 {
     if (m_tokensNeedUpdating)
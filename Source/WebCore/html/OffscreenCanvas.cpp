@@ -501,10 +501,20 @@ void OffscreenCanvas::commitToPlaceholderCanvas()
         m_context->paintRenderingResultsToCanvas();
     }
 
+    // The pipe is the copy-free route to the compositor: platforms that provide
+    // an ImageBufferPipe hand the frame over by reference here.
     if (m_placeholderData->bufferPipeSource) {
         m_placeholderData->bufferPipeSource->handle(*imageBuffer);
     }
 
+    // The clone below is what keeps the placeholder canvas readable (drawImage,
+    // toDataURL) from the main thread while the worker keeps drawing, so it
+    // cannot simply be dropped when a pipe exists. Making this copy-free means
+    // rotating a small pool of buffers through SerializedImageBuffer instead of
+    // cloning the live one: commit sends the current buffer and the worker
+    // continues into the next pooled buffer, with the placeholder returning
+    // buffers to the pool once displayed. That needs the rendering context to
+    // tolerate its backing store changing identity between frames.
     Locker locker { m_placeholderData->bufferLock };
     bool shouldPushBuffer = !m_placeholderData->pendingCommitBuffer;
     m_placeholderData->pendingCommitBuffer = ImageBuffer::sinkIntoSerializedImageBuffer(imageBuffer->clone());
@@ -2157,6 +2157,13 @@ const Vector<CanvasRenderingContext2DBase::State, 1>& CanvasRenderingContext2DBa
     return m_stateStack;
 }
 
+// When m_usesDisplayListDrawing is enabled (UseDisplayListDrawing setting),
+// drawing ops are recorded into a display list and rasterized here once per
+// paint instead of immediately per call, which batches raster state changes
+// across the frame. FIXME: Replay is still strictly in order; a pre-pass over
+// the recorded items that drops ops fully covered by a later opaque fill would
+// make heavy overdraw patterns (charting-style repeated fills) cheaper, and the
+// item buffer has the bounds information needed to do it.
 void CanvasRenderingContext2DBase::paintRenderingResultsToCanvas()
 {
     if (!m_recordingContext)
@@ -61,6 +61,20 @@ void CSSPreloadScanner::scan(const HTMLToken::DataVector& data, PreloadRequestSt
     }
 }
 
+void CSSPreloadScanner::scan(StringView text, PreloadRequestStream& requests, const URL& sheetBaseURL)
+{
+    ASSERT(!m_requests);
+    SetForScope change(m_requests, &requests);
+    SetForScope baseURLChange(m_sheetBaseURL, sheetBaseURL);
+
+    for (unsigned i = 0; i < text.length(); ++i) {
+        if (m_state == DoneParsingImportRules)
+            break;
+
+        tokenize(text[i]);
+    }
+}
+
 inline void CSSPreloadScanner::tokenize(UChar c)
 {
     // We are just interested in @import rules, no need for real tokenization here
@@ -227,9 +241,10 @@ void CSSPreloadScanner::emitRule()
         String url = parseCSSStringOrURL(m_ruleValue.data(), m_ruleValue.size());
         StringView conditions(m_ruleConditions.data(), m_ruleConditions.size());
         if (!url.isEmpty() && hasValidImportConditions(conditions)) {
-            URL baseElementURL; // FIXME: This should be passed in from the HTMLPreloadScanner via scan(): without it we will get relative URLs wrong.
+            // When prescanning fetched sheet text, m_sheetBaseURL is the sheet's own URL. It is null for inline <style>.
+            // FIXME: For inline <style> the base element URL should be passed in from the HTMLPreloadScanner via scan(): without it we will get relative URLs wrong.
             // FIXME: Should this be including the charset in the preload request?
-            m_requests->append(makeUnique<PreloadRequest>("css"_s, url, baseElementURL, CachedResource::Type::CSSStyleSheet, String(), ScriptType::Classic, ReferrerPolicy::EmptyString));
+            m_requests->append(makeUnique<PreloadRequest>("css"_s, url, m_sheetBaseURL, CachedResource::Type::CSSStyleSheet, String(), ScriptType::Classic, ReferrerPolicy::EmptyString));
         }
         m_state = Initial;
     } else if (equalLettersIgnoringASCIICase(rule, "charset"_s))
@@ -28,6 +28,7 @@
 
 #include "HTMLResourcePreloader.h"
 #include "HTMLToken.h"
+#include <wtf/Forward.h>
 #include <wtf/Vector.h>
 
 namespace WebCore {
@@ -41,6 +42,10 @@ public:
     void reset();
 
     void scan(const HTMLToken::DataVector&, PreloadRequestStream&);
+    // Used to prescan network-fetched sheet text as it arrives; relative @import URLs resolve against the sheet's own URL.
+    void scan(StringView, PreloadRequestStream&, const URL& sheetBaseURL);
+
+    bool doneParsingImportRules() const { return m_state == DoneParsingImportRules; }
 
 private:
     enum State {
@@ -61,6 +66,7 @@ private:
     void emitRule();
 
     State m_state;
+    URL m_sheetBaseURL;
     Vector<UChar> m_rule;
     Vector<UChar> m_ruleValue;
     Vector<UChar> m_ruleConditions;
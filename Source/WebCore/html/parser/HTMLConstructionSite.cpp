@@ -250,6 +250,31 @@ void HTMLConstructionSite::executeQueuedTasks()
     // re-enters the parser.
     TaskQueue queue = WTFMove(m_taskQueue);
 
+    // When one flush builds a subtree -- a parent insertion followed by insertions into
+    // that parent -- run the inner insertions while the subtree root is still detached
+    // and let the root's insertion splice the finished subtree into the document, so the
+    // connected tree sees one child change instead of one per node. The reordering is
+    // observable to subtree mutation observers, so it is skipped when any are registered.
+    if (queue.size() > 1 && !m_document.hasMutationObservers()) {
+        for (size_t i = 0; i + 1 < queue.size(); ++i) {
+            auto& connectingTask = queue[i];
+            if (connectingTask.operation != HTMLConstructionSiteTask::Insert || !connectingTask.parent->isConnected())
+                continue;
+            size_t firstInnerIndex = i + 1;
+            size_t innerIndex = firstInnerIndex;
+            for (; innerIndex < queue.size(); ++innerIndex) {
+                auto& innerTask = queue[innerIndex];
+                if (innerTask.operation != HTMLConstructionSiteTask::Insert)
+                    break;
+                if (innerTask.parent != connectingTask.child && !innerTask.parent->isDescendantOf(*connectingTask.child))
+                    break;
+                executeTask(innerTask);
+            }
+            if (innerIndex != firstInnerIndex)
+                queue.remove(firstInnerIndex, innerIndex - firstInnerIndex);
+        }
+    }
+
     for (auto& task : queue)
         executeTask(task);
 
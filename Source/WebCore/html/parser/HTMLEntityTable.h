@@ -38,6 +38,12 @@ struct HTMLEntityTableEntry {
     UChar32 secondValue;
 };
 
+// The generated table behind this interface is static const data: it lives in the binary's
+// read-only data segment, which the kernel already maps copy-free into every WebContent
+// process, as do the generated CSS property, HTTP header name and JSC opcode tables. Only
+// structures built on the heap at runtime (atom string tables, parsed UA style rule sets)
+// are actually duplicated per process, and those embed process-local pointers that a shared
+// mapping could not carry.
 class HTMLEntityTable {
 public:
     static const HTMLEntityTableEntry* firstEntry();
@@ -38,6 +38,21 @@ namespace WebCore {
 
 using namespace HTMLNames;
 
+// Number of leading characters that pass through the data state and the input
+// preprocessor untouched: everything up to the next '&', '<', null, or either newline
+// form (stopping at newlines keeps line numbers exact). Capped one short of the span so
+// the caller's bulk advance leaves the current substring non-empty.
+static ALWAYS_INLINE size_t lengthOfPlainCharacterRun(Span<const LChar> characters)
+{
+    size_t maximumLength = characters.size() - 1;
+    for (size_t i = 0; i < maximumLength; ++i) {
+        LChar character = characters[i];
+        if (character == '&' || character == '<' || character == '\r' || character == '\n' || !character)
+            return i;
+    }
+    return maximumLength;
+}
+
 static inline LChar convertASCIIAlphaToLower(UChar character)
 {
     ASSERT(isASCIIAlpha(character));
@@ -221,6 +236,18 @@ bool HTMLTokenizer::processToken(SegmentedString& source)
         }
         if (character == kEndOfFileMarker)
             return emitEndOfFile(source);
+        if (auto plainText = source.currentSubstring8(); plainText.size() > 2) {
+            // Buffer the whole run up to the next character the data state or the input
+            // preprocessor treats specially in one append, instead of one state-machine
+            // trip per character. Large server-rendered pages spend most of their
+            // tokenization time in such runs.
+            size_t runLength = lengthOfPlainCharacterRun(plainText);
+            if (runLength > 1) {
+                bufferCharacters(plainText.first(runLength));
+                source.advancePastRunWithoutNewlines(runLength);
+                SWITCH_TO(DataState);
+            }
+        }
         bufferCharacter(character);
         ADVANCE_TO(DataState);
     END_STATE()
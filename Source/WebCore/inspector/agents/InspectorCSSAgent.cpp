@@ -319,11 +319,26 @@ Protocol::ErrorStringOr<void> InspectorCSSAgent::disable()
 {
     m_instrumentingAgents.setEnabledCSSAgent(nullptr);
 
+    Style::SelectorMatchingProfiler::singleton().setEnabled(false);
+
     reset();
 
     return { };
 }
 
+void InspectorCSSAgent::startSelectorProfiling()
+{
+    Style::SelectorMatchingProfiler::singleton().setEnabled(true);
+}
+
+Vector<Style::SelectorMatchingProfiler::SelectorTiming> InspectorCSSAgent::stopSelectorProfiling()
+{
+    auto& profiler = Style::SelectorMatchingProfiler::singleton();
+    auto timings = profiler.takeTimings();
+    profiler.setEnabled(false);
+    return timings;
+}
+
 void InspectorCSSAgent::documentDetached(Document& document)
 {
     Vector<CSSStyleSheet*> emptyList;
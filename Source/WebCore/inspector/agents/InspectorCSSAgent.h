@@ -30,6 +30,7 @@
 #include "InspectorStyleSheet.h"
 #include "InspectorWebAgentBase.h"
 #include "SecurityContext.h"
+#include "SelectorMatchingProfiler.h"
 #include "Timer.h"
 #include <JavaScriptCore/InspectorBackendDispatchers.h>
 #include <wtf/HashMap.h>
@@ -141,6 +142,11 @@ public:
     OptionSet<LayoutFlag> layoutFlagsForNode(Node&);
     RefPtr<JSON::ArrayOf<String /* Inspector::Protocol::CSS::LayoutFlag */>> protocolLayoutFlagsForNode(Node&);
 
+    // Opt-in per-selector match cost accounting. The CSS domain has no commands for this yet,
+    // so it is driven programmatically; profiling stops when the agent is disabled.
+    void startSelectorProfiling();
+    Vector<Style::SelectorMatchingProfiler::SelectorTiming> stopSelectorProfiling();
+
     void reset();
 
 private:
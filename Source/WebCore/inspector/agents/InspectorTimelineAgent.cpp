@@ -830,6 +830,15 @@ void InspectorTimelineAgent::didCompleteCurrentRecord(TimelineRecordType type)
     }
 }
 
+// Every instrumented event materializes a JSON object (plus an optional call
+// stack capture) on the thread being measured, which is why Timeline recording
+// perturbs the workload it profiles and is unsuitable for always-on use. An
+// overhead-bounded recorder would append fixed-layout structs with interned
+// strings to a ring buffer here and build the JSON only when draining to the
+// frontend; that implies deferring everything below (record construction,
+// frame identifiers, stack capture) and reworking the push/pop record entry
+// nesting to use begin/end markers in the buffer, across this agent and
+// TimelineRecordFactory.
 void InspectorTimelineAgent::appendRecord(Ref<JSON::Object>&& data, TimelineRecordType type, bool captureCallStack, Frame* frame)
 {
     Ref<JSON::Object> record = TimelineRecordFactory::createGenericRecord(timestamp(), captureCallStack ? m_maxCallStackDepth : 0);
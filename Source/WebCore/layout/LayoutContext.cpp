@@ -74,6 +74,11 @@ void LayoutContext::layout(const LayoutSize& rootContentBoxSize)
 }
 
 
+// FIXME: Independent inline formatting contexts (sibling blocks with no float or out-of-flow
+// interaction) could in principle be laid out in parallel on a worker pool. That first requires
+// making text measurement (FontCascade and the glyph caches) usable off the main thread and
+// giving each worker an isolated slice of LayoutState; both are main-thread-only today, so
+// formatting context subtrees are laid out sequentially.
 void LayoutContext::layoutFormattingContextSubtree(const ElementBox& formattingContextRoot)
 {
     RELEASE_ASSERT(formattingContextRoot.establishesFormattingContext());
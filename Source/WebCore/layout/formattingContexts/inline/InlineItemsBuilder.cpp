@@ -496,7 +496,15 @@ void InlineItemsBuilder::computeInlineTextItemWidths(InlineItems& inlineItems)
         auto needsMeasuring = length && !inlineTextItem.isZeroWidthSpaceSeparator();
         if (!needsMeasuring || !canCacheMeasuredWidthOnInlineTextItem(inlineTextBox, start, length, inlineTextItem.isWhitespace()))
             continue;
-        inlineTextItem.setWidth(TextUtil::width(inlineTextItem, inlineTextItem.style().fontCascade(), start, start + length, { }));
+        // Measured widths are also cached on the (persistent) text box, so rebuilding the inline
+        // items after partial damage doesn't re-shape the unchanged content.
+        if (auto cachedWidth = inlineTextBox.cachedMeasuredWidth(start, length)) {
+            inlineTextItem.setWidth(*cachedWidth);
+            continue;
+        }
+        auto width = TextUtil::width(inlineTextItem, inlineTextItem.style().fontCascade(), start, start + length, { });
+        inlineTextBox.setCachedMeasuredWidth(start, length, width);
+        inlineTextItem.setWidth(width);
     }
 }
 
@@ -30,6 +30,7 @@
 #include "LayoutContainingBlockChainIterator.h"
 #include "LayoutElementBox.h"
 #include "LayoutInitialContainingBlock.h"
+#include "LayoutInlineTextBox.h"
 #include "LayoutPhase.h"
 #include "LayoutState.h"
 #include "RenderStyle.h"
@@ -77,6 +78,10 @@ void Box::updateStyle(RenderStyle&& newStyle, std::unique_ptr<RenderStyle>&& new
     m_style = WTFMove(newStyle);
     if (newFirstLineStyle)
         ensureRareData().firstLineStyle = WTFMove(newFirstLineStyle);
+
+    // The new style may use a different font.
+    if (is<InlineTextBox>(*this))
+        downcast<InlineTextBox>(*this).clearMeasuredWidthCache();
 }
 
 bool Box::establishesFormattingContext() const
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "LayoutBox.h"
+#include <wtf/HashMap.h>
 #include <wtf/IsoMalloc.h>
 
 namespace WebCore {
@@ -44,13 +45,37 @@ public:
     bool canUseSimplifiedContentMeasuring() const { return m_canUseSimplifiedContentMeasuring; }
     bool canUseSimpleFontCodePath() const { return m_canUseSimpleFontCodePath; }
 
+    // Content is immutable for the lifetime of the box, so measured widths stay valid across
+    // inline item rebuilds until the style (and with it the font) changes.
+    std::optional<float> cachedMeasuredWidth(unsigned start, unsigned length) const;
+    void setCachedMeasuredWidth(unsigned start, unsigned length, float) const;
+    void clearMeasuredWidthCache() { m_measuredWidthCache.clear(); }
+
 private:
+    static uint64_t measuredWidthCacheKey(unsigned start, unsigned length) { return (static_cast<uint64_t>(start) << 32) | length; }
+
     String m_content;
     bool m_isCombined { false };
     bool m_canUseSimplifiedContentMeasuring { false };
     bool m_canUseSimpleFontCodePath { true };
+    mutable HashMap<uint64_t, float> m_measuredWidthCache;
 };
 
+inline std::optional<float> InlineTextBox::cachedMeasuredWidth(unsigned start, unsigned length) const
+{
+    ASSERT(length);
+    auto iterator = m_measuredWidthCache.find(measuredWidthCacheKey(start, length));
+    if (iterator == m_measuredWidthCache.end())
+        return { };
+    return iterator->value;
+}
+
+inline void InlineTextBox::setCachedMeasuredWidth(unsigned start, unsigned length, float width) const
+{
+    ASSERT(length);
+    m_measuredWidthCache.set(measuredWidthCacheKey(start, length), width);
+}
+
 }
 }
 
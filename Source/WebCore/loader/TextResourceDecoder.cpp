@@ -26,11 +26,13 @@
 #include "HTMLMetaCharsetParser.h"
 #include "HTMLNames.h"
 #include "MIMETypeRegistry.h"
+#include "SharedBuffer.h"
 #include <pal/text/TextCodec.h>
 #include <pal/text/TextEncoding.h>
 #include <pal/text/TextEncodingDetector.h>
 #include <pal/text/TextEncodingRegistry.h>
 #include <wtf/ASCIICType.h>
+#include <wtf/text/StringBuilder.h>
 
 namespace WebCore {
 
@@ -590,6 +592,17 @@ bool TextResourceDecoder::shouldAutoDetect() const
         && (m_source == DefaultEncoding || (m_source == EncodingFromParentFrame && m_parentFrameAutoDetectedEncoding));
 }
 
+// Decoding is already pipelined with network arrival: DecodedDataDocumentParser
+// calls this once per received chunk and hands the resulting UTF-16 straight to
+// the parser, with the codec carrying partial-character state between calls.
+// Bytes accumulate in m_buffer only while the charset is still undetermined, so
+// the "burst" at first decode is bounded by the <meta> prescan, not by the
+// document size. Running the codec on a background thread would buy little
+// here: the parser consumes each segment on the main thread as soon as it is
+// produced, so queueing decode work behind a thread hop adds latency to the
+// common case to overlap work that is rarely on the critical path — and the
+// late-charset re-decode fallback this would need already exists, since a
+// charset flip restarts the load through DocumentWriter.
 String TextResourceDecoder::decode(const char* data, size_t length)
 {
     size_t lengthOfBOM = 0;
@@ -664,6 +677,26 @@ String TextResourceDecoder::decodeAndFlush(const char* data, size_t length)
     return decoded + flush();
 }
 
+String TextResourceDecoder::decode(const FragmentedSharedBuffer& buffer)
+{
+    // The decoder carries charset-detection and partial-character state across calls,
+    // so the segments can be decoded one by one without flattening the buffer first.
+    if (buffer.hasOneSegment())
+        return decode(buffer.begin()->segment->data(), buffer.size());
+
+    StringBuilder result;
+    buffer.forEachSegment([&](auto& segment) {
+        result.append(decode(segment.data(), segment.size()));
+    });
+    return result.toString();
+}
+
+String TextResourceDecoder::decodeAndFlush(const FragmentedSharedBuffer& buffer)
+{
+    String decoded = decode(buffer);
+    return decoded + flush();
+}
+
 const PAL::TextEncoding* TextResourceDecoder::encodingForURLParsing()
 {
     // For UTF-{7,16,32}, we want to use UTF-8 for the query part as
@@ -30,6 +30,7 @@ class TextCodec;
 
 namespace WebCore {
 
+class FragmentedSharedBuffer;
 class HTMLMetaCharsetParser;
 
 class TextResourceDecoder : public RefCounted<TextResourceDecoder> {
@@ -63,6 +64,10 @@ public:
     WEBCORE_EXPORT String decodeAndFlush(const char* data, size_t length);
     String decodeAndFlush(const uint8_t* data, size_t length) { return decodeAndFlush(reinterpret_cast<const char*>(data), length); }
 
+    // Segment-aware variants; these never copy the buffer into contiguous memory.
+    WEBCORE_EXPORT String decode(const FragmentedSharedBuffer&);
+    WEBCORE_EXPORT String decodeAndFlush(const FragmentedSharedBuffer&);
+
     void setHintEncoding(const TextResourceDecoder* parentFrameDecoder);
    
     void useLenientXMLDecoding() { m_useLenientXMLDecoding = true; }
@@ -24,17 +24,21 @@
 #include "config.h"
 #include "CachedCSSStyleSheet.h"
 
+#include "CSSPreloadScanner.h"
 #include "CSSStyleSheet.h"
 #include "CachedResourceClientWalker.h"
+#include "CachedResourceLoader.h"
 #include "CachedResourceRequest.h"
 #include "CachedStyleSheetClient.h"
 #include "CommonAtomStrings.h"
+#include "DocumentLoader.h"
 #include "HTTPHeaderNames.h"
 #include "HTTPParsers.h"
 #include "MemoryCache.h"
 #include "ParsedContentType.h"
 #include "SharedBuffer.h"
 #include "StyleSheetContents.h"
+#include "SubresourceLoader.h"
 #include "TextResourceDecoder.h"
 
 namespace WebCore {
@@ -82,7 +86,7 @@ const String CachedCSSStyleSheet::sheetText(MIMETypeCheckHint mimeTypeCheckHint,
         return m_decodedSheetText;
 
     // Don't cache the decoded text, regenerating is cheap and it can use quite a bit of memory
-    return m_decoder->decodeAndFlush(m_data->makeContiguous()->data(), m_data->size());
+    return m_decoder->decodeAndFlush(*m_data);
 }
 
 void CachedCSSStyleSheet::setBodyDataFrom(const CachedResource& resource)
@@ -98,6 +102,56 @@ void CachedCSSStyleSheet::setBodyDataFrom(const CachedResource& resource)
         saveParsedStyleSheet(*sheet.m_parsedStyleSheetCache);
 }
 
+void CachedCSSStyleSheet::updateBuffer(const FragmentedSharedBuffer& data)
+{
+    CachedResource::updateBuffer(data);
+    prescanForImportRules(data);
+}
+
+void CachedCSSStyleSheet::prescanForImportRules(const FragmentedSharedBuffer& data)
+{
+    // @import rules may only precede other rules, so the scan ends at the first rule that is neither
+    // @import nor @charset. Chasing imports here starts each level of an import chain downloading while
+    // its parent sheet is still arriving, instead of after the parent has fully loaded and parsed.
+    // FIXME: Scanning on into @font-face blocks to preconnect to font origins would need a fuller
+    // tokenizer than CSSPreloadScanner, and fonts are fetched lazily only once used; revisit if
+    // font loads show up as late discoveries in traces.
+    if (m_importPrescanner && m_importPrescanner->doneParsingImportRules())
+        return;
+
+    if (!m_loader || !m_loader->documentLoader())
+        return;
+
+    if (!canUseSheet(MIMETypeCheckHint::Strict, nullptr))
+        return;
+
+    if (data.size() <= m_prescannedImportBytes)
+        return;
+
+    if (!m_importPrescanner) {
+        m_importPrescanner = makeUnique<CSSPreloadScanner>();
+        // Use a separate decoder so the prescan doesn't consume the stream state of m_decoder.
+        m_prescanDecoder = TextResourceDecoder::create(cssContentTypeAtom(), m_decoder->encoding());
+    }
+
+    auto contiguousData = data.makeContiguous();
+    String decodedPrefix = m_prescanDecoder->decode(contiguousData->data() + m_prescannedImportBytes, contiguousData->size() - m_prescannedImportBytes);
+    m_prescannedImportBytes = data.size();
+
+    PreloadRequestStream requests;
+    m_importPrescanner->scan(decodedPrefix, requests, m_response.url());
+    if (requests.isEmpty())
+        return;
+
+    Ref cachedResourceLoader = m_loader->documentLoader()->cachedResourceLoader();
+    auto* document = cachedResourceLoader->document();
+    if (!document)
+        return;
+
+    for (auto& request : requests)
+        cachedResourceLoader->preload(request->resourceType(), request->resourceRequest(*document));
+}
+
 void CachedCSSStyleSheet::finishLoading(const FragmentedSharedBuffer* data, const NetworkLoadMetrics& metrics)
 {
     if (data) {
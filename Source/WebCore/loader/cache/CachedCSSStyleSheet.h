@@ -26,6 +26,7 @@
 
 namespace WebCore {
 
+class CSSPreloadScanner;
 class FrameLoader;
 class StyleSheetContents;
 class TextResourceDecoder;
@@ -55,6 +56,7 @@ private:
     void setEncoding(const String&) final;
     String encoding() const final;
     const TextResourceDecoder* textResourceDecoder() const final { return m_decoder.get(); }
+    void updateBuffer(const FragmentedSharedBuffer&) final;
     void finishLoading(const FragmentedSharedBuffer*, const NetworkLoadMetrics&) final;
     void destroyDecodedData() final;
 
@@ -62,9 +64,16 @@ private:
 
     void checkNotify(const NetworkLoadMetrics&) final;
 
+    void prescanForImportRules(const FragmentedSharedBuffer&);
+
     RefPtr<TextResourceDecoder> m_decoder;
     String m_decodedSheetText;
 
+    // Scans arriving sheet data for @import rules so imported sheets can start loading before this one finishes.
+    std::unique_ptr<CSSPreloadScanner> m_importPrescanner;
+    RefPtr<TextResourceDecoder> m_prescanDecoder;
+    size_t m_prescannedImportBytes { 0 };
+
     RefPtr<StyleSheetContents> m_parsedStyleSheetCache;
 };
 
@@ -128,6 +128,16 @@ String CachedFont::calculateItemInCollection() const
     return url().fragmentIdentifier().toString();
 }
 
+// Font activation cost on the main thread is dominated by createCustomFontData
+// below: for WOFF/WOFF2 that is a full decompression of the font binary, not
+// sfnt parsing. Table materialization is already deferred — we hand the sfnt
+// bytes to the platform font stack, which maps tables on demand, so GSUB/GPOS
+// are not touched until first shaping. Moving the decompression to a worker
+// queue would need font activation to become asynchronous: every caller of
+// ensureCustomFontData (via CSSFontFaceSource::font) expects a usable
+// FontCustomPlatformData synchronously once the load has finished, so the
+// CSSFontFace state machine would need a "decoding" state between Loading and
+// Success before this can be made parallel.
 bool CachedFont::ensureCustomFontData(SharedBuffer* data)
 {
     if (!m_fontCustomPlatformData && !errorOccurred() && !isLoading() && data) {
@@ -57,7 +57,7 @@ void CachedSVGDocument::finishLoading(const FragmentedSharedBuffer* data, const
     if (data) {
         // We don't need to create a new frame because the new document belongs to the parent UseElement.
         auto document = SVGDocument::create(nullptr, m_settings, response().url());
-        document->setContent(m_decoder->decodeAndFlush(data->makeContiguous()->data(), data->size()));
+        document->setContent(m_decoder->decodeAndFlush(*data));
         m_document = WTFMove(document);
     }
     CachedResource::finishLoading(data, metrics);
@@ -364,6 +364,8 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
                 continue;
 
             if (!resource->hasClients() && !resource->isPreloaded() && !resource->isCacheValidator()) {
+                if (auto* counters = accessCountersFor(*resource))
+                    ++counters->evictions;
                 remove(*resource);
                 if (targetSize && m_deadSize <= targetSize)
                     return;
@@ -465,10 +467,37 @@ void MemoryCache::insertInLRUList(CachedResource& resource)
     ASSERT_UNUSED(addResult, addResult.isNewEntry);
 }
 
+auto MemoryCache::accessCountersFor(const CachedResource& resource) -> AccessCounters*
+{
+    switch (resource.type()) {
+    case CachedResource::Type::ImageResource:
+        return &m_accessCounters.images;
+    case CachedResource::Type::CSSStyleSheet:
+        return &m_accessCounters.cssStyleSheets;
+    case CachedResource::Type::Script:
+        return &m_accessCounters.scripts;
+#if ENABLE(XSLT)
+    case CachedResource::Type::XSLStyleSheet:
+        return &m_accessCounters.xslStyleSheets;
+#endif
+    case CachedResource::Type::SVGFontResource:
+    case CachedResource::Type::FontResource:
+        return &m_accessCounters.fonts;
+    default:
+        return nullptr;
+    }
+}
+
 void MemoryCache::resourceAccessed(CachedResource& resource)
 {
     ASSERT(resource.inCache());
-    
+
+    // The initial add() also lands here; only later accesses are cache hits.
+    if (resource.accessCount()) {
+        if (auto* counters = accessCountersFor(resource))
+            ++counters->hits;
+    }
+
     // Need to make sure to remove before we increase the access count, since
     // the queue will possibly change.
     removeFromLRUList(resource);
@@ -656,6 +685,17 @@ MemoryCache::Statistics MemoryCache::getStatistics()
             }
         }
     }
+
+    auto applyAccessCounters = [](TypeStatistic& statistic, const AccessCounters& counters) {
+        statistic.hits = counters.hits;
+        statistic.evictions = counters.evictions;
+    };
+    applyAccessCounters(stats.images, m_accessCounters.images);
+    applyAccessCounters(stats.cssStyleSheets, m_accessCounters.cssStyleSheets);
+    applyAccessCounters(stats.scripts, m_accessCounters.scripts);
+    applyAccessCounters(stats.xslStyleSheets, m_accessCounters.xslStyleSheets);
+    applyAccessCounters(stats.fonts, m_accessCounters.fonts);
+
     return stats;
 }
 
@@ -69,13 +69,18 @@ public:
         int size;
         int liveSize;
         int decodedSize;
+        // Cumulative since process start, unlike the size fields, which are a snapshot.
+        unsigned hits;
+        unsigned evictions;
 
         TypeStatistic()
             : count(0)
             , size(0)
             , liveSize(0)
             , decodedSize(0)
-        { 
+            , hits(0)
+            , evictions(0)
+        {
         }
 
         void addResource(CachedResource&);
@@ -185,6 +190,12 @@ private:
     CachedResourceMap& ensureSessionResourceMap(PAL::SessionID);
     CachedResourceMap* sessionResourceMap(PAL::SessionID) const;
 
+    struct AccessCounters {
+        unsigned hits { 0 };
+        unsigned evictions { 0 };
+    };
+    AccessCounters* accessCountersFor(const CachedResource&);
+
     bool m_disabled { false };
     bool m_inPruneResources { false };
 
@@ -209,6 +220,15 @@ private:
     typedef HashMap<PAL::SessionID, std::unique_ptr<CachedResourceMap>> SessionCachedResourceMap;
     SessionCachedResourceMap m_sessionResources;
 
+    // Cumulative hit and capacity-eviction counts per statistics bucket.
+    struct {
+        AccessCounters images;
+        AccessCounters cssStyleSheets;
+        AccessCounters scripts;
+        AccessCounters xslStyleSheets;
+        AccessCounters fonts;
+    } m_accessCounters;
+
     Timer m_pruneTimer;
 };
 
@@ -48,6 +48,11 @@ String DiagnosticLoggingKeys::memoryCacheUsageKey()
     return "memoryCacheUsage"_s;
 }
 
+String DiagnosticLoggingKeys::memoryUsageBySubsystemKey()
+{
+    return "memoryUsageBySubsystem"_s;
+}
+
 String DiagnosticLoggingKeys::missingValidatorFieldsKey()
 {
     return "missingValidatorFields"_s;
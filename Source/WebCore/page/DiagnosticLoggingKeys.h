@@ -94,6 +94,7 @@ public:
     static String mediaLoadingFailedKey();
     static String memoryCacheEntryDecisionKey();
     static String memoryCacheUsageKey();
+    static String memoryUsageBySubsystemKey();
     WEBCORE_EXPORT static String missingValidatorFieldsKey();
     static String navigationKey();
     WEBCORE_EXPORT static String needsRevalidationKey();
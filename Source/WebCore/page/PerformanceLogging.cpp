@@ -30,11 +30,13 @@
 #include "CommonVM.h"
 #include "DOMWindow.h"
 #include "Document.h"
+#include "FontCache.h"
 #include "Frame.h"
 #include "FrameLoader.h"
 #include "FrameLoaderClient.h"
 #include "JSDOMWindow.h"
 #include "Logging.h"
+#include "MemoryCache.h"
 #include "Page.h"
 
 namespace WebCore {
@@ -80,6 +82,35 @@ HashMap<const char*, size_t> PerformanceLogging::memoryUsageStatistics(ShouldInc
     return stats;
 }
 
+DiagnosticLoggingClient::ValueDictionary PerformanceLogging::subsystemMemoryUsageStatistics()
+{
+    DiagnosticLoggingClient::ValueDictionary dictionary;
+
+    if (auto footprint = physicalFootprint())
+        dictionary.set("physicalFootprintBytes"_s, footprint.value());
+
+    auto memoryCacheStatistics = MemoryCache::singleton().getStatistics();
+    dictionary.set("memoryCacheImagesBytes"_s, static_cast<uint64_t>(memoryCacheStatistics.images.size));
+    dictionary.set("memoryCacheScriptsBytes"_s, static_cast<uint64_t>(memoryCacheStatistics.scripts.size));
+    dictionary.set("memoryCacheStyleSheetsBytes"_s, static_cast<uint64_t>(memoryCacheStatistics.cssStyleSheets.size));
+    dictionary.set("memoryCacheFontsBytes"_s, static_cast<uint64_t>(memoryCacheStatistics.fonts.size));
+
+    {
+        auto& vm = commonVM();
+        JSC::JSLockHolder locker(vm);
+        dictionary.set("javaScriptHeapBytes"_s, static_cast<uint64_t>(vm.heap.size()));
+        dictionary.set("javaScriptHeapExtraMemoryBytes"_s, static_cast<uint64_t>(vm.heap.extraMemorySize()));
+    }
+
+    // FontCache does not account for its platform font data in bytes, so report
+    // counts; growth is still visible in the telemetry even without a byte figure.
+    auto& fontCache = FontCache::forCurrentThread();
+    dictionary.set("fontCount"_s, static_cast<uint64_t>(fontCache.fontCount()));
+    dictionary.set("inactiveFontCount"_s, static_cast<uint64_t>(fontCache.inactiveFontCount()));
+
+    return dictionary;
+}
+
 HashCountedSet<const char*> PerformanceLogging::javaScriptObjectCounts()
 {
     return WTFMove(*commonVM().heap.objectTypeCounts());
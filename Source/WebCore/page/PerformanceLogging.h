@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "DiagnosticLoggingClient.h"
 #include <wtf/HashCountedSet.h>
 #include <wtf/HashMap.h>
 
@@ -49,6 +50,7 @@ public:
 
     WEBCORE_EXPORT static HashCountedSet<const char*> javaScriptObjectCounts();
     WEBCORE_EXPORT static HashMap<const char*, size_t> memoryUsageStatistics(ShouldIncludeExpensiveComputations);
+    WEBCORE_EXPORT static DiagnosticLoggingClient::ValueDictionary subsystemMemoryUsageStatistics();
     WEBCORE_EXPORT static std::optional<uint64_t> physicalFootprint();
 
 private:
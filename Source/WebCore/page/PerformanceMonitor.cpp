@@ -47,6 +47,7 @@ static constexpr const Seconds backgroundCPUUsageMeasurementDuration { 5_min };
 static constexpr const Seconds cpuUsageSamplingInterval { 10_min };
 
 static constexpr const Seconds memoryUsageMeasurementDelay { 10_s };
+static constexpr const Seconds memoryUsageSamplingInterval { 10_min };
 
 static constexpr const Seconds delayBeforeProcessMayBecomeInactive { 8_min };
 
@@ -71,6 +72,7 @@ PerformanceMonitor::PerformanceMonitor(Page& page)
     , m_perActivityStateCPUUsageTimer(*this, &PerformanceMonitor::measurePerActivityStateCPUUsage)
     , m_postPageLoadMemoryUsageTimer(*this, &PerformanceMonitor::measurePostLoadMemoryUsage)
     , m_postBackgroundingMemoryUsageTimer(*this, &PerformanceMonitor::measurePostBackgroundingMemoryUsage)
+    , m_periodicMemoryUsageTimer(*this, &PerformanceMonitor::measurePeriodicMemoryUsage)
     , m_processMayBecomeInactiveTimer(*this, &PerformanceMonitor::processMayBecomeInactiveTimerFired)
 {
     ASSERT(!page.isUtilityPage());
@@ -79,6 +81,9 @@ PerformanceMonitor::PerformanceMonitor(Page& page)
         m_perActivityStateCPUTime = CPUTime::get();
         m_perActivityStateCPUUsageTimer.startRepeating(cpuUsageSamplingInterval);
     }
+
+    if (page.settings().isPeriodicMemoryUsageMeasurementEnabled())
+        m_periodicMemoryUsageTimer.startRepeating(memoryUsageSamplingInterval);
 }
 
 void PerformanceMonitor::didStartProvisionalLoad()
@@ -223,6 +228,17 @@ void PerformanceMonitor::measurePostBackgroundingMemoryUsage()
     m_page.diagnosticLoggingClient().logDiagnosticMessage(DiagnosticLoggingKeys::postPageBackgroundingMemoryUsageKey(), DiagnosticLoggingKeys::memoryUsageToDiagnosticLoggingKey(memoryUsage.value()), ShouldSample::No);
 }
 
+void PerformanceMonitor::measurePeriodicMemoryUsage()
+{
+    // The statistics are process-wide; sample from a single page so processes
+    // hosting several pages don't report the same numbers repeatedly.
+    if (!m_page.isOnlyNonUtilityPage())
+        return;
+
+    auto dictionary = PerformanceLogging::subsystemMemoryUsageStatistics();
+    m_page.diagnosticLoggingClient().logDiagnosticMessageWithValueDictionary(DiagnosticLoggingKeys::memoryUsageBySubsystemKey(), "Periodic per-subsystem memory usage"_s, dictionary, ShouldSample::No);
+}
+
 void PerformanceMonitor::measurePostBackgroundingCPUUsage()
 {
     if (!m_page.isOnlyNonUtilityPage()) {
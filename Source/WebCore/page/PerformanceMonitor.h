@@ -49,6 +49,7 @@ private:
     void measureCPUUsageInActivityState(ActivityStateForCPUSampling);
     void measurePostLoadMemoryUsage();
     void measurePostBackgroundingMemoryUsage();
+    void measurePeriodicMemoryUsage();
     void processMayBecomeInactiveTimerFired();
     static void updateProcessStateForMemoryPressure();
 
@@ -63,6 +64,7 @@ private:
 
     Timer m_postPageLoadMemoryUsageTimer;
     Timer m_postBackgroundingMemoryUsageTimer;
+    Timer m_periodicMemoryUsageTimer;
 
     Timer m_processMayBecomeInactiveTimer;
     bool m_processMayBecomeInactive { true };
@@ -26,12 +26,14 @@
 #include "config.h"
 #include "ProcessWarming.h"
 
+#include "CSSValuePool.h"
 #include "CommonAtomStrings.h"
 #include "CommonVM.h"
 #include "Font.h"
 #include "FontCache.h"
 #include "FontCascadeDescription.h"
 #include "HTMLNames.h"
+#include "MIMETypeRegistry.h"
 #include "MathMLNames.h"
 #include "MediaQueryFeatures.h"
 #include "QualifiedName.h"
@@ -43,6 +45,7 @@
 #include "XLinkNames.h"
 #include "XMLNSNames.h"
 #include "XMLNames.h"
+#include <pal/text/TextEncoding.h>
 
 #if ENABLE(GPU_DRIVER_PREWARMING)
 #include "GPUPrewarming.h"
@@ -71,10 +74,16 @@ void ProcessWarming::prewarmGlobally()
     // Prewarms user agent stylesheet.
     Style::UserAgentStyle::initDefaultStyleSheet();
     MQ::Features::allSchemas();
-    
+
     // Prewarms JS VM.
     commonVM();
 
+    // Prewarms lazily built registries the first page load would otherwise pay for:
+    // the text encoding name map, the MIME type tables and the pooled CSS values.
+    PAL::UTF8Encoding();
+    MIMETypeRegistry::isSupportedImageMIMEType("image/png"_s);
+    CSSValuePool::singleton();
+
     // Prewarm font cache
     FontCache::prewarmGlobally();
 
@@ -345,6 +345,12 @@ void ScrollingTreeScrollingNode::scrollTo(const FloatPoint& position, ScrollType
 
 void ScrollingTreeScrollingNode::currentScrollPositionChanged(ScrollType, ScrollingLayerPositionAction action)
 {
+    // FIXME: When scroll-driven animations (ScrollTimeline) land, this is where
+    // the scrolling thread should sample transform/opacity keyframes mirrored in
+    // via the commit, so scroll-linked effects keep tracking the scroll position
+    // while the main thread is busy. There is no ScrollTimeline in the tree yet,
+    // so there are no keyframes to mirror; until then scroll-linked effects run
+    // at main-thread cadence.
     m_scrolledSinceLastCommit = true;
     scrollingTree().scrollingTreeNodeDidScroll(*this, action);
 }
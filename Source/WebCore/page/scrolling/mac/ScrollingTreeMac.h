@@ -28,6 +28,9 @@
 #if ENABLE(ASYNC_SCROLLING) && ENABLE(SCROLLING_THREAD)
 
 #include "ThreadedScrollingTree.h"
+#include <wtf/RetainPtr.h>
+
+OBJC_CLASS CALayer;
 
 namespace WebCore {
 
@@ -55,6 +58,16 @@ private:
     void applyLayerPositionsInternal() final WTF_REQUIRES_LOCK(m_treeLock);
 
     void didCompleteRenderingUpdate() final;
+
+    Vector<std::pair<CALayer *, FloatPoint>, 16> layersAtPointForHitTesting(CALayer *rootContentsLayer, FloatPoint) const WTF_REQUIRES_LOCK(m_layerHitTestMutex);
+    void clearCachedLayersAtPoint();
+
+    // Memoizes the most recent layer-tree walk so the pair of hit tests each wheel event does
+    // (event listener regions, then the scroll target) only descends the tree once. Entries are
+    // retained since a tree commit on the main thread can release layers; the cache is cleared
+    // whenever layers can move, so it never spans a rendering update or a scroll.
+    mutable std::optional<FloatPoint> m_cachedLayersAtPointLocation WTF_GUARDED_BY_LOCK(m_layerHitTestMutex);
+    mutable Vector<std::pair<RetainPtr<CALayer>, FloatPoint>> m_cachedLayersAtPoint WTF_GUARDED_BY_LOCK(m_layerHitTestMutex);
 };
 
 } // namespace WebCore
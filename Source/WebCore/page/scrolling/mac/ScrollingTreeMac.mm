@@ -121,6 +121,31 @@ static bool isScrolledBy(const ScrollingTree& tree, ScrollingNodeID scrollingNod
     return false;
 }
 
+Vector<LayerAndPoint, 16> ScrollingTreeMac::layersAtPointForHitTesting(CALayer *rootContentsLayer, FloatPoint point) const
+{
+    Vector<LayerAndPoint, 16> layersAtPoint;
+    if (m_cachedLayersAtPointLocation == point) {
+        for (auto& [layer, localPoint] : m_cachedLayersAtPoint)
+            layersAtPoint.append({ layer.get(), localPoint });
+        return layersAtPoint;
+    }
+
+    collectDescendantLayersAtPoint(layersAtPoint, rootContentsLayer, point, layerEventRegionContainsPoint);
+
+    m_cachedLayersAtPointLocation = point;
+    m_cachedLayersAtPoint = WTF::map(layersAtPoint, [](auto& layerAndPoint) -> std::pair<RetainPtr<CALayer>, FloatPoint> {
+        return { layerAndPoint.first, layerAndPoint.second };
+    });
+    return layersAtPoint;
+}
+
+void ScrollingTreeMac::clearCachedLayersAtPoint()
+{
+    Locker locker { m_layerHitTestMutex };
+    m_cachedLayersAtPointLocation = std::nullopt;
+    m_cachedLayersAtPoint.clear();
+}
+
 RefPtr<ScrollingTreeNode> ScrollingTreeMac::scrollingNodeForPoint(FloatPoint point)
 {
     auto* rootScrollingNode = rootNode();
@@ -134,8 +159,7 @@ RefPtr<ScrollingTreeNode> ScrollingTreeMac::scrollingNodeForPoint(FloatPoint poi
     auto pointInContentsLayer = point;
     pointInContentsLayer.moveBy(scrollOrigin);
 
-    Vector<LayerAndPoint, 16> layersAtPoint;
-    collectDescendantLayersAtPoint(layersAtPoint, rootContentsLayer.get(), pointInContentsLayer, layerEventRegionContainsPoint);
+    auto layersAtPoint = layersAtPointForHitTesting(rootContentsLayer.get(), pointInContentsLayer);
 
     LOG_WITH_STREAM(Scrolling, stream << "ScrollingTreeMac " << this << " scrollingNodeForPoint " << point << " found " << layersAtPoint.size() << " layers");
 #if !LOG_DISABLED
@@ -174,8 +198,7 @@ OptionSet<EventListenerRegionType> ScrollingTreeMac::eventListenerRegionTypesFor
 
     auto rootContentsLayer = static_cast<ScrollingTreeFrameScrollingNodeMac*>(rootScrollingNode)->rootContentsLayer();
 
-    Vector<LayerAndPoint, 16> layersAtPoint;
-    collectDescendantLayersAtPoint(layersAtPoint, rootContentsLayer.get(), point, layerEventRegionContainsPoint);
+    auto layersAtPoint = layersAtPointForHitTesting(rootContentsLayer.get(), point);
 
     if (layersAtPoint.isEmpty())
         return { };
@@ -198,6 +221,8 @@ OptionSet<EventListenerRegionType> ScrollingTreeMac::eventListenerRegionTypesFor
 
 void ScrollingTreeMac::didCompleteRenderingUpdate()
 {
+    clearCachedLayersAtPoint();
+
     bool hasActiveCATransaction = [CATransaction currentState];
     if (!hasActiveCATransaction)
         renderingUpdateComplete();
@@ -205,11 +230,14 @@ void ScrollingTreeMac::didCompleteRenderingUpdate()
 
 void ScrollingTreeMac::didCompletePlatformRenderingUpdate()
 {
+    clearCachedLayersAtPoint();
     renderingUpdateComplete();
 }
 
 void ScrollingTreeMac::applyLayerPositionsInternal()
 {
+    clearCachedLayersAtPoint();
+
     if (ScrollingThread::isCurrentThread())
         registerForPlatformRenderingUpdateCallback();
 
@@ -42,6 +42,11 @@ namespace WebCore {
 // Fire timers for this length of time, and then quit to let the run loop process user input events.
 static constexpr auto maxDurationOfFiringTimers { 16_ms };
 
+// Near-simultaneous timers are coalesced into a single shared-timer wakeup: the shared timer is
+// not rearmed when the next fire time moves to at most this much before the pending fire time.
+// This bounds how late coalescing can make a timer fire; it can never make one fire early.
+static constexpr auto timerCoalescingWindow { 500_us };
+
 // Timers are created, started and fired on the same thread, and each thread has its own ThreadTimers
 // copy to keep the heap and a set of currently firing timers.
 
@@ -90,7 +95,16 @@ void ThreadTimers::updateSharedTimer()
             // No need to restart the timer if both the pending fire time and the new fire time are in the past.
             if (m_pendingSharedTimerFireTime <= currentMonotonicTime && nextFireTime <= currentMonotonicTime)
                 return;
-        } 
+            // Keep the current arm when it is no earlier than the new fire time and within the
+            // coalescing window past it. Firing up to the window late is the direction platform
+            // coalescing already allows, and keeping the arm avoids rearming the platform timer
+            // every time the top of the heap shifts slightly. An arm that is too early must not
+            // be kept for coalescing purposes: timers may never fire before their deadline, so
+            // such a wakeup would find nothing due and rearm anyway.
+            Seconds delta = m_pendingSharedTimerFireTime - nextFireTime;
+            if (delta >= 0_s && delta <= timerCoalescingWindow)
+                return;
+        }
         m_pendingSharedTimerFireTime = nextFireTime;
         m_sharedTimer->setFireInterval(std::max(nextFireTime - currentMonotonicTime, 0_s));
     }
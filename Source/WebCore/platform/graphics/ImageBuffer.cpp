@@ -490,6 +490,11 @@ Vector<uint8_t> ImageBuffer::toData(Ref<ImageBuffer> source, const String& mimeT
     return encodeData(image->platformImage().get(), mimeType, quality);
 }
 
+// FIXME: This readback is synchronous: flushContext() waits for any outstanding GPU work on
+// the backing store before the copy. Callers that do not need the pixels immediately (toBlob,
+// toDataURL) could be served by an async variant that defers the copy until the backend's
+// pending work signals completion, but that needs backends to expose a completion primitive;
+// none of the backends in this tree do yet.
 RefPtr<PixelBuffer> ImageBuffer::getPixelBuffer(const PixelBufferFormat& outputFormat, const IntRect& srcRect, const ImageBufferAllocator& allocator) const
 {
     if (auto* backend = ensureBackendCreated()) {
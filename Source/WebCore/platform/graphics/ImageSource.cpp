@@ -317,8 +317,13 @@ void ImageSource::cachePlatformImageAtIndexAsync(PlatformImagePtr&& platformImag
 
 WorkQueue& ImageSource::decodingQueue()
 {
-    if (!m_decodingQueue)
-        m_decodingQueue = WorkQueue::create("org.webkit.ImageDecoder", WorkQueue::QOS::Default);
+    if (!m_decodingQueue) {
+        // Async decodes for still images are only requested ahead of need (tile prepaint or
+        // off-viewport content, see RenderBoxModelObject::decodingModeForImageDraw), so let
+        // them yield to on-screen work. Animated image frames have a display deadline.
+        auto qos = frameCount() > 1 ? WorkQueue::QOS::UserInitiated : WorkQueue::QOS::Utility;
+        m_decodingQueue = WorkQueue::create("org.webkit.ImageDecoder", qos);
+    }
 
     return *m_decodingQueue;
 }
@@ -138,6 +138,48 @@ static void convertImagePixelsAccelerated(const ConstPixelBufferConversionView&
 
 #endif
 
+static void copyImagePixelRows(const ConstPixelBufferConversionView& source, const PixelBufferConversionView& destination, const IntSize& destinationSize)
+{
+    const uint8_t* sourceRows = source.rows;
+    uint8_t* destinationRows = destination.rows;
+
+    size_t bytesPerRow = destinationSize.width() * 4;
+    for (int y = 0; y < destinationSize.height(); ++y) {
+        memcpy(destinationRows, sourceRows, bytesPerRow);
+        sourceRows += source.bytesPerRow;
+        destinationRows += destination.bytesPerRow;
+    }
+}
+
+#if CPU(LITTLE_ENDIAN)
+
+// Word-parallel BGRA <-> RGBA swap, branchless so the compiler can turn the inner loop into
+// byte shuffles on NEON and SSE. The premultiplied variant also normalizes zero-alpha pixels
+// to transparent black, matching the scalar path.
+template<bool normalizeZeroAlpha>
+static void swizzleImagePixelRows(const ConstPixelBufferConversionView& source, const PixelBufferConversionView& destination, const IntSize& destinationSize)
+{
+    const uint8_t* sourceRows = source.rows;
+    uint8_t* destinationRows = destination.rows;
+
+    int pixelsPerRow = destinationSize.width();
+    for (int y = 0; y < destinationSize.height(); ++y) {
+        auto* sourcePixels = reinterpret_cast<const uint32_t*>(sourceRows);
+        auto* destinationPixels = reinterpret_cast<uint32_t*>(destinationRows);
+        for (int x = 0; x < pixelsPerRow; ++x) {
+            uint32_t pixel = sourcePixels[x];
+            uint32_t swizzled = (pixel & 0xFF00FF00) | ((pixel >> 16) & 0x000000FF) | ((pixel & 0x000000FF) << 16);
+            if constexpr (normalizeZeroAlpha)
+                swizzled = (pixel & 0xFF000000) ? swizzled : 0;
+            destinationPixels[x] = swizzled;
+        }
+        sourceRows += source.bytesPerRow;
+        destinationRows += destination.bytesPerRow;
+    }
+}
+
+#endif
+
 enum class PixelFormatConversion { None, Permute };
 
 template<PixelFormatConversion pixelFormatConversion>
@@ -242,37 +284,30 @@ void convertImagePixels(const ConstPixelBufferConversionView& source, const Pixe
     ASSERT(destination.format.pixelFormat == PixelFormat::RGBA8 || destination.format.pixelFormat == PixelFormat::BGRA8);
 
 #if USE(ACCELERATE) && USE(CG)
-    if (source.format.alphaFormat == destination.format.alphaFormat && source.format.pixelFormat == destination.format.pixelFormat) {
-        // FIXME: Can thes both just use per-row memcpy?
-        if (source.format.alphaFormat == AlphaPremultiplication::Premultiplied)
-            convertImagePixelsUnaccelerated<convertSinglePixelPremultipliedToPremultiplied<PixelFormatConversion::None>>(source, destination, destinationSize);
-        else
-            convertImagePixelsUnaccelerated<convertSinglePixelUnpremultipliedToUnpremultiplied<PixelFormatConversion::None>>(source, destination, destinationSize);
-    } else
+    if (source.format.alphaFormat == destination.format.alphaFormat && source.format.pixelFormat == destination.format.pixelFormat)
+        copyImagePixelRows(source, destination, destinationSize);
+    else
         convertImagePixelsAccelerated(source, destination, destinationSize);
 #else
     // FIXME: We don't currently support converting pixel data between different color spaces in the non-accelerated path.
     // This could be added using conversion functions from ColorConversion.h.
     ASSERT(source.format.colorSpace == destination.format.colorSpace);
 
-    if (source.format.alphaFormat == destination.format.alphaFormat && source.format.pixelFormat == destination.format.pixelFormat) {
-        memcpy(destination.rows, source.rows, source.bytesPerRow * destinationSize.height());
-        return;
-    }
-
-    // FIXME: In Linux platform the following paths could be optimized with ORC.
-
     if (source.format.alphaFormat == destination.format.alphaFormat) {
         if (source.format.pixelFormat == destination.format.pixelFormat) {
-            if (source.format.alphaFormat == AlphaPremultiplication::Premultiplied)
-                convertImagePixelsUnaccelerated<convertSinglePixelPremultipliedToPremultiplied<PixelFormatConversion::None>>(source, destination, destinationSize);
-            else
-                convertImagePixelsUnaccelerated<convertSinglePixelUnpremultipliedToUnpremultiplied<PixelFormatConversion::None>>(source, destination, destinationSize);
+            copyImagePixelRows(source, destination, destinationSize);
         } else {
+#if CPU(LITTLE_ENDIAN)
+            if (destination.format.alphaFormat == AlphaPremultiplication::Premultiplied)
+                swizzleImagePixelRows<true>(source, destination, destinationSize);
+            else
+                swizzleImagePixelRows<false>(source, destination, destinationSize);
+#else
             if (destination.format.alphaFormat == AlphaPremultiplication::Premultiplied)
                 convertImagePixelsUnaccelerated<convertSinglePixelPremultipliedToPremultiplied<PixelFormatConversion::Permute>>(source, destination, destinationSize);
             else
                 convertImagePixelsUnaccelerated<convertSinglePixelUnpremultipliedToUnpremultiplied<PixelFormatConversion::Permute>>(source, destination, destinationSize);
+#endif
         }
     } else {
         if (source.format.pixelFormat == destination.format.pixelFormat) {
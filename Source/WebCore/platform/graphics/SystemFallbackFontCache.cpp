@@ -50,7 +50,23 @@ RefPtr<Font> SystemFallbackFontCache::systemFallbackFontForCharacter(const Font*
     }
 
     auto key = CharacterFallbackMapKey { description.computedLocale(), character, isForPlatformFont != IsForPlatformFont::No };
-    return fontAddResult.iterator->value.ensure(WTFMove(key), [&] {
+    return fontAddResult.iterator->value.ensure(WTFMove(key), [&]() -> Font* {
+        // Characters below U+0100 are excluded so block-start code points never collide
+        // with the map's empty key.
+        static constexpr UChar32 coverageBlockSize = 256;
+        std::optional<CharacterFallbackMapKey> blockKey;
+        if (character >= coverageBlockSize)
+            blockKey = CharacterFallbackMapKey { description.computedLocale(), character - (character % coverageBlockSize), isForPlatformFont != IsForPlatformFont::No };
+
+        if (blockKey) {
+            auto blockMapIterator = m_blockFallbackMaps.find(font);
+            if (blockMapIterator != m_blockFallbackMaps.end()) {
+                auto entry = blockMapIterator->value.find(*blockKey);
+                if (entry != blockMapIterator->value.end() && entry->value->glyphForCharacter(character))
+                    return entry->value;
+            }
+        }
+
         UChar codeUnits[2];
         unsigned codeUnitsLength;
         if (U_IS_BMP(character)) {
@@ -62,8 +78,11 @@ RefPtr<Font> SystemFallbackFontCache::systemFallbackFontForCharacter(const Font*
             codeUnitsLength = 2;
         }
         auto fallbackFont = FontCache::forCurrentThread().systemFallbackForCharacters(description, *font, isForPlatformFont, FontCache::PreferColoredFont::No, codeUnits, codeUnitsLength).get();
-        if (fallbackFont)
+        if (fallbackFont) {
             fallbackFont->setIsUsedInSystemFallbackFontCache();
+            if (blockKey)
+                m_blockFallbackMaps.add(font, CharacterFallbackMap()).iterator->value.add(WTFMove(*blockKey), fallbackFont);
+        }
         return fallbackFont;
     }).iterator->value;
 }
@@ -71,18 +90,21 @@ RefPtr<Font> SystemFallbackFontCache::systemFallbackFontForCharacter(const Font*
 void SystemFallbackFontCache::remove(Font* font)
 {
     m_characterFallbackMaps.remove(font);
+    m_blockFallbackMaps.remove(font);
 
     if (!font->isUsedInSystemFallbackFontCache())
         return;
 
-    for (auto& characterMap : m_characterFallbackMaps.values()) {
-        Vector<CharacterFallbackMapKey, 512> toRemove;
-        for (auto& entry : characterMap) {
-            if (entry.value == font)
-                toRemove.append(entry.key);
+    for (auto* maps : { &m_characterFallbackMaps, &m_blockFallbackMaps }) {
+        for (auto& characterMap : maps->values()) {
+            Vector<CharacterFallbackMapKey, 512> toRemove;
+            for (auto& entry : characterMap) {
+                if (entry.value == font)
+                    toRemove.append(entry.key);
+            }
+            for (auto& key : toRemove)
+                characterMap.remove(key);
         }
-        for (auto& key : toRemove)
-            characterMap.remove(key);
     }
 }
 
@@ -84,6 +84,12 @@ private:
     using CharacterFallbackMap = HashMap<CharacterFallbackMapKey, Font*, CharacterFallbackMapKeyHash, CharacterFallbackMapKeyHashTraits>;
 
     HashMap<const Font*, CharacterFallbackMap> m_characterFallbackMaps;
+
+    // Coarser memo keyed by the starting code point of a 256-code-point coverage block.
+    // Scripts like CJK and emoji resolve to the same fallback font for entire blocks, so a
+    // block's first resolution can satisfy later characters (after a cmap check) without
+    // another platform lookup.
+    HashMap<const Font*, CharacterFallbackMap> m_blockFallbackMaps;
 };
 
 } // namespace WebCore
@@ -165,6 +165,8 @@ public:
     {
         m_singleCharMap.clear();
         m_map.clear();
+        m_previousSingleCharMap.clear();
+        m_previousMap.clear();
     }
 
 private:
@@ -178,6 +180,13 @@ private:
             SingleCharMap::AddResult addResult = m_singleCharMap.fastAdd(text[0], entry);
             isNewEntry = addResult.isNewEntry;
             value = &addResult.iterator->value;
+            if (isNewEntry) {
+                auto previousEntry = m_previousSingleCharMap.find(text[0]);
+                if (previousEntry != m_previousSingleCharMap.end()) {
+                    *value = previousEntry->value;
+                    isNewEntry = false;
+                }
+            }
         } else {
             SmallStringKey smallStringKey;
             if (text.is8Bit())
@@ -188,6 +197,13 @@ private:
             Map::AddResult addResult = m_map.fastAdd(smallStringKey, entry);
             isNewEntry = addResult.isNewEntry;
             value = &addResult.iterator->value;
+            if (isNewEntry) {
+                auto previousEntry = m_previousMap.find(smallStringKey);
+                if (previousEntry != m_previousMap.end()) {
+                    *value = previousEntry->value;
+                    isNewEntry = false;
+                }
+            }
         }
 
         // Cache hit: ramp up by sampling the next few words.
@@ -204,9 +220,10 @@ private:
         if ((m_singleCharMap.size() + m_map.size()) < s_maxSize)
             return value;
 
-        // No need to be fancy: we're just trying to avoid pathological growth.
-        m_singleCharMap.clear();
-        m_map.clear();
+        // Age rather than dropping everything: retire the current generation so words that
+        // are still hot get promoted back on their next use instead of being re-measured.
+        m_previousSingleCharMap = std::exchange(m_singleCharMap, { });
+        m_previousMap = std::exchange(m_map, { });
         return nullptr;
     }
 
@@ -214,12 +231,14 @@ private:
     typedef HashMap<uint32_t, float, DefaultHash<uint32_t>, WTF::UnsignedWithZeroKeyHashTraits<uint32_t>> SingleCharMap;
     static const int s_minInterval = -3; // A cache hit pays for about 3 cache misses.
     static const int s_maxInterval = 20; // Sampling at this interval has almost no overhead.
-    static const int s_maxSize = 500000; // Just enough to guard against pathological growth.
+    static const int s_maxSize = 250000; // Both generations together stay within the old cap on pathological growth.
 
     int m_interval;
     int m_countdown;
     SingleCharMap m_singleCharMap;
     Map m_map;
+    SingleCharMap m_previousSingleCharMap;
+    Map m_previousMap;
 };
 
 inline bool operator==(const WidthCache::SmallStringKey& a, const WidthCache::SmallStringKey& b)
@@ -731,6 +731,9 @@ void GraphicsLayerCA::setDrawsContent(bool drawsContent)
 
     GraphicsLayer::setDrawsContent(drawsContent);
     noteLayerPropertyChanged(DrawsContentChanged | DebugIndicatorsChanged);
+
+    if (!drawsContent)
+        m_displayList = nullptr;
 }
 
 void GraphicsLayerCA::setContentsVisible(bool contentsVisible)
@@ -771,6 +774,11 @@ void GraphicsLayerCA::setUsesDisplayListDrawing(bool usesDisplayListDrawing)
 
     setNeedsDisplay();
     GraphicsLayer::setUsesDisplayListDrawing(usesDisplayListDrawing);
+
+    // Drop any cached recording so we don't keep replaying a stale display list
+    // once recording stops happening at commit time.
+    if (!usesDisplayListDrawing)
+        m_displayList = nullptr;
 }
 
 #if HAVE(CORE_ANIMATION_SEPARATED_LAYERS)
@@ -953,10 +961,29 @@ void GraphicsLayerCA::setNeedsDisplayInRect(const FloatRect& r, ShouldClipToLaye
             return;
     }
 
+    // Drop rects the new one covers so repeated overlapping invalidations don't accumulate.
+    m_dirtyRects.removeAllMatching([&](auto& dirtyRect) {
+        return rect.contains(dirtyRect);
+    });
+
     if (m_dirtyRects.size() < maxDirtyRects)
         m_dirtyRects.append(rect);
-    else
-        m_dirtyRects[0].unite(rect);
+    else {
+        // Unite with the rect this grows the least, so distant areas of the layer don't get glued
+        // into one large rect that invalidates the unchanged tiles between them.
+        size_t bestIndex = 0;
+        float leastAddedArea = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < m_dirtyRects.size(); ++i) {
+            auto united = m_dirtyRects[i];
+            united.unite(rect);
+            float addedArea = united.area() - m_dirtyRects[i].area();
+            if (addedArea < leastAddedArea) {
+                leastAddedArea = addedArea;
+                bestIndex = i;
+            }
+        }
+        m_dirtyRects[bestIndex].unite(rect);
+    }
 
     noteLayerPropertyChanged(DirtyRectsChanged);
 }
@@ -1833,6 +1860,11 @@ void GraphicsLayerCA::recursiveCommitChanges(CommitState& commitState, const Tra
     if (layerTypeChanged)
         client().didChangePlatformLayerForLayer(this);
 
+    // FIXME: Recording happens serially here, one layer per flush, even though each layer's
+    // recording is independent. Fanning the recordings out to a worker pool would need the
+    // paint-time render tree walk (RenderLayer painting, FontCascade and glyph caches) to be
+    // safe off the main thread, which it currently is not; replay already happens on the
+    // painting threads.
     if (usesDisplayListDrawing() && m_drawsContent && (!m_hasEverPainted || hadDirtyRects)) {
         TraceScope tracingScope(DisplayListRecordStart, DisplayListRecordEnd);
 
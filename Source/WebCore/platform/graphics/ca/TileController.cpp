@@ -513,6 +513,11 @@ bool TileController::shouldAggressivelyRetainTiles() const
 
 bool TileController::shouldTemporarilyRetainTileCohorts() const
 {
+    // Retained cohorts are pure scroll-back optimization; under memory pressure their
+    // backing stores are the cheapest thing to give back.
+    if (MemoryPressureHandler::singleton().isUnderMemoryPressure())
+        return false;
+
     return owningGraphicsLayer()->platformCALayerShouldTemporarilyRetainTileCohorts(m_tileCacheLayer);
 }
 
@@ -35,6 +35,7 @@
 #include "PlatformCALayer.h"
 #include "TileController.h"
 #include <wtf/MainThread.h>
+#include <wtf/MemoryPressureHandler.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/TextStream.h>
 
@@ -525,7 +526,10 @@ void TileGrid::cohortRemovalTimerFired()
         return;
     }
 
-    while (!m_cohortList.isEmpty() && m_cohortList.first().timeUntilExpiration() < 0_s) {
+    // Expire every cohort right away under memory pressure rather than letting each live
+    // out its lifetime.
+    bool isUnderMemoryPressure = MemoryPressureHandler::singleton().isUnderMemoryPressure();
+    while (!m_cohortList.isEmpty() && (isUnderMemoryPressure || m_cohortList.first().timeUntilExpiration() < 0_s)) {
         TileCohortInfo firstCohort = m_cohortList.takeFirst();
         removeTilesInCohort(firstCohort.cohort);
     }
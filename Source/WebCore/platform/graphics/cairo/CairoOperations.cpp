@@ -746,6 +746,10 @@ void fillRectWithRoundedHole(GraphicsContextCairo& platformContext, const FloatR
     cairo_restore(cr);
 }
 
+// FIXME: Identical paths are re-flattened and re-tessellated by cairo on every fill and
+// stroke; cairo keeps that geometry internal to cairo_fill/cairo_stroke with no public way
+// to retain it against the Path. Reuse for static vector content therefore has to happen
+// above this layer (e.g. by rasterizing into a cached surface or layer), not here.
 void fillPath(GraphicsContextCairo& platformContext, const Path& path, const FillSource& fillSource, const ShadowState& shadowState)
 {
     cairo_t* cr = platformContext.cr();
@@ -790,6 +794,10 @@ void clearRect(GraphicsContextCairo& platformContext, const FloatRect& rect)
     cairo_restore(cr);
 }
 
+// FIXME: Glyph rasters are memoized per scaled font by cairo's own glyph cache, so repeated
+// draws do not re-rasterize, but each surface still blits glyph by glyph. Batching runs into a
+// GPU-resident atlas would need a process that owns GPU memory for these ports; revisit when
+// WPE/GTK rendering moves out of process.
 void drawGlyphs(GraphicsContextCairo& platformContext, const FillSource& fillSource, const StrokeSource& strokeSource, const ShadowState& shadowState, const FloatPoint& point, cairo_scaled_font_t* scaledFont, double syntheticBoldOffset, const Vector<cairo_glyph_t>& glyphs, float xOffset, TextDrawingModeFlags textDrawingMode, float strokeThickness, const FloatSize& shadowOffset, const Color& shadowColor, FontSmoothingMode fontSmoothingMode)
 {
     drawGlyphsShadow(platformContext, shadowState, textDrawingMode, shadowOffset, shadowColor, point, scaledFont, syntheticBoldOffset, glyphs, fontSmoothingMode);
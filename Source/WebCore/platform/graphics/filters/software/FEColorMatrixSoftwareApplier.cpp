@@ -32,6 +32,8 @@
 
 #if USE(ACCELERATE)
 #include <Accelerate/Accelerate.h>
+#else
+#include <wtf/ParallelJobs.h>
 #endif
 
 namespace WebCore {
@@ -186,16 +188,14 @@ void FEColorMatrixSoftwareApplier::applyPlatformAccelerated(PixelBuffer& pixelBu
 }
 #endif
 
-void FEColorMatrixSoftwareApplier::applyPlatformUnaccelerated(PixelBuffer& pixelBuffer) const
+void FEColorMatrixSoftwareApplier::applyPlatformUnaccelerated(PixelBuffer& pixelBuffer, unsigned startByteOffset, unsigned endByteOffset) const
 {
-    auto pixelByteLength = pixelBuffer.sizeInBytes();
-
     switch (m_effect.type()) {
     case FECOLORMATRIX_TYPE_UNKNOWN:
         break;
 
     case FECOLORMATRIX_TYPE_MATRIX:
-        for (unsigned pixelByteOffset = 0; pixelByteOffset < pixelByteLength; pixelByteOffset += 4) {
+        for (unsigned pixelByteOffset = startByteOffset; pixelByteOffset < endByteOffset; pixelByteOffset += 4) {
             float red = pixelBuffer.item(pixelByteOffset);
             float green = pixelBuffer.item(pixelByteOffset + 1);
             float blue = pixelBuffer.item(pixelByteOffset + 2);
@@ -210,7 +210,7 @@ void FEColorMatrixSoftwareApplier::applyPlatformUnaccelerated(PixelBuffer& pixel
 
     case FECOLORMATRIX_TYPE_SATURATE:
     case FECOLORMATRIX_TYPE_HUEROTATE:
-        for (unsigned pixelByteOffset = 0; pixelByteOffset < pixelByteLength; pixelByteOffset += 4) {
+        for (unsigned pixelByteOffset = startByteOffset; pixelByteOffset < endByteOffset; pixelByteOffset += 4) {
             float red = pixelBuffer.item(pixelByteOffset);
             float green = pixelBuffer.item(pixelByteOffset + 1);
             float blue = pixelBuffer.item(pixelByteOffset + 2);
@@ -224,7 +224,7 @@ void FEColorMatrixSoftwareApplier::applyPlatformUnaccelerated(PixelBuffer& pixel
         break;
 
     case FECOLORMATRIX_TYPE_LUMINANCETOALPHA:
-        for (unsigned pixelByteOffset = 0; pixelByteOffset < pixelByteLength; pixelByteOffset += 4) {
+        for (unsigned pixelByteOffset = startByteOffset; pixelByteOffset < endByteOffset; pixelByteOffset += 4) {
             float red = pixelBuffer.item(pixelByteOffset);
             float green = pixelBuffer.item(pixelByteOffset + 1);
             float blue = pixelBuffer.item(pixelByteOffset + 2);
@@ -239,6 +239,11 @@ void FEColorMatrixSoftwareApplier::applyPlatformUnaccelerated(PixelBuffer& pixel
     }
 }
 
+void FEColorMatrixSoftwareApplier::applyPlatformWorker(ApplyParameters* parameters)
+{
+    parameters->applier->applyPlatformUnaccelerated(*parameters->pixelBuffer, parameters->startByteOffset, parameters->endByteOffset);
+}
+
 void FEColorMatrixSoftwareApplier::applyPlatform(PixelBuffer& pixelBuffer) const
 {
 #if USE(ACCELERATE)
@@ -250,8 +255,37 @@ void FEColorMatrixSoftwareApplier::applyPlatform(PixelBuffer& pixelBuffer) const
         applyPlatformAccelerated(pixelBuffer);
         return;
     }
+    applyPlatformUnaccelerated(pixelBuffer, 0, pixelBuffer.sizeInBytes());
+#else
+    unsigned pixelByteLength = pixelBuffer.sizeInBytes();
+    unsigned pixelCount = pixelByteLength / 4;
+
+    // The matrix is applied independently per pixel, so split the buffer into
+    // per-pixel-aligned ranges, the same way the other software appliers do.
+    static constexpr unsigned minimalRectDimension = 100 * 100; // Empirical data limit for parallel jobs
+    unsigned optimalThreadNumber = pixelCount / minimalRectDimension;
+    if (optimalThreadNumber > 1) {
+        ParallelJobs<ApplyParameters> parallelJobs(&applyPlatformWorker, optimalThreadNumber);
+        auto numOfThreads = parallelJobs.numberOfJobs();
+        if (numOfThreads > 1) {
+            unsigned jobSize = (pixelCount / numOfThreads) * 4;
+            unsigned currentByteOffset = 0;
+            for (int job = 0; job < numOfThreads; ++job) {
+                auto& params = parallelJobs.parameter(job);
+                params.applier = this;
+                params.pixelBuffer = &pixelBuffer;
+                params.startByteOffset = currentByteOffset;
+                currentByteOffset = job == numOfThreads - 1 ? pixelByteLength : currentByteOffset + jobSize;
+                params.endByteOffset = currentByteOffset;
+            }
+            parallelJobs.execute();
+            return;
+        }
+        // Fallback to single thread model
+    }
+
+    applyPlatformUnaccelerated(pixelBuffer, 0, pixelByteLength);
 #endif
-    applyPlatformUnaccelerated(pixelBuffer);
 }
 
 bool FEColorMatrixSoftwareApplier::apply(const Filter&, const FilterImageVector& inputs, FilterImage& result) const
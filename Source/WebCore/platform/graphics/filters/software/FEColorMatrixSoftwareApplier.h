@@ -39,6 +39,13 @@ public:
 private:
     bool apply(const Filter&, const FilterImageVector& inputs, FilterImage& result) const final;
 
+    struct ApplyParameters {
+        const FEColorMatrixSoftwareApplier* applier;
+        PixelBuffer* pixelBuffer;
+        unsigned startByteOffset;
+        unsigned endByteOffset;
+    };
+
     inline void matrix(float& red, float& green, float& blue, float& alpha) const;
     inline void saturateAndHueRotate(float& red, float& green, float& blue) const;
     inline void luminance(float& red, float& green, float& blue, float& alpha) const;
@@ -46,7 +53,8 @@ private:
 #if USE(ACCELERATE)
     void applyPlatformAccelerated(PixelBuffer&) const;
 #endif
-    void applyPlatformUnaccelerated(PixelBuffer&) const;
+    void applyPlatformUnaccelerated(PixelBuffer&, unsigned startByteOffset, unsigned endByteOffset) const;
+    static void applyPlatformWorker(ApplyParameters*);
 
     void applyPlatform(PixelBuffer&) const;
 
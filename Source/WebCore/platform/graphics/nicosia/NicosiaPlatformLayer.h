@@ -293,10 +293,85 @@ public:
     void commitState(const T& functor)
     {
         Locker locker { PlatformLayer::m_state.lock };
-        m_state.committed = m_state.staging;
-        m_state.staging.delta = { };
-
-        functor(m_state.committed);
+        auto& staging = m_state.staging;
+        auto& committed = m_state.committed;
+
+        // Staging only ever diverges from the committed state through delta-flagged
+        // merges in flushState(), so copying just the flagged properties keeps the two
+        // in sync while avoiding a full deep copy (filters, animations, children,
+        // event region) for every layer on every scene update.
+        committed.delta.value = staging.delta.value;
+
+        if (staging.delta.positionChanged)
+            committed.position = staging.position;
+        if (staging.delta.anchorPointChanged)
+            committed.anchorPoint = staging.anchorPoint;
+        if (staging.delta.sizeChanged)
+            committed.size = staging.size;
+        if (staging.delta.boundsOriginChanged)
+            committed.boundsOrigin = staging.boundsOrigin;
+
+        if (staging.delta.transformChanged)
+            committed.transform = staging.transform;
+        if (staging.delta.childrenTransformChanged)
+            committed.childrenTransform = staging.childrenTransform;
+
+        if (staging.delta.contentsRectChanged)
+            committed.contentsRect = staging.contentsRect;
+        if (staging.delta.contentsTilingChanged) {
+            committed.contentsTilePhase = staging.contentsTilePhase;
+            committed.contentsTileSize = staging.contentsTileSize;
+        }
+        if (staging.delta.contentsClippingRectChanged)
+            committed.contentsClippingRect = staging.contentsClippingRect;
+
+        if (staging.delta.opacityChanged)
+            committed.opacity = staging.opacity;
+        if (staging.delta.solidColorChanged)
+            committed.solidColor = staging.solidColor;
+
+        if (staging.delta.filtersChanged)
+            committed.filters = staging.filters;
+        if (staging.delta.backdropFiltersChanged)
+            committed.backdropLayer = staging.backdropLayer;
+        if (staging.delta.backdropFiltersRectChanged)
+            committed.backdropFiltersRect = staging.backdropFiltersRect;
+        if (staging.delta.animationsChanged)
+            committed.animations = staging.animations;
+
+        if (staging.delta.childrenChanged)
+            committed.children = staging.children;
+        if (staging.delta.maskChanged)
+            committed.mask = staging.mask;
+        if (staging.delta.replicaChanged)
+            committed.replica = staging.replica;
+
+        if (staging.delta.flagsChanged)
+            committed.flags.value = staging.flags.value;
+
+        if (staging.delta.repaintCounterChanged)
+            committed.repaintCounter = staging.repaintCounter;
+        if (staging.delta.debugBorderChanged)
+            committed.debugBorder = staging.debugBorder;
+
+        if (staging.delta.scrollingNodeChanged)
+            committed.scrollingNodeID = staging.scrollingNodeID;
+
+        if (staging.delta.eventRegionChanged)
+            committed.eventRegion = staging.eventRegion;
+
+        if (staging.delta.backingStoreChanged)
+            committed.backingStore = staging.backingStore;
+        if (staging.delta.contentLayerChanged)
+            committed.contentLayer = staging.contentLayer;
+        if (staging.delta.imageBackingChanged)
+            committed.imageBacking = staging.imageBacking;
+        if (staging.delta.animatedBackingStoreClientChanged)
+            committed.animatedBackingStoreClient = staging.animatedBackingStoreClient;
+
+        staging.delta = { };
+
+        functor(committed);
     }
 
     template<typename T>
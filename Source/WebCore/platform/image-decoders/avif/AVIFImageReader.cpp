@@ -38,6 +38,11 @@ AVIFImageReader::AVIFImageReader(RefPtr<AVIFImageDecoder>&& decoder)
     : m_decoder(WTFMove(decoder))
     , m_avifDecoder(avifDecoderCreate())
 {
+#if AVIF_VERSION >= 100000
+    // Lets the decoder hand back fully decoded row bands of a truncated image
+    // so they can be painted before the rest of the data arrives.
+    m_avifDecoder->allowIncremental = AVIF_TRUE;
+#endif
 }
 
 AVIFImageReader::~AVIFImageReader() = default;
@@ -79,8 +84,17 @@ void AVIFImageReader::decodeFrame(size_t frameIndex, ScalableImageDecoderFrame&
             m_dataParsed = true;
     }
 
-    if (avifDecoderNthImage(m_avifDecoder.get(), frameIndex) != AVIF_RESULT_OK) {
-        m_decoder->setFailed();
+    avifResult decodeResult = avifDecoderNthImage(m_avifDecoder.get(), frameIndex);
+    if (decodeResult != AVIF_RESULT_OK) {
+#if AVIF_VERSION >= 100000
+        if (decodeResult == AVIF_RESULT_WAITING_ON_IO && !m_decoder->isAllDataReceived()) {
+            decodePartialFrame(buffer);
+            return;
+        }
+#endif
+        // A truncated stream is not a failure while more data is still expected.
+        if (m_decoder->isAllDataReceived())
+            m_decoder->setFailed();
         return;
     }
 
@@ -109,6 +123,46 @@ void AVIFImageReader::decodeFrame(size_t frameIndex, ScalableImageDecoderFrame&
     buffer.setDecodingStatus(DecodingStatus::Complete);
 }
 
+#if AVIF_VERSION >= 100000
+void AVIFImageReader::decodePartialFrame(ScalableImageDecoderFrame& buffer)
+{
+    uint32_t decodedRowCount = avifDecoderDecodedRowCount(m_avifDecoder.get());
+    if (!decodedRowCount)
+        return;
+
+    IntSize imageSize(m_decoder->size());
+    if (buffer.isInvalid() && !buffer.initialize(imageSize, m_decoder->premultiplyAlpha())) {
+        m_decoder->setFailed();
+        return;
+    }
+
+    buffer.setDecodingStatus(DecodingStatus::Partial);
+
+    // Convert just the band of rows the decoder has finished into the top of the
+    // frame buffer; the remaining rows stay transparent until more data arrives.
+    avifCropRect decodedBand { 0, 0, static_cast<uint32_t>(imageSize.width()), decodedRowCount };
+    avifImage* bandImage = avifImageCreateEmpty();
+    if (avifImageSetViewRect(bandImage, m_avifDecoder->image, &decodedBand) != AVIF_RESULT_OK) {
+        avifImageDestroy(bandImage);
+        return;
+    }
+
+    avifRGBImage decodedRGBImage;
+    avifRGBImageSetDefaults(&decodedRGBImage, bandImage);
+    decodedRGBImage.depth = 8;
+    decodedRGBImage.alphaPremultiplied = m_decoder->premultiplyAlpha();
+    decodedRGBImage.format = AVIF_RGB_FORMAT_BGRA;
+    decodedRGBImage.rowBytes = imageSize.width() * sizeof(uint32_t);
+    decodedRGBImage.pixels = reinterpret_cast<uint8_t*>(buffer.backingStore()->pixelAt(0, 0));
+    if (avifImageYUVToRGB(bandImage, &decodedRGBImage) != AVIF_RESULT_OK)
+        m_decoder->setFailed();
+    else
+        buffer.setHasAlpha(avifRGBFormatHasAlpha(decodedRGBImage.format));
+
+    avifImageDestroy(bandImage);
+}
+#endif
+
 size_t AVIFImageReader::imageCount() const
 {
     return m_avifDecoder->imageCount;
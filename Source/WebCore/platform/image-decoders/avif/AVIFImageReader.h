@@ -44,6 +44,9 @@ public:
     size_t imageCount() const;
 
 private:
+#if AVIF_VERSION >= 100000
+    void decodePartialFrame(ScalableImageDecoderFrame&);
+#endif
     RefPtr<WebCore::AVIFImageDecoder> m_decoder;
     AVIFUniquePtr<avifDecoder> m_avifDecoder;
 
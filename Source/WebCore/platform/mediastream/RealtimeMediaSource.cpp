@@ -231,6 +231,14 @@ void RealtimeMediaSource::updateHasStartedProducingData()
     });
 }
 
+// The VideoFrame delivered here is a handle, not pixels: platform sources hand
+// out frames backed by IOSurface/CVPixelBuffer (or the platform equivalent), and
+// with the GPU process enabled, web content sees a RemoteVideoFrameProxy whose
+// pixel data never enters web process memory. Canvas drawImage and WebGL
+// texImage2D consume the frame in the GPU process via the video frame object
+// heap. CPU time attributed to "frame copies" on this path usually means a
+// consumer forced a readback (e.g. getImageData, or a pixel format the GPU
+// upload path rejects), not a copy made here.
 void RealtimeMediaSource::videoFrameAvailable(VideoFrame& videoFrame, VideoFrameTimeMetadata metadata)
 {
 #if !RELEASE_LOG_DISABLED
@@ -34,6 +34,10 @@ namespace WebCore {
 
 // FIXME: Not every header fits into a map. Notably, multiple Set-Cookie header fields are needed to set multiple cookies.
 
+// Common header names are tokenized to HTTPHeaderName once, when the map is populated, and stay
+// tokenized across IPC: the generated argument coders transfer CommonHeader with the enum key, so
+// the receiving process never re-parses header names. Only the disk cache serializes names as
+// strings, deliberately, to keep stored entries valid across HTTPHeaderNames.in changes.
 class HTTPHeaderMap {
 public:
     struct CommonHeader {
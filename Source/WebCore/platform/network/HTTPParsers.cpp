@@ -799,8 +799,7 @@ bool isForbiddenHeader(const String& name, StringView value)
     if (isForbiddenHeaderName(name))
         return true;
     if (equalLettersIgnoringASCIICase(name, "x-http-method-override"_s) || equalLettersIgnoringASCIICase(name, "x-http-method"_s) || equalLettersIgnoringASCIICase(name, "x-method-override"_s)) {
-        for (auto methodValue : StringView(value).split(',')) {
-            auto method = methodValue.stripWhiteSpace();
+        for (auto method : value.splitStrippingMatchedCharacters(',', isASCIISpace<UChar>)) {
             if (isForbiddenMethod(method))
                 return true;
         }
@@ -33,6 +33,7 @@
 #include <wtf/HashSet.h>
 #include <wtf/WallTime.h>
 #include <wtf/text/StringHash.h>
+#include <wtf/text/StringView.h>
 
 namespace WebCore {
 
@@ -128,49 +129,14 @@ inline StringView stripLeadingAndTrailingHTTPSpaces(StringView string)
     return string.stripLeadingAndTrailingMatchedCharacters(isHTTPSpace);
 }
 
-template<class HashType>
-bool addToAccessControlAllowList(const String& string, unsigned start, unsigned end, HashSet<String, HashType>& set)
-{
-    StringImpl* stringImpl = string.impl();
-    if (!stringImpl)
-        return true;
-
-    // Skip white space from start.
-    while (start <= end && isHTTPSpace((*stringImpl)[start]))
-        ++start;
-
-    // only white space
-    if (start > end)
-        return true;
-
-    // Skip white space from end.
-    while (end && isHTTPSpace((*stringImpl)[end]))
-        --end;
-
-    auto token = string.substring(start, end - start + 1);
-    if (!isValidHTTPToken(token))
-        return false;
-
-    set.add(WTFMove(token));
-    return true;
-}
-
 template<class HashType = DefaultHash<String>>
 std::optional<HashSet<String, HashType>> parseAccessControlAllowList(const String& string)
 {
     HashSet<String, HashType> set;
-    unsigned start = 0;
-    size_t end;
-    while ((end = string.find(',', start)) != notFound) {
-        if (start != end) {
-            if (!addToAccessControlAllowList(string, start, end - 1, set))
-                return { };
-        }
-        start = end + 1;
-    }
-    if (start != string.length()) {
-        if (!addToAccessControlAllowList(string, start, string.length() - 1, set))
+    for (auto token : StringView(string).splitStrippingMatchedCharacters(',', isHTTPSpace)) {
+        if (!isValidHTTPToken(token))
             return { };
+        set.add(token.toString());
     }
     return set;
 }
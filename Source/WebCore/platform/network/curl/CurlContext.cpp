@@ -529,7 +529,9 @@ void CurlHandle::setHttpCustomRequest(const String& method)
 
 void CurlHandle::enableAcceptEncoding()
 {
-    // enable all supported built-in compressions (gzip and deflate) through Accept-Encoding:
+    // An empty string advertises and decodes every content coding libcurl was built with:
+    // gzip and deflate always, brotli and zstd when the library has them. Decoding runs
+    // inline on the curl worker thread, off the main thread, as each chunk arrives.
     curl_easy_setopt(m_handle, CURLOPT_ACCEPT_ENCODING, "");
 }
 
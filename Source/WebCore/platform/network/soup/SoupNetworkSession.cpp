@@ -119,6 +119,9 @@ SoupNetworkSession::SoupNetworkSession(PAL::SessionID sessionID)
         "timeout", 0,
         nullptr));
 
+    // Content decoding (gzip, deflate and brotli) is handled by libsoup's default
+    // SoupContentDecoder feature. FIXME: libsoup has no zstd support; advertising and decoding
+    // zstd here would need a custom SoupContentProcessor wrapping a streaming zstd context.
     soup_session_add_feature_by_type(m_soupSession.get(), SOUP_TYPE_CONTENT_SNIFFER);
     soup_session_add_feature_by_type(m_soupSession.get(), SOUP_TYPE_AUTH_NTLM);
 #if SOUP_CHECK_VERSION(2, 67, 1)
@@ -284,6 +284,10 @@ bool SQLiteDatabase::useWALJournalMode()
 
 void SQLiteDatabase::close()
 {
+    // Cached statements hold sqlite3 statement handles, which must be finalized
+    // before the database handle is closed.
+    m_cachedStatements.clear();
+
     if (m_db) {
         ASSERT_WITH_MESSAGE(!m_statementCount, "All SQLiteTransaction objects should be destroyed before closing the database");
 
@@ -790,4 +794,30 @@ Expected<UniqueRef<SQLiteStatement>, int> SQLiteDatabase::prepareHeapStatement(A
     return UniqueRef<SQLiteStatement>(*new SQLiteStatement(*this, sqlStatement.value()));
 }
 
+SQLiteStatementAutoResetScope SQLiteDatabase::cachedStatement(ASCIILiteral query)
+{
+    // Queries are compile-time literals, so entries are keyed by character pointer.
+    // The vector is kept in most-recently-used order; with the small cap a linear
+    // scan beats hashing the query text.
+    for (size_t i = 0; i < m_cachedStatements.size(); ++i) {
+        if (m_cachedStatements[i].query == query.characters()) {
+            if (i) {
+                auto entry = WTFMove(m_cachedStatements[i]);
+                m_cachedStatements.remove(i);
+                m_cachedStatements.insert(0, WTFMove(entry));
+            }
+            return SQLiteStatementAutoResetScope { m_cachedStatements[0].statement.get() };
+        }
+    }
+
+    auto statement = prepareHeapStatement(query);
+    if (!statement)
+        return SQLiteStatementAutoResetScope { };
+
+    if (m_cachedStatements.size() >= maximumCachedStatementCount)
+        m_cachedStatements.removeLast();
+    m_cachedStatements.insert(0, CachedStatement { query.characters(), statement.value().moveToUniquePtr() });
+    return SQLiteStatementAutoResetScope { m_cachedStatements[0].statement.get() };
+}
+
 } // namespace WebCore
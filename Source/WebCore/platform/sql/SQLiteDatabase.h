@@ -26,12 +26,14 @@
 
 #pragma once
 
+#include "SQLiteStatementAutoResetScope.h"
 #include <functional>
 #include <sqlite3.h>
 #include <wtf/Expected.h>
 #include <wtf/Lock.h>
 #include <wtf/Threading.h>
 #include <wtf/UniqueRef.h>
+#include <wtf/Vector.h>
 #include <wtf/WeakPtr.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/WTFString.h>
@@ -80,6 +82,13 @@ public:
     WEBCORE_EXPORT Expected<UniqueRef<SQLiteStatement>, int> prepareHeapStatementSlow(StringView query);
     WEBCORE_EXPORT Expected<UniqueRef<SQLiteStatement>, int> prepareHeapStatement(ASCIILiteral query);
 
+    // Compiles the query at most once per database and hands the statement out
+    // wrapped in a scope that resets its bindings on destruction. Returns a null
+    // scope on preparation failure. A given query must not be in use through two
+    // scopes at once, and a scope must not be held across many distinct
+    // cachedStatement() calls, since least-recently-used entries are evicted.
+    WEBCORE_EXPORT SQLiteStatementAutoResetScope cachedStatement(ASCIILiteral query);
+
     // Aborts the current database operation. This is thread safe.
     WEBCORE_EXPORT void interrupt();
 
@@ -197,6 +206,13 @@ private:
 
     int m_openError { SQLITE_ERROR };
     CString m_openErrorMessage;
+
+    static constexpr size_t maximumCachedStatementCount { 64 };
+    struct CachedStatement {
+        const char* query { nullptr };
+        std::unique_ptr<SQLiteStatement> statement;
+    };
+    Vector<CachedStatement> m_cachedStatements;
 };
 
 inline void SQLiteDatabase::incrementStatementCount()
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <wtf/Deque.h>
+#include <wtf/Span.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebCore {
@@ -62,6 +63,15 @@ public:
     void advancePastNonNewline(); // Faster than calling advance when we know the current character is not a newline.
     void advancePastNewline(); // Faster than calling advance when we know the current character is a newline.
 
+    // The remaining characters of the current substring, starting at the current
+    // character. Empty when the current substring is 16-bit or exhausted.
+    Span<const LChar> currentSubstring8() const;
+
+    // Faster than count calls to advancePastNonNewline for a run previously obtained
+    // from currentSubstring8. The run must not contain newlines, and at least one
+    // character of the substring must remain after it.
+    void advancePastRunWithoutNewlines(unsigned count);
+
     enum AdvancePastResult { DidNotMatch, DidMatch, NotEnoughCharacters };
     template<unsigned length> AdvancePastResult advancePast(const char (&literal)[length]) { return advancePast<length, false>(literal); }
     template<unsigned length> AdvancePastResult advancePastLettersIgnoringASCIICase(const char (&literal)[length]) { return advancePast<length, true>(literal); }
@@ -257,6 +267,25 @@ inline void SegmentedString::advancePastNewline()
     (this->*m_advanceAndUpdateLineNumberFunction)();
 }
 
+ALWAYS_INLINE Span<const LChar> SegmentedString::currentSubstring8() const
+{
+    if (!m_currentSubstring.length || !m_currentSubstring.is8Bit)
+        return { };
+    return { m_currentSubstring.currentCharacter8, m_currentSubstring.length };
+}
+
+ALWAYS_INLINE void SegmentedString::advancePastRunWithoutNewlines(unsigned count)
+{
+    ASSERT(count);
+    ASSERT(count < m_currentSubstring.length);
+    ASSERT(m_currentSubstring.is8Bit);
+    m_currentSubstring.currentCharacter8 += count;
+    m_currentCharacter = *m_currentSubstring.currentCharacter8;
+    m_currentSubstring.length -= count;
+    if (UNLIKELY(m_currentSubstring.length == 1))
+        updateAdvanceFunctionPointersForSingleCharacterSubstring();
+}
+
 inline unsigned SegmentedString::numberOfCharactersConsumed() const
 {
     return m_numberOfCharactersConsumedPriorToCurrentSubstring + m_currentSubstring.numberOfCharactersConsumed();
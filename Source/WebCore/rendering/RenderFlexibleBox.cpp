@@ -1314,6 +1314,34 @@ void RenderFlexibleBox::layoutFlexItems(bool relayoutChildren)
     Vector<FlexItem> lineItems;
     size_t nextIndex = 0;
     size_t numLines = 0;
+
+    // Resolving flexible lengths is a pure function of the line's inputs, so consecutive lines
+    // with identical item structure and constraints (the common shape of virtualized row content)
+    // can reuse the previous line's resolved main sizes instead of re-running the freeze/resolve loops.
+    struct ItemResolutionInput {
+        LayoutUnit flexBaseContentSize;
+        LayoutUnit hypotheticalMainContentSize;
+        std::pair<LayoutUnit, LayoutUnit> minMaxSizes;
+        float flexGrow { 0 };
+        float flexShrink { 0 };
+        bool operator==(const ItemResolutionInput& other) const
+        {
+            return flexBaseContentSize == other.flexBaseContentSize
+                && hypotheticalMainContentSize == other.hypotheticalMainContentSize
+                && minMaxSizes == other.minMaxSizes
+                && flexGrow == other.flexGrow
+                && flexShrink == other.flexShrink;
+        }
+    };
+    std::optional<LayoutUnit> previousLineContainerMainInnerSize;
+    // The line-level sums are margin-box sums, so they also capture each item's
+    // main-axis margin, border, and padding, which the per-item content inputs do
+    // not; free space and flex sign are derived from them.
+    LayoutUnit previousLineSumFlexBaseSize;
+    LayoutUnit previousLineSumHypotheticalMainSize;
+    Vector<ItemResolutionInput> previousLineInputs;
+    Vector<LayoutUnit> previousLineResolvedMainSizes;
+
     InspectorInstrumentation::flexibleBoxRendererBeganLayout(*this);
     while (flexAlgorithm.computeNextFlexLine(nextIndex, lineItems, sumFlexBaseSize, totalFlexGrow, totalFlexShrink, totalWeightedFlexShrink, sumHypotheticalMainSize)) {
         ++numLines;
@@ -1330,24 +1358,37 @@ void RenderFlexibleBox::layoutFlexItems(bool relayoutChildren)
             }
         }
         LayoutUnit containerMainInnerSize = mainAxisContentExtent(sumHypotheticalMainSize);
-        // availableFreeSpace is the initial amount of free space in this flexbox.
-        // remainingFreeSpace starts out at the same value but as we place and lay
-        // out flex items we subtract from it. Note that both values can be
-        // negative.
-        LayoutUnit remainingFreeSpace = containerMainInnerSize - sumFlexBaseSize;
-        FlexSign flexSign = (sumHypotheticalMainSize < containerMainInnerSize) ? PositiveFlexibility : NegativeFlexibility;
-        freezeInflexibleItems(flexSign, lineItems, remainingFreeSpace, totalFlexGrow, totalFlexShrink, totalWeightedFlexShrink);
-        // The initial free space gets calculated after freezing inflexible items.
-        // https://drafts.csswg.org/css-flexbox/#resolve-flexible-lengths step 3
-        const LayoutUnit initialFreeSpace = remainingFreeSpace;
-        while (!resolveFlexibleLengths(flexSign, lineItems, initialFreeSpace, remainingFreeSpace, totalFlexGrow, totalFlexShrink, totalWeightedFlexShrink)) {
-            ASSERT(totalFlexGrow >= 0);
-            ASSERT(totalWeightedFlexShrink >= 0);
+        auto lineInputs = lineItems.map([](auto& flexItem) {
+            return ItemResolutionInput { flexItem.flexBaseContentSize, flexItem.hypotheticalMainContentSize, flexItem.minMaxSizes, flexItem.box.style().flexGrow(), flexItem.box.style().flexShrink() };
+        });
+        if (previousLineContainerMainInnerSize == containerMainInnerSize && previousLineSumFlexBaseSize == sumFlexBaseSize && previousLineSumHypotheticalMainSize == sumHypotheticalMainSize && previousLineInputs == lineInputs) {
+            for (size_t i = 0; i < lineItems.size(); ++i)
+                lineItems[i].flexedContentSize = previousLineResolvedMainSizes[i];
+        } else {
+            // availableFreeSpace is the initial amount of free space in this flexbox.
+            // remainingFreeSpace starts out at the same value but as we place and lay
+            // out flex items we subtract from it. Note that both values can be
+            // negative.
+            LayoutUnit remainingFreeSpace = containerMainInnerSize - sumFlexBaseSize;
+            FlexSign flexSign = (sumHypotheticalMainSize < containerMainInnerSize) ? PositiveFlexibility : NegativeFlexibility;
+            freezeInflexibleItems(flexSign, lineItems, remainingFreeSpace, totalFlexGrow, totalFlexShrink, totalWeightedFlexShrink);
+            // The initial free space gets calculated after freezing inflexible items.
+            // https://drafts.csswg.org/css-flexbox/#resolve-flexible-lengths step 3
+            const LayoutUnit initialFreeSpace = remainingFreeSpace;
+            while (!resolveFlexibleLengths(flexSign, lineItems, initialFreeSpace, remainingFreeSpace, totalFlexGrow, totalFlexShrink, totalWeightedFlexShrink)) {
+                ASSERT(totalFlexGrow >= 0);
+                ASSERT(totalWeightedFlexShrink >= 0);
+            }
+            previousLineContainerMainInnerSize = containerMainInnerSize;
+            previousLineSumFlexBaseSize = sumFlexBaseSize;
+            previousLineSumHypotheticalMainSize = sumHypotheticalMainSize;
+            previousLineInputs = WTFMove(lineInputs);
+            previousLineResolvedMainSizes = lineItems.map([](auto& flexItem) { return flexItem.flexedContentSize; });
         }
-        
+
         // Recalculate the remaining free space. The adjustment for flex factors
-        // between 0..1 means we can't just use remainingFreeSpace here.
-        remainingFreeSpace = containerMainInnerSize;
+        // between 0..1 means we can't just use the value tracked during resolution here.
+        LayoutUnit remainingFreeSpace = containerMainInnerSize;
         for (size_t i = 0; i < lineItems.size(); ++i) {
             FlexItem& flexItem = lineItems[i];
             ASSERT(!flexItem.box.isOutOfFlowPositioned());
@@ -528,7 +528,26 @@ static inline bool objectIsRelayoutBoundary(const RenderElement* object)
         return false;
 #endif
 
-    if (object->style().width().isIntrinsicOrAuto() || object->style().height().isIntrinsicOrAuto() || object->style().height().isPercentOrCalculated())
+    // The object can only bound relayout if its size cannot be affected by what its descendants
+    // lay out to. Sizes taken from the containing block (fixed lengths, resolvable percentages,
+    // out-of-flow boxes with both insets specified) qualify; intrinsic and auto sizes don't.
+    auto& style = object->style();
+    auto widthIsStable = [&] {
+        if (!style.width().isIntrinsicOrAuto())
+            return true;
+        return style.hasOutOfFlowPosition() && !style.left().isAuto() && !style.right().isAuto();
+    };
+    auto heightIsStable = [&] {
+        auto& height = style.height();
+        if (height.isIntrinsicOrAuto())
+            return style.hasOutOfFlowPosition() && !style.top().isAuto() && !style.bottom().isAuto();
+        // A percentage resolves against the containing block rather than the content, unless the
+        // containing block chain makes it degenerate to auto.
+        if (height.isPercentOrCalculated())
+            return is<RenderBox>(*object) && downcast<RenderBox>(*object).percentageLogicalHeightIsResolvable();
+        return true;
+    };
+    if (!widthIsStable() || !heightIsStable())
         return false;
 
     // Table parts can't be relayout roots since the table is responsible for layouting all the parts.
@@ -2639,6 +2658,10 @@ bool RenderObject::isSkippedContent() const
 
 bool RenderObject::shouldSkipContent() const
 {
+    // FIXME: Only content-visibility: hidden skips content so far; auto needs viewport relevancy
+    // bookkeeping before it can be supported. When that lands, revealing an auto subtree could be
+    // made cheaper by warming its layout from the post-layout relevancy checks before the subtree
+    // scrolls into view, instead of paying for the full layout at reveal time.
     return style().contentVisibility() == ContentVisibility::Hidden;
 }
 
@@ -42,6 +42,7 @@
 #include "SVGElement.h"
 #include "SelectorCheckerTestFunctions.h"
 #include "SelectorCompiler.h"
+#include "SelectorMatchingProfiler.h"
 #include "SelectorMatchingState.h"
 #include "ShadowRoot.h"
 #include "StyleProperties.h"
@@ -50,6 +51,7 @@
 #include "StyleScopeRuleSets.h"
 #include "StyledElement.h"
 #include "UserAgentStyle.h"
+#include <wtf/MonotonicTime.h>
 #include <wtf/SetForScope.h>
 
 namespace WebCore {
@@ -423,8 +425,10 @@ void ElementRuleCollector::matchUARules()
 
 void ElementRuleCollector::matchUARules(const RuleSet& rules)
 {
+    SetForScope isMatchingUARules(m_isMatchingUARules, true);
+
     clearMatchedRules();
-    
+
     collectMatchingRules(MatchRequest(rules));
 
     sortAndTransferMatchedRules(DeclarationOrigin::UserAgent);
@@ -542,6 +546,21 @@ void ElementRuleCollector::collectMatchingRulesForList(const RuleSet::RuleDataVe
             continue;
 
         unsigned specificity;
+        if (UNLIKELY(SelectorMatchingProfiler::isEnabled())) {
+            auto origin = [&] {
+                if (m_isMatchingUARules)
+                    return SelectorMatchingOrigin::UserAgent;
+                if (m_userStyle && &matchRequest.ruleSet == m_userStyle.get())
+                    return SelectorMatchingOrigin::User;
+                return SelectorMatchingOrigin::Author;
+            }();
+            auto startTime = MonotonicTime::now();
+            bool selectorMatches = ruleMatches(ruleData, specificity, matchRequest.styleScopeOrdinal);
+            SelectorMatchingProfiler::singleton().recordMatchAttempt(ruleData, origin, MonotonicTime::now() - startTime, selectorMatches);
+            if (selectorMatches)
+                addMatchedRule(ruleData, specificity, matchRequest);
+            continue;
+        }
         if (ruleMatches(ruleData, specificity, matchRequest.styleScopeOrdinal))
             addMatchedRule(ruleData, specificity, matchRequest);
     }
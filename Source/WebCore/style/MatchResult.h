@@ -68,14 +68,29 @@ inline bool operator!=(const MatchResult& a, const MatchResult& b)
     return !(a == b);
 }
 
+// Style attribute declarations are per-element objects, so comparing them by identity would keep
+// elements with identical inline styles from sharing a matched declarations cache entry. Immutable
+// objects can safely be compared by value; mutable ones may change after being cached.
+inline bool shouldCompareStyleAttributeDeclarationsByValue(const MatchedProperties& matchedProperties)
+{
+    return matchedProperties.fromStyleAttribute == FromStyleAttribute::Yes
+        && matchedProperties.properties
+        && !matchedProperties.properties->isMutable();
+}
+
 inline bool operator==(const MatchedProperties& a, const MatchedProperties& b)
 {
-    return a.properties == b.properties
-        && a.linkMatchType == b.linkMatchType
-        && a.allowlistType == b.allowlistType
-        && a.styleScopeOrdinal == b.styleScopeOrdinal
-        && a.fromStyleAttribute == b.fromStyleAttribute
-        && a.cascadeLayerPriority == b.cascadeLayerPriority;
+    if (a.linkMatchType != b.linkMatchType
+        || a.allowlistType != b.allowlistType
+        || a.styleScopeOrdinal != b.styleScopeOrdinal
+        || a.fromStyleAttribute != b.fromStyleAttribute
+        || a.cascadeLayerPriority != b.cascadeLayerPriority)
+        return false;
+    if (a.properties == b.properties)
+        return true;
+    if (!shouldCompareStyleAttributeDeclarationsByValue(a) || !shouldCompareStyleAttributeDeclarationsByValue(b))
+        return false;
+    return a.properties->contentsEqual(*b.properties);
 }
 
 inline bool operator!=(const MatchedProperties& a, const MatchedProperties& b)
@@ -85,8 +100,11 @@ inline bool operator!=(const MatchedProperties& a, const MatchedProperties& b)
 
 inline void add(Hasher& hasher, const MatchedProperties& matchedProperties)
 {
+    if (shouldCompareStyleAttributeDeclarationsByValue(matchedProperties))
+        add(hasher, downcast<ImmutableStyleProperties>(*matchedProperties.properties).contentHash());
+    else
+        add(hasher, matchedProperties.properties.get());
     add(hasher,
-        matchedProperties.properties.get(),
         matchedProperties.linkMatchType,
         matchedProperties.allowlistType,
         matchedProperties.styleScopeOrdinal,
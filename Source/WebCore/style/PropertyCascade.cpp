@@ -134,7 +134,7 @@ void PropertyCascade::set(CSSPropertyID id, CSSValue& cssValue, const MatchedPro
         return;
     }
 
-    if (!m_propertyIsPresent[id])
+    if (!m_propertyIsPresent.get(id))
         property.cssValue = { };
     m_propertyIsPresent.set(id);
     setPropertyInternal(property, id, cssValue, matchedProperties, cascadeLevel);
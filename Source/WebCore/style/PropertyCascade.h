@@ -28,7 +28,7 @@
 #include "CascadeLevel.h"
 #include "MatchResult.h"
 #include "WebAnimationTypes.h"
-#include <bitset>
+#include <wtf/Bitmap.h>
 
 namespace WebCore {
 
@@ -55,10 +55,11 @@ public:
         std::array<CSSValue*, 3> cssValue; // Values for link match states MatchDefault, MatchLink and MatchVisited
     };
 
-    bool isEmpty() const { return m_propertyIsPresent.none() && !m_seenDeferredPropertyCount; }
+    bool isEmpty() const { return m_propertyIsPresent.isEmpty() && !m_seenDeferredPropertyCount; }
 
     bool hasNormalProperty(CSSPropertyID) const;
     const Property& normalProperty(CSSPropertyID) const;
+    int firstNormalPropertyAtOrAfter(int) const;
 
     bool hasDeferredProperty(CSSPropertyID) const;
     const Property& deferredProperty(CSSPropertyID) const;
@@ -112,7 +113,7 @@ private:
     // It could actually be 2 units smaller, but then we would have to subtract 'firstCSSProperty', which may not be worth it.
     // 'm_propertyIsPresent' is not used for deferred properties, so we only need to cover up to the last low priority one.
     std::array<Property, lastDeferredProperty + 1> m_properties;
-    std::bitset<lastLowPriorityProperty + 1> m_propertyIsPresent;
+    WTF::Bitmap<lastLowPriorityProperty + 1> m_propertyIsPresent;
 
     static constexpr unsigned deferredPropertyCount = lastDeferredProperty - firstDeferredProperty + 1;
     std::array<unsigned, deferredPropertyCount> m_deferredPropertyIndices { };
@@ -128,7 +129,14 @@ private:
 inline bool PropertyCascade::hasNormalProperty(CSSPropertyID id) const
 {
     ASSERT(id < firstDeferredProperty);
-    return m_propertyIsPresent[id];
+    return m_propertyIsPresent.get(id);
+}
+
+// Returns a value past the bitmap size when there is no further property, so range loops terminate.
+inline int PropertyCascade::firstNormalPropertyAtOrAfter(int id) const
+{
+    ASSERT(static_cast<unsigned>(id) <= m_propertyIsPresent.size());
+    return m_propertyIsPresent.findBit(id, true);
 }
 
 inline const PropertyCascade::Property& PropertyCascade::normalProperty(CSSPropertyID id) const
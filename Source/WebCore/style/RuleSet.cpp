@@ -62,10 +62,41 @@ void RuleSet::addToRuleSet(const AtomString& key, AtomRuleMap& map, const RuleDa
         return;
     auto& rules = map.add(key, nullptr).iterator->value;
     if (!rules)
-        rules = makeUnique<RuleDataVector>();
+        rules = SharedRuleDataVector::create();
     rules->append(ruleData);
 }
 
+void RuleSet::addToRuleSets(const AtomString& exactKey, AtomRuleMap& exactMap, const AtomString& foldedKey, AtomRuleMap& foldedMap, const RuleData& ruleData)
+{
+    if (exactKey != foldedKey) {
+        // A mixed-case name needs distinct buckets. Appending into an already shared vector
+        // here only makes the exact-name bucket over-inclusive, which is safe: buckets are
+        // candidate lists and the selector checker re-verifies every rule.
+        addToRuleSet(exactKey, exactMap, ruleData);
+        addToRuleSet(foldedKey, foldedMap, ruleData);
+        return;
+    }
+    if (exactKey.isNull())
+        return;
+    auto& exactRules = exactMap.add(exactKey, nullptr).iterator->value;
+    auto& foldedRules = foldedMap.add(foldedKey, nullptr).iterator->value;
+    if (!exactRules && !foldedRules) {
+        foldedRules = SharedRuleDataVector::create();
+        exactRules = foldedRules;
+    }
+    if (exactRules == foldedRules) {
+        exactRules->append(ruleData);
+        return;
+    }
+    // The buckets diverged because a mixed-case rule hit one of them first.
+    if (!exactRules)
+        exactRules = SharedRuleDataVector::create();
+    if (!foldedRules)
+        foldedRules = SharedRuleDataVector::create();
+    exactRules->append(ruleData);
+    foldedRules->append(ruleData);
+}
+
 static unsigned rulesCountForName(const RuleSet::AtomRuleMap& map, const AtomString& name)
 {
     if (const auto* rules = map.get(name))
@@ -278,8 +309,7 @@ void RuleSet::addRule(RuleData&& ruleData, CascadeLayerIdentifier cascadeLayerId
     }
 
     if (attributeSelector) {
-        addToRuleSet(attributeSelector->attribute().localName(), m_attributeLocalNameRules, ruleData);
-        addToRuleSet(attributeSelector->attributeCanonicalLocalName(), m_attributeCanonicalLocalNameRules, ruleData);
+        addToRuleSets(attributeSelector->attribute().localName(), m_attributeLocalNameRules, attributeSelector->attributeCanonicalLocalName(), m_attributeCanonicalLocalNameRules, ruleData);
         return;
     }
 
@@ -294,8 +324,7 @@ void RuleSet::addRule(RuleData&& ruleData, CascadeLayerIdentifier cascadeLayerId
     }
 
     if (tagSelector) {
-        addToRuleSet(tagSelector->tagQName().localName(), m_tagLocalNameRules, ruleData);
-        addToRuleSet(tagSelector->tagLowercaseLocalName(), m_tagLowercaseLocalNameRules, ruleData);
+        addToRuleSets(tagSelector->tagQName().localName(), m_tagLocalNameRules, tagSelector->tagLowercaseLocalName(), m_tagLowercaseLocalNameRules, ruleData);
         return;
     }
 
@@ -316,6 +345,8 @@ void RuleSet::traverseRuleDatas(Function&& function)
             function(ruleData);
     };
 
+    // The tag and attribute maps can share vectors between their exact and case-folded
+    // variants, so a RuleData may be visited twice; functions must tolerate that.
     auto traverseMap = [&](auto& map) {
         for (auto& ruleDatas : map.values())
             traverseVector(*ruleDatas);
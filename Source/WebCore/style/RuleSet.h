@@ -73,12 +73,23 @@ public:
     ~RuleSet();
 
     typedef Vector<RuleData, 1> RuleDataVector;
-    typedef HashMap<AtomString, std::unique_ptr<RuleDataVector>> AtomRuleMap;
+
+    // Map buckets are refcounted so that the maps keyed both by exact name and by case-folded
+    // name can point at a single vector when the two names are equal, which for the user agent
+    // sheets is nearly every tag and attribute rule.
+    class SharedRuleDataVector : public RefCounted<SharedRuleDataVector>, public RuleDataVector {
+    public:
+        static Ref<SharedRuleDataVector> create() { return adoptRef(*new SharedRuleDataVector); }
+    private:
+        SharedRuleDataVector() = default;
+    };
+    typedef HashMap<AtomString, RefPtr<SharedRuleDataVector>> AtomRuleMap;
 
     void addRule(const StyleRule&, unsigned selectorIndex, unsigned selectorListIndex);
     void addPageRule(StyleRulePage&);
 
     void addToRuleSet(const AtomString& key, AtomRuleMap&, const RuleData&);
+    void addToRuleSets(const AtomString& exactKey, AtomRuleMap& exactMap, const AtomString& foldedKey, AtomRuleMap& foldedMap, const RuleData&);
     void shrinkToFit();
 
     bool hasViewportDependentMediaQueries() const { return m_hasViewportDependentMediaQueries; }
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "SelectorMatchingProfiler.h"
+
+#include "CSSSelector.h"
+#include "RuleData.h"
+
+namespace WebCore {
+namespace Style {
+
+bool SelectorMatchingProfiler::s_isEnabled = false;
+
+SelectorMatchingProfiler& SelectorMatchingProfiler::singleton()
+{
+    static NeverDestroyed<SelectorMatchingProfiler> profiler;
+    return profiler;
+}
+
+void SelectorMatchingProfiler::setEnabled(bool isEnabled)
+{
+    ASSERT(isMainThread());
+    if (s_isEnabled == isEnabled)
+        return;
+    s_isEnabled = isEnabled;
+    if (!isEnabled)
+        m_timings.clear();
+}
+
+void SelectorMatchingProfiler::recordMatchAttempt(const RuleData& ruleData, SelectorMatchingOrigin origin, Seconds matchTime, bool matched)
+{
+    ASSERT(isMainThread());
+    // Building the selector text here is slow but only affects the profiled run; the measured
+    // match time is taken around the match itself so the numbers stay meaningful.
+    auto key = std::make_pair(ruleData.selector()->selectorText(), static_cast<uint8_t>(origin));
+    auto& timing = m_timings.ensure(key, [&] {
+        return SelectorTiming { key.first, origin, 0, 0, { } };
+    }).iterator->value;
+    ++timing.matchAttempts;
+    if (matched)
+        ++timing.matches;
+    timing.totalMatchTime += matchTime;
+}
+
+Vector<SelectorMatchingProfiler::SelectorTiming> SelectorMatchingProfiler::takeTimings()
+{
+    ASSERT(isMainThread());
+    return copyToVector(std::exchange(m_timings, { }).values());
+}
+
+}
+}
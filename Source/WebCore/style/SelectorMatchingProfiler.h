@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <wtf/HashMap.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Seconds.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+namespace Style {
+
+class RuleData;
+
+enum class SelectorMatchingOrigin : uint8_t { UserAgent, User, Author };
+
+// Opt-in accounting of how often each selector is tried during rule collection, how often
+// it matches, and how much time matching it takes, aggregated per selector and cascade origin.
+// When disabled the only cost at the matching sites is a flag check.
+class SelectorMatchingProfiler {
+    WTF_MAKE_FAST_ALLOCATED;
+    WTF_MAKE_NONCOPYABLE(SelectorMatchingProfiler);
+public:
+    static SelectorMatchingProfiler& singleton();
+
+    static bool isEnabled() { return s_isEnabled; }
+    void setEnabled(bool);
+
+    void recordMatchAttempt(const RuleData&, SelectorMatchingOrigin, Seconds matchTime, bool matched);
+
+    struct SelectorTiming {
+        String selectorText;
+        SelectorMatchingOrigin origin { SelectorMatchingOrigin::Author };
+        uint64_t matchAttempts { 0 };
+        uint64_t matches { 0 };
+        Seconds totalMatchTime;
+    };
+    Vector<SelectorTiming> takeTimings();
+
+private:
+    friend class NeverDestroyed<SelectorMatchingProfiler>;
+    SelectorMatchingProfiler() = default;
+
+    static bool s_isEnabled;
+    HashMap<std::pair<String, uint8_t>, SelectorTiming> m_timings;
+};
+
+}
+}
@@ -31,6 +31,7 @@
 #include "CSSCounterStyleRegistry.h"
 #include "CSSFontSelector.h"
 #include "CSSStyleSheet.h"
+#include "CommonAtomStrings.h"
 #include "CustomPropertyRegistry.h"
 #include "Element.h"
 #include "ElementChildIterator.h"
@@ -43,8 +44,10 @@
 #include "HTMLStyleElement.h"
 #include "InspectorInstrumentation.h"
 #include "Logging.h"
+#include "MediaQueryEvaluator.h"
 #include "ProcessingInstruction.h"
 #include "RenderView.h"
+#include "RuleSetBuilder.h"
 #include "SVGElementTypeHelpers.h"
 #include "SVGStyleElement.h"
 #include "Settings.h"
@@ -803,6 +806,26 @@ void Scope::didChangeStyleSheetContents()
     scheduleUpdate(UpdateType::ContentsOrInterpretation);
 }
 
+void Scope::didMutateRuleDeclarations(StyleRule& rule)
+{
+    // If the resolver is gone a full rebuild is already pending, or style has never been resolved.
+    if (!resolverIfExists())
+        return;
+
+    // The cache may hold references to the mutated declaration block.
+    invalidateMatchedDeclarationsCache();
+
+    // Invalidate the elements the rule matches. Evaluating enclosing media queries as always-true
+    // can only over-invalidate; the actual match during style resolution uses the real evaluator.
+    auto ruleSet = RuleSet::create();
+    RuleSetBuilder builder(ruleSet, MQ::MediaQueryEvaluator { screenAtom(), MQ::EvaluationResult::True });
+    builder.addStyleRule(rule);
+
+    InvalidationRuleSetVector invalidationRuleSets { ruleSet.copyRef() };
+    Invalidator invalidator(invalidationRuleSets);
+    invalidator.invalidateStyle(*this);
+}
+
 void Scope::didChangeStyleSheetEnvironment()
 {
     if (!m_shadowRoot) {
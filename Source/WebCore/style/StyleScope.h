@@ -54,6 +54,7 @@ class WeakPtrImplWithEventTargetData;
 class HTMLSlotElement;
 class Node;
 class ProcessingInstruction;
+class StyleRule;
 class StyleSheet;
 class StyleSheetContents;
 class StyleSheetList;
@@ -108,6 +109,10 @@ public:
     void didChangeActiveStyleSheetCandidates();
     // This is called when contents of a stylesheet is mutated.
     void didChangeStyleSheetContents();
+    // This is called when only the declaration block of a style rule is mutated through the CSSOM.
+    // Such mutations cannot affect the rule structure, so the resolver is kept and only the
+    // elements the rule matches are invalidated.
+    void didMutateRuleDeclarations(StyleRule&);
     // This is called when the environment where we intrepret the stylesheets changes (for example switching to printing).
     // The change is assumed to potentially affect all author and user stylesheets including shadow roots.
     WEBCORE_EXPORT void didChangeStyleSheetEnvironment();
@@ -834,7 +834,8 @@ void TreeResolver::resolveComposedTree()
                 m_update->addText(text, parent.element, WTFMove(textUpdate));
             }
 
-            if (!text.data().isAllSpecialCharacters<isHTMLSpace>())
+            // Scanning the text is only needed until some child has resolved ::first-line and ::first-letter.
+            if (!parent.resolvedFirstLineAndLetterChild && !text.data().isAllSpecialCharacters<isHTMLSpace>())
                 parent.resolvedFirstLineAndLetterChild = true;
 
             text.setHasValidStyle();
@@ -953,6 +954,22 @@ auto TreeResolver::updateStateForQueryContainer(Element& element, const RenderSt
     }
 
     if (style->containerType() != ContainerType::Normal || previousContainerType != ContainerType::Normal) {
+        // When the container itself is unchanged in this update and its layout is current, the
+        // descendants can be resolved in this pass against the existing size instead of deferring
+        // them to an interleaved render tree update and layout round. If the layout that follows
+        // this update ends up changing the container's size after all, Scope::updateQueryContainerState
+        // detects it and invalidates the container subtree again.
+        auto canEvaluateAgainstCurrentSize = [&] {
+            if (change != Change::None)
+                return false;
+            if (style->containerType() != previousContainerType)
+                return false;
+            auto* renderer = element.renderer();
+            return renderer && !renderer->needsLayout();
+        };
+        if (canEvaluateAgainstCurrentSize())
+            return QueryContainerAction::Continue;
+
         m_queryContainerStates.add(element, QueryContainerState { change, descendantsToResolve });
         m_hasUnresolvedQueryContainers = true;
         return QueryContainerAction::Resolve;
@@ -42,6 +42,16 @@ typedef union {
     unsigned char bytes[sizeof(unsigned short)];
 } UnsignedShortByte;
 
+// Each path-valued property owns its own byte stream, so documents that repeat
+// one icon path hundreds of times store that geometry hundreds of times and
+// reparse the full "d" string on every attribute mutation. FIXME: The stream is
+// a value type copied through SVGAnimatedPropertyImpl; sharing identical streams
+// document-wide would first need this to become a ref-counted immutable payload
+// (copy-on-write through the animation machinery, which mutates streams while
+// animating), after which a hash-consed per-document store keyed on the source
+// string becomes straightforward. Incremental reparse of a changed suffix is
+// possible in principle (segments are self-contained), but nothing records the
+// mapping from string offsets to stream offsets today.
 class SVGPathByteStream {
     WTF_MAKE_FAST_ALLOCATED;
 public:
@@ -62,6 +62,7 @@ InternalSettings::Backup::Backup(Settings& settings)
     , m_fontLoadTimingOverride(settings.fontLoadTimingOverride())
     , m_fetchAPIKeepAliveAPIEnabled(DeprecatedGlobalSettings::fetchAPIKeepAliveEnabled())
     , m_customPasteboardDataEnabled(DeprecatedGlobalSettings::customPasteboardDataEnabled())
+    , m_inlineFormattingContextIntegrationEnabled(DeprecatedGlobalSettings::inlineFormattingContextIntegrationEnabled())
     , m_originalMockScrollbarsEnabled(DeprecatedGlobalSettings::mockScrollbarsEnabled())
 #if USE(AUDIO_SESSION)
     , m_shouldManageAudioSessionCategory(DeprecatedGlobalSettings::shouldManageAudioSessionCategory())
@@ -117,6 +118,7 @@ void InternalSettings::Backup::restoreTo(Settings& settings)
 
     DeprecatedGlobalSettings::setFetchAPIKeepAliveEnabled(m_fetchAPIKeepAliveAPIEnabled);
     DeprecatedGlobalSettings::setCustomPasteboardDataEnabled(m_customPasteboardDataEnabled);
+    DeprecatedGlobalSettings::setInlineFormattingContextIntegrationEnabled(m_inlineFormattingContextIntegrationEnabled);
 
 #if USE(AUDIO_SESSION)
     DeprecatedGlobalSettings::setShouldManageAudioSessionCategory(m_shouldManageAudioSessionCategory);
@@ -442,6 +444,14 @@ ExceptionOr<void> InternalSettings::setCustomPasteboardDataEnabled(bool enabled)
     return { };
 }
 
+ExceptionOr<void> InternalSettings::setInlineFormattingContextIntegrationEnabled(bool enabled)
+{
+    if (!m_page)
+        return Exception { InvalidAccessError };
+    DeprecatedGlobalSettings::setInlineFormattingContextIntegrationEnabled(enabled);
+    return { };
+}
+
 ExceptionOr<void> InternalSettings::setShouldManageAudioSessionCategory(bool should)
 {
 #if USE(AUDIO_SESSION)
@@ -89,6 +89,7 @@ public:
     // DeprecatedGlobalSettings.
     ExceptionOr<void> setFetchAPIKeepAliveEnabled(bool);
     ExceptionOr<void> setCustomPasteboardDataEnabled(bool);
+    ExceptionOr<void> setInlineFormattingContextIntegrationEnabled(bool);
 
     bool vp9DecoderEnabled() const;
     bool mediaSourceInlinePaintingEnabled() const;
@@ -160,6 +161,7 @@ private:
         // DeprecatedGlobalSettings
         bool m_fetchAPIKeepAliveAPIEnabled;
         bool m_customPasteboardDataEnabled;
+        bool m_inlineFormattingContextIntegrationEnabled;
         bool m_originalMockScrollbarsEnabled;
 #if USE(AUDIO_SESSION)
         bool m_shouldManageAudioSessionCategory;
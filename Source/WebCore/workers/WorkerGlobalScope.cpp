@@ -95,6 +95,14 @@ static WorkQueue& sharedFileSystemStorageQueue()
 
 WTF_MAKE_ISO_ALLOCATED_IMPL(WorkerGlobalScope);
 
+// Each worker gets a freshly created VM. Recycling a terminated worker's VM for a
+// later same-origin worker is not currently viable: a VM is bound to the thread it
+// was created on, its atom string table and Structures reference the old global
+// object, and JSC has no way to reset a heap while preserving Structures. Pages
+// that churn short-lived workers pay the VM bootstrap each time; the realistic
+// ways to shave that are keeping the worker alive between tasks at the
+// application level, or a warm-spare thread+VM spun up ahead of the first
+// postMessage, which would slot in at Worker creation rather than here.
 WorkerGlobalScope::WorkerGlobalScope(WorkerThreadType type, const WorkerParameters& params, Ref<SecurityOrigin>&& origin, WorkerThread& thread, Ref<SecurityOrigin>&& topOrigin, IDBClient::IDBConnectionProxy* connectionProxy, SocketProvider* socketProvider, std::unique_ptr<WorkerClient>&& workerClient)
     : WorkerOrWorkletGlobalScope(type, params.sessionID, isMainThread() ? Ref { commonVM() } : JSC::VM::create(), params.referrerPolicy, &thread, params.clientIdentifier)
     , m_url(params.scriptURL)
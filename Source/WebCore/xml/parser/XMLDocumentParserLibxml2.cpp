@@ -67,6 +67,8 @@
 #include "XMLNSNames.h"
 #include "XMLDocumentParserScope.h"
 #include <libxml/parserInternals.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/AtomStringHash.h>
 #include <wtf/unicode/CharacterNames.h>
 #include <wtf/unicode/UTF8Conversion.h>
 
@@ -725,6 +727,30 @@ struct _xmlSAX2Attributes {
 };
 typedef struct _xmlSAX2Attributes xmlSAX2Attributes;
 
+// A large document repeats the same few attribute names throughout, so parse and validate each
+// distinct (namespace, qualified name) pair once instead of once per attribute occurrence.
+// Failures are not cached; they abort the parse anyway.
+static std::optional<QualifiedName> parseAttributeNameWithCache(const AtomString& attrURI, const AtomString& attrQName)
+{
+    using AttributeNameKey = std::pair<AtomString, AtomString>;
+    static constexpr unsigned attributeNameCacheMaximumSize = 256;
+    static NeverDestroyed<HashMap<AttributeNameKey, QualifiedName>> cache;
+
+    AttributeNameKey key { attrURI, attrQName };
+    auto it = cache.get().find(key);
+    if (it != cache.get().end())
+        return it->value;
+
+    auto result = Element::parseAttributeName(attrURI, attrQName);
+    if (result.hasException())
+        return std::nullopt;
+
+    auto parsedName = result.releaseReturnValue();
+    if (cache.get().size() < attributeNameCacheMaximumSize)
+        cache.get().add(WTFMove(key), parsedName);
+    return parsedName;
+}
+
 static inline bool handleElementAttributes(Vector<Attribute>& prefixedAttributes, const xmlChar** libxmlAttributes, int numAttributes)
 {
     xmlSAX2Attributes* attributes = reinterpret_cast<xmlSAX2Attributes*>(libxmlAttributes);
@@ -735,11 +761,11 @@ static inline bool handleElementAttributes(Vector<Attribute>& prefixedAttributes
         AtomString attrURI = attrPrefix.isEmpty() ? nullAtom() : toAtomString(attributes[i].uri);
         AtomString attrQName = attrPrefix.isEmpty() ? toAtomString(attributes[i].localname) : makeAtomString(attrPrefix, ':', toString(attributes[i].localname));
 
-        auto result = Element::parseAttributeName(attrURI, attrQName);
-        if (result.hasException())
+        auto parsedName = parseAttributeNameWithCache(attrURI, attrQName);
+        if (!parsedName)
             return false;
 
-        prefixedAttributes.append(Attribute(result.releaseReturnValue(), attrValue));
+        prefixedAttributes.append(Attribute(WTFMove(*parsedName), attrValue));
     }
     return true;
 }
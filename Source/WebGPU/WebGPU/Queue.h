@@ -81,6 +81,8 @@ private:
     void ensureBlitCommandEncoder();
     void finalizeBlitCommandEncoder();
 
+    id<MTLBuffer> stagingBufferWithCapacity(size_t);
+
     void commitMTLCommandBuffer(id<MTLCommandBuffer>);
     bool isIdle() const { return m_submittedCommandBufferCount == m_completedCommandBufferCount; }
 
@@ -90,6 +92,8 @@ private:
     id<MTLCommandQueue> m_commandQueue { nil };
     id<MTLCommandBuffer> m_commandBuffer { nil };
     id<MTLBlitCommandEncoder> m_blitCommandEncoder { nil };
+    id<MTLBuffer> m_stagingBuffer { nil };
+    NSUInteger m_stagingBufferOffset { 0 };
     Device& m_device; // The only kind of queues that exist right now are default queues, which are owned by Devices.
 
     uint64_t m_submittedCommandBufferCount { 0 };
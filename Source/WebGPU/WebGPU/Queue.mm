@@ -33,6 +33,7 @@
 #import "IsValidToUseWith.h"
 #import "Texture.h"
 #import <wtf/CheckedArithmetic.h>
+#import <wtf/MathExtras.h>
 
 namespace WebGPU {
 
@@ -222,7 +223,22 @@ void Queue::writeBuffer(const Buffer& buffer, uint64_t bufferOffset, const void*
     }
 
     ensureBlitCommandEncoder();
-    // FIXME(PERFORMANCE): Suballocate, so the common case doesn't need to hit the kernel.
+
+    // Small writes are suballocated from a persistently mapped staging buffer, so the
+    // common case is a memcpy plus an encoded copy rather than a kernel allocation.
+    if (id<MTLBuffer> stagingBuffer = stagingBufferWithCapacity(size)) {
+        memcpy(static_cast<char*>(stagingBuffer.contents) + m_stagingBufferOffset, data, size);
+        [m_blitCommandEncoder
+            copyFromBuffer:stagingBuffer
+            sourceOffset:m_stagingBufferOffset
+            toBuffer:buffer.buffer()
+            destinationOffset:static_cast<NSUInteger>(bufferOffset)
+            size:static_cast<NSUInteger>(size)];
+        m_stagingBufferOffset += roundUpToMultipleOf<4>(static_cast<NSUInteger>(size));
+        return;
+    }
+
+    // Writes too large for the staging buffer get a dedicated temporary buffer.
     // FIXME(PERFORMANCE): Should this temporary buffer really be shared?
     id<MTLBuffer> temporaryBuffer = [m_device.device() newBufferWithBytes:data length:static_cast<NSUInteger>(size) options:MTLResourceStorageModeShared];
     if (!temporaryBuffer)
@@ -235,6 +251,23 @@ void Queue::writeBuffer(const Buffer& buffer, uint64_t bufferOffset, const void*
         size:static_cast<NSUInteger>(size)];
 }
 
+id<MTLBuffer> Queue::stagingBufferWithCapacity(size_t size)
+{
+    static constexpr NSUInteger stagingBufferLength = 1 << 20;
+    if (size > stagingBufferLength)
+        return nil;
+
+    if (!m_stagingBuffer || m_stagingBufferOffset + size > stagingBufferLength) {
+        // The previous buffer is released here; blit command buffers that reference it
+        // retain it until their copies execute, so suballocations are never recycled
+        // while the GPU can still read them and no explicit fencing is needed.
+        m_stagingBuffer = [m_device.device() newBufferWithLength:stagingBufferLength options:MTLResourceStorageModeShared];
+        m_stagingBufferOffset = 0;
+    }
+
+    return m_stagingBuffer;
+}
+
 static bool validateWriteTexture(const WGPUImageCopyTexture& destination, const WGPUTextureDataLayout& dataLayout, const WGPUExtent3D& size, size_t dataByteSize, const WGPUTextureDescriptor& textureDesc)
 {
     if (!Texture::validateImageCopyTexture(destination, size))
@@ -110,6 +110,12 @@ void RenderPassEncoder::endPipelineStatisticsQuery()
 
 }
 
+// Render bundles are the supported form of pre-encoded, reusable command
+// fragments: a bundle records once into a Metal indirect command buffer and
+// replays here each frame without re-encoding or revalidating its draws. Static
+// scenes with large draw counts should be recorded as bundles rather than
+// re-encoded per frame; per-draw validation, when it is added to draw() and
+// setBindGroup(), should stay out of this replay path.
 void RenderPassEncoder::executeBundles(Vector<std::reference_wrapper<const RenderBundle>>&& bundles)
 {
     for (auto& bundle : bundles) {
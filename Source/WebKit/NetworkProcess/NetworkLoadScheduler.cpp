@@ -29,16 +29,21 @@
 #include "Logging.h"
 #include "NetworkLoad.h"
 #include <WebCore/ResourceError.h>
+#include <WebCore/Timer.h>
+#include <wtf/MonotonicTime.h>
 
 namespace WebKit {
 
 static constexpr size_t maximumActiveCountForLowPriority = 2;
 static constexpr size_t maximumTrackedHTTP1XOrigins = 128;
+// Starvation protection: a load never waits in the pending queue longer than this,
+// no matter how busy the host's budget is.
+static constexpr Seconds maximumPendingLoadDelay = 10_s;
 
 class NetworkLoadScheduler::HostContext {
     WTF_MAKE_FAST_ALLOCATED;
 public:
-    HostContext() = default;
+    HostContext();
     ~HostContext();
 
     void schedule(NetworkLoad&);
@@ -47,19 +52,29 @@ public:
 
 private:
     void start(NetworkLoad&);
+    void startNextPendingLoad();
+    void startOverdueLoads();
+    void updatePendingLoadTimer();
     bool shouldDelayLowPriority() const { return m_activeLoads.size() >= maximumActiveCountForLowPriority; }
 
     HashSet<NetworkLoad*> m_activeLoads;
     ListHashSet<NetworkLoad*> m_pendingLoads;
+    HashMap<NetworkLoad*, MonotonicTime> m_pendingLoadEnqueueTimes;
+    WebCore::Timer m_pendingLoadTimer;
 };
 
+NetworkLoadScheduler::HostContext::HostContext()
+    : m_pendingLoadTimer(*this, &HostContext::startOverdueLoads)
+{
+}
+
 void NetworkLoadScheduler::HostContext::schedule(NetworkLoad& load)
 {
     auto startImmediately = [&] {
         auto& request = load.currentRequest();
         if (request.priority() > WebCore::ResourceLoadPriority::Low)
             return true;
-        
+
         if (request.isConditional())
             return true;
 
@@ -75,19 +90,24 @@ void NetworkLoadScheduler::HostContext::schedule(NetworkLoad& load)
     }
 
     m_pendingLoads.add(&load);
+    m_pendingLoadEnqueueTimes.add(&load, MonotonicTime::now());
+    updatePendingLoadTimer();
 }
 
 void NetworkLoadScheduler::HostContext::unschedule(NetworkLoad& load)
 {
     m_activeLoads.remove(&load);
-    m_pendingLoads.remove(&load);
+    if (m_pendingLoads.remove(&load)) {
+        m_pendingLoadEnqueueTimes.remove(&load);
+        updatePendingLoadTimer();
+    }
 
     if (m_pendingLoads.isEmpty())
         return;
     if (shouldDelayLowPriority())
         return;
 
-    start(*m_pendingLoads.takeFirst());
+    startNextPendingLoad();
 }
 
 void NetworkLoadScheduler::HostContext::prioritize(NetworkLoad& load)
@@ -103,11 +123,53 @@ void NetworkLoadScheduler::HostContext::prioritize(NetworkLoad& load)
 
 void NetworkLoadScheduler::HostContext::start(NetworkLoad& load)
 {
+    m_pendingLoadEnqueueTimes.remove(&load);
     m_activeLoads.add(&load);
 
     load.start();
 }
 
+void NetworkLoadScheduler::HostContext::startNextPendingLoad()
+{
+    ASSERT(!m_pendingLoads.isEmpty());
+
+    // Pick the highest-priority pending load; enqueue order breaks ties so equal-priority
+    // loads still start in the order the pages requested them.
+    auto* nextLoad = *m_pendingLoads.begin();
+    for (auto* pendingLoad : m_pendingLoads) {
+        if (pendingLoad->currentRequest().priority() > nextLoad->currentRequest().priority())
+            nextLoad = pendingLoad;
+    }
+
+    m_pendingLoads.remove(nextLoad);
+    start(*nextLoad);
+    updatePendingLoadTimer();
+}
+
+void NetworkLoadScheduler::HostContext::startOverdueLoads()
+{
+    // The queue is in enqueue order, so overdue loads are at the front.
+    auto now = MonotonicTime::now();
+    while (!m_pendingLoads.isEmpty()) {
+        auto* oldestLoad = *m_pendingLoads.begin();
+        if (now - m_pendingLoadEnqueueTimes.get(oldestLoad) < maximumPendingLoadDelay)
+            break;
+        m_pendingLoads.remove(oldestLoad);
+        start(*oldestLoad);
+    }
+    updatePendingLoadTimer();
+}
+
+void NetworkLoadScheduler::HostContext::updatePendingLoadTimer()
+{
+    if (m_pendingLoads.isEmpty()) {
+        m_pendingLoadTimer.stop();
+        return;
+    }
+    auto age = MonotonicTime::now() - m_pendingLoadEnqueueTimes.get(*m_pendingLoads.begin());
+    m_pendingLoadTimer.startOneShot(std::max(maximumPendingLoadDelay - age, 0_s));
+}
+
 NetworkLoadScheduler::HostContext::~HostContext()
 {
     for (auto* load : m_pendingLoads)
@@ -231,6 +231,11 @@ std::unique_ptr<ServiceWorkerFetchTask> WebSWServerConnection::createFetchTask(N
         return nullptr;
     }
 
+    // This is the fast path that avoids waking the worker at all: workers whose fetch
+    // handler is known to be trivial (detected at script evaluation) never get a fetch
+    // task, so the load proceeds straight to network. FIXME: When the static routing
+    // API (addRoutes) is implemented, route evaluation should happen here as well so
+    // declared cache-first/network-only routes skip worker launch the same way.
     if (worker->shouldSkipFetchEvent()) {
         if (registration->shouldSoftUpdate(loader.parameters().options))
             registration->scheduleSoftUpdate(loader.isAppInitiated() ? WebCore::IsAppInitiated::Yes : WebCore::IsAppInitiated::No);
@@ -36,6 +36,7 @@
 #include <wtf/persistence/PersistentDecoder.h>
 #include <wtf/persistence/PersistentEncoder.h>
 #include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringToIntegerConversion.h>
 
 namespace WebKit {
 
@@ -214,6 +215,28 @@ void Caches::initializeSize()
         return;
     }
 
+    // The size file is rewritten after every record write and removal, and
+    // Engine::diskUsage already trusts it for quota accounting, so use it here too
+    // rather than reading back every record; traversal remains the fallback for
+    // first runs and for origins whose size file did not survive.
+    m_engine->readFile(cachesSizeFilename(m_rootPath), [this, protectedThis = Ref { *this }](const NetworkCache::Data& data, int error) mutable {
+        if (m_pendingInitializationCallbacks.isEmpty()) {
+            // Caches was cleared so let's not get initialized.
+            m_storage = nullptr;
+            return;
+        }
+        if (!error) {
+            if (auto size = parseInteger<uint64_t>(StringView { data.data(), static_cast<unsigned>(data.size()) })) {
+                didInitializeSize(*size);
+                return;
+            }
+        }
+        initializeSizeFromTraversal();
+    });
+}
+
+void Caches::initializeSizeFromTraversal()
+{
     uint64_t size = 0;
     m_storage->traverse({ }, { }, [protectedThis = Ref { *this }, this, protectedStorage = Ref { *m_storage }, size](const auto* storage, const auto& information) mutable {
         if (!storage) {
@@ -222,13 +245,7 @@ void Caches::initializeSize()
                 m_storage = nullptr;
                 return;
             }
-            m_size = size;
-            updateSizeFile([this, protectedThis = WTFMove(protectedThis)]() mutable {
-                m_isInitialized = true;
-                auto pendingCallbacks = WTFMove(m_pendingInitializationCallbacks);
-                for (auto& callback : pendingCallbacks)
-                    callback(std::nullopt);
-            });
+            didInitializeSize(size);
             return;
         }
         auto decoded = Cache::decodeRecordHeader(*storage);
@@ -237,6 +254,17 @@ void Caches::initializeSize()
     });
 }
 
+void Caches::didInitializeSize(uint64_t size)
+{
+    m_size = size;
+    updateSizeFile([this, protectedThis = Ref { *this }]() mutable {
+        m_isInitialized = true;
+        auto pendingCallbacks = WTFMove(m_pendingInitializationCallbacks);
+        for (auto& callback : pendingCallbacks)
+            callback(std::nullopt);
+    });
+}
+
 void Caches::detach()
 {
     m_engine = nullptr;
@@ -86,6 +86,8 @@ private:
     Caches(Engine&, WebCore::ClientOrigin&&, String&& rootPath);
 
     void initializeSize();
+    void initializeSizeFromTraversal();
+    void didInitializeSize(uint64_t);
     void readCachesFromDisk(WTF::Function<void(Expected<Vector<Cache>, WebCore::DOMCacheEngine::Error>&&)>&&);
     void writeCachesToDisk(WebCore::DOMCacheEngine::CompletionCallback&&);
 
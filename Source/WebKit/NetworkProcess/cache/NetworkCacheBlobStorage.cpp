@@ -76,6 +76,17 @@ void BlobStorage::synchronize()
     LOG(NetworkCacheStorage, "(NetworkProcess) blob synchronization completed approximateSize=%zu", approximateSize());
 }
 
+static void linkBlob(const String& blobPath, const String& path)
+{
+    if (FileSystem::hardLink(blobPath, path))
+        return;
+    // Hard linking fails once a widely shared payload exhausts the filesystem's per-inode
+    // link limit. A copy-on-write clone still shares the underlying extents.
+    if (FileSystem::cloneFile(blobPath, path))
+        return;
+    WTFLogAlways("Failed to create hard link or clone from %s to %s", blobPath.utf8().data(), path.utf8().data());
+}
+
 String BlobStorage::blobPathForHash(const SHA1::Digest& hash) const
 {
     auto hashAsString = SHA1::hexDigest(hash);
@@ -99,8 +110,7 @@ BlobStorage::Blob BlobStorage::add(const String& path, const Data& data)
         if (FileSystem::makeSafeToUseMemoryMapForPath(blobPath)) {
             auto existingData = mapFile(blobPath);
             if (bytesEqual(existingData, data)) {
-                if (!FileSystem::hardLink(blobPath, path))
-                    WTFLogAlways("Failed to create hard link from %s to %s", blobPath.utf8().data(), path.utf8().data());
+                linkBlob(blobPath, path);
                 return { existingData, hash };
             }
         }
@@ -111,8 +121,7 @@ BlobStorage::Blob BlobStorage::add(const String& path, const Data& data)
     if (mappedData.isNull())
         return { };
 
-    if (!FileSystem::hardLink(blobPath, path))
-        WTFLogAlways("Failed to create hard link from %s to %s", blobPath.utf8().data(), path.utf8().data());
+    linkBlob(blobPath, path);
 
     m_approximateSize += mappedData.size();
 
@@ -28,6 +28,7 @@
 
 #include "NetworkCacheFileSystem.h"
 #include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/RunLoop.h>
 #include <wtf/glib/GUniquePtr.h>
 #include <wtf/glib/RunLoopSourcePriority.h>
@@ -35,6 +36,22 @@
 namespace WebKit {
 namespace NetworkCache {
 
+// Cold-cache page loads issue hundreds of small record and blob reads; doing each on a
+// freshly spawned thread made thread creation the dominant per-operation cost. Shared
+// queues keep the blocking GIO calls off the caller's queue while letting consecutive
+// operations reuse the same thread. FIXME: An io_uring submission ring with batched
+// SQEs and registered buffers would avoid the remaining thread hop entirely on Linux,
+// but needs a liburing (or raw syscall) dependency the GLib ports don't carry yet.
+static WorkQueue& ioQueue(WorkQueue::QOS qos)
+{
+    if (qos == WorkQueue::QOS::Background) {
+        static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("org.WebKit.NetworkCacheIOChannel.background", WorkQueue::QOS::Background));
+        return queue.get();
+    }
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("org.WebKit.NetworkCacheIOChannel"));
+    return queue.get();
+}
+
 IOChannel::IOChannel(String&& filePath, Type type, std::optional<WorkQueue::QOS> qos)
     : m_path(WTFMove(filePath))
     , m_type(type)
@@ -81,7 +98,7 @@ void IOChannel::read(size_t offset, size_t size, WTF::WorkQueueBase& queue, Func
         return;
     }
 
-    Thread::create("IOChannel::read", [this, protectedThis = WTFMove(protectedThis), offset, size, queue = Ref { queue }, completionHandler = WTFMove(completionHandler)]() mutable {
+    ioQueue(m_qos).dispatch([this, protectedThis = WTFMove(protectedThis), offset, size, queue = Ref { queue }, completionHandler = WTFMove(completionHandler)]() mutable {
         GRefPtr<GFileInfo> info = adoptGRef(g_file_input_stream_query_info(G_FILE_INPUT_STREAM(m_inputStream.get()), G_FILE_ATTRIBUTE_STANDARD_SIZE, nullptr, nullptr));
         if (info) {
             auto fileSize = g_file_info_get_size(info.get());
@@ -107,7 +124,7 @@ void IOChannel::read(size_t offset, size_t size, WTF::WorkQueueBase& queue, Func
             Data data;
             completionHandler(data, -1);
         });
-    }, ThreadType::Unknown, m_qos)->detach();
+    });
 }
 
 void IOChannel::write(size_t offset, const Data& data, WTF::WorkQueueBase& queue, Function<void(int error)>&& completionHandler)
@@ -121,14 +138,14 @@ void IOChannel::write(size_t offset, const Data& data, WTF::WorkQueueBase& queue
     }
 
     GRefPtr<GBytes> buffer = offset ? adoptGRef(g_bytes_new_from_bytes(data.bytes(), offset, data.size() - offset)) : data.bytes();
-    Thread::create("IOChannel::write", [this, protectedThis = WTFMove(protectedThis), buffer = WTFMove(buffer), queue = Ref { queue }, completionHandler = WTFMove(completionHandler)]() mutable {
+    ioQueue(m_qos).dispatch([this, protectedThis = WTFMove(protectedThis), buffer = WTFMove(buffer), queue = Ref { queue }, completionHandler = WTFMove(completionHandler)]() mutable {
         gsize buffersize;
         const auto* bufferData = g_bytes_get_data(buffer.get(), &buffersize);
         auto success = g_output_stream_write_all(m_outputStream.get(), bufferData, buffersize, nullptr, nullptr, nullptr);
         queue->dispatch([protectedThis = WTFMove(protectedThis), success, completionHandler = WTFMove(completionHandler)] {
             completionHandler(success ? 0 : -1);
         });
-    }, ThreadType::Unknown, m_qos)->detach();
+    });
 }
 
 } // namespace NetworkCache
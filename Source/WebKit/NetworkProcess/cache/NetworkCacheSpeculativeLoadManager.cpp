@@ -595,7 +595,22 @@ void SpeculativeLoadManager::preloadEntry(const Key& key, const SubresourceInfo&
 
 void SpeculativeLoadManager::startSpeculativeRevalidation(const GlobalFrameID& frameID, SubresourcesEntry& entry, bool requestIsAppInitiated, std::optional<NavigatingToAppBoundDomain> isNavigatingToAppBoundDomain, bool allowPrivacyProxy, OptionSet<NetworkConnectionIntegrity> networkConnectionIntegrityPolicy)
 {
-    for (auto& subresourceInfo : entry.subresources()) {
+    // Dispatch in criticality order so the subresources WebCore observed as render-blocking
+    // (carrying the highest load priorities) reach storage and the network first. Within a
+    // priority class the observed fetch order is preserved; transient entries sort last.
+    Vector<SubresourceInfo*> subresourcesInPriorityOrder;
+    subresourcesInPriorityOrder.reserveInitialCapacity(entry.subresources().size());
+    for (auto& subresourceInfo : entry.subresources())
+        subresourcesInPriorityOrder.uncheckedAppend(&subresourceInfo);
+    std::stable_sort(subresourcesInPriorityOrder.begin(), subresourcesInPriorityOrder.end(), [](auto* a, auto* b) {
+        auto dispatchPriority = [](const SubresourceInfo& info) {
+            return info.isTransient() ? ResourceLoadPriority::Lowest : info.priority();
+        };
+        return dispatchPriority(*a) > dispatchPriority(*b);
+    });
+
+    for (auto* subresourceInfoPointer : subresourcesInPriorityOrder) {
+        auto& subresourceInfo = *subresourceInfoPointer;
         auto& key = subresourceInfo.key();
         subresourceInfo.setIsAppInitiated(requestIsAppInitiated);
         if (!subresourceInfo.isTransient())
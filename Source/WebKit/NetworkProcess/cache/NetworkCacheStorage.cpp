@@ -51,6 +51,17 @@ static constexpr auto versionDirectoryPrefix = "Version "_s;
 static constexpr auto recordsDirectoryName = "Records"_s;
 static constexpr auto blobsDirectoryName = "Blobs"_s;
 static constexpr auto blobSuffix = "-blob"_s;
+static constexpr auto indexFileName = "index"_s;
+
+// Incrementing this invalidates existing index files, forcing a rebuild from the records directory.
+static constexpr unsigned indexFormatVersion = 1;
+static constexpr Seconds indexWriteDelay = 2_s;
+
+struct IndexFileHeader {
+    unsigned formatVersion;
+    unsigned cacheVersion;
+    uint64_t approximateRecordsSize;
+};
 
 static inline size_t maximumInlineBodySize()
 {
@@ -270,6 +281,7 @@ Storage::Storage(const String& baseDirectoryPath, Mode mode, Salt salt, size_t c
     , m_capacity(capacity)
     , m_readOperationTimeoutTimer(*this, &Storage::cancelAllReadOperations)
     , m_writeOperationDispatchTimer(*this, &Storage::dispatchPendingWriteOperations)
+    , m_indexWriteTimer(*this, &Storage::writeIndex)
     , m_ioQueue(ConcurrentWorkQueue::create("com.apple.WebKit.Cache.Storage"))
     , m_backgroundIOQueue(ConcurrentWorkQueue::create("com.apple.WebKit.Cache.Storage.background", WorkQueue::QOS::Background))
     , m_serialBackgroundIOQueue(WorkQueue::create("com.apple.WebKit.Cache.Storage.serialBackground", WorkQueue::QOS::Background))
@@ -329,6 +341,102 @@ size_t Storage::estimateRecordsSize(unsigned recordCount, unsigned blobCount) co
     return headerSizes + inlineBodySizes;
 }
 
+struct Storage::LoadedIndex {
+    std::unique_ptr<ContentsFilter> recordFilter;
+    std::unique_ptr<ContentsFilter> blobFilter;
+    size_t approximateRecordsSize { 0 };
+};
+
+String Storage::indexFilePathIsolatedCopy() const
+{
+    return FileSystem::pathByAppendingComponent(versionPath(), indexFileName);
+}
+
+auto Storage::readIndexFile() -> std::optional<LoadedIndex>
+{
+    ASSERT(!RunLoop::isMain());
+
+    constexpr size_t filterSizeInBytes = ContentsFilter::tableSize / 8;
+    constexpr size_t payloadSize = sizeof(IndexFileHeader) + 2 * filterSizeInBytes;
+
+    auto indexFilePath = indexFilePathIsolatedCopy();
+    auto indexData = mapFile(indexFilePath);
+    if (indexData.isNull())
+        return std::nullopt;
+
+    auto rebuildAfterCorruption = [&]() -> std::optional<LoadedIndex> {
+        LOG(NetworkCacheStorage, "(NetworkProcess) cache index invalid, rebuilding from records");
+        FileSystem::deleteFile(indexFilePath);
+        return std::nullopt;
+    };
+
+    if (indexData.size() != payloadSize + sizeof(SHA1::Digest))
+        return rebuildAfterCorruption();
+
+    // The checksum is salted so an index can never outlive the cache generation it describes.
+    auto checksum = computeSHA1(indexData.subrange(0, payloadSize), m_salt);
+    if (memcmp(checksum.data(), indexData.data() + payloadSize, checksum.size()))
+        return rebuildAfterCorruption();
+
+    IndexFileHeader header;
+    memcpy(&header, indexData.data(), sizeof(header));
+    if (header.formatVersion != indexFormatVersion || header.cacheVersion != version)
+        return rebuildAfterCorruption();
+
+    constexpr size_t wordsPerFilter = filterSizeInBytes / sizeof(unsigned);
+    auto* filterBits = reinterpret_cast<const unsigned*>(indexData.data() + sizeof(IndexFileHeader));
+
+    LoadedIndex loadedIndex;
+    loadedIndex.approximateRecordsSize = header.approximateRecordsSize;
+    loadedIndex.recordFilter = makeUnique<ContentsFilter>();
+    loadedIndex.recordFilter->setBitArray({ filterBits, wordsPerFilter });
+    loadedIndex.blobFilter = makeUnique<ContentsFilter>();
+    loadedIndex.blobFilter->setBitArray({ filterBits + wordsPerFilter, wordsPerFilter });
+    return loadedIndex;
+}
+
+void Storage::scheduleIndexWrite()
+{
+    ASSERT(RunLoop::isMain());
+
+    if (m_mode != Mode::Normal)
+        return;
+    if (m_indexWriteTimer.isActive())
+        return;
+    m_indexWriteTimer.startOneShot(indexWriteDelay);
+}
+
+void Storage::writeIndex()
+{
+    ASSERT(RunLoop::isMain());
+
+    if (!m_recordFilter || !m_blobFilter)
+        return;
+    if (m_synchronizationInProgress || m_shrinkInProgress) {
+        scheduleIndexWrite();
+        return;
+    }
+
+    IndexFileHeader header { indexFormatVersion, version, m_approximateRecordsSize };
+
+    Vector<uint8_t> payload;
+    payload.reserveInitialCapacity(sizeof(header) + 2 * ContentsFilter::tableSize / 8);
+    payload.append(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    for (auto* filter : { m_recordFilter.get(), m_blobFilter.get() }) {
+        auto bits = filter->bitArray();
+        payload.append(reinterpret_cast<const uint8_t*>(bits.data()), bits.size_bytes());
+    }
+
+    Data payloadData(payload.data(), payload.size());
+    auto checksum = computeSHA1(payloadData, m_salt);
+    auto indexData = concatenate(payloadData, Data(checksum.data(), checksum.size()));
+
+    serialBackgroundIOQueue().dispatch([indexData = WTFMove(indexData), indexFilePath = indexFilePathIsolatedCopy()] {
+        FileSystem::deleteFile(indexFilePath);
+        indexData.mapToFile(indexFilePath);
+    });
+}
+
 void Storage::synchronize()
 {
     ASSERT(RunLoop::isMain());
@@ -339,7 +447,36 @@ void Storage::synchronize()
 
     LOG(NetworkCacheStorage, "(NetworkProcess) synchronizing cache");
 
-    backgroundIOQueue().dispatch([this, protectedThis = Ref { *this }] () mutable {
+    // A valid persisted index makes the filters available without reading any directory
+    // entries; randomness-avoiding test instances always rebuild from the records.
+    bool shouldTryLoadingIndex = !m_hasTriedLoadingIndex && m_mode == Mode::Normal;
+    m_hasTriedLoadingIndex = true;
+
+    backgroundIOQueue().dispatch([this, protectedThis = Ref { *this }, shouldTryLoadingIndex] () mutable {
+        if (shouldTryLoadingIndex) {
+            if (auto loadedIndex = readIndexFile()) {
+                m_blobStorage.synchronize();
+
+                LOG(NetworkCacheStorage, "(NetworkProcess) cache synchronization completed from index size=%zu", loadedIndex->approximateRecordsSize);
+
+                RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis), loadedIndex = WTFMove(*loadedIndex)]() mutable {
+                    for (auto& recordFilterKey : m_recordFilterHashesAddedDuringSynchronization)
+                        loadedIndex.recordFilter->add(recordFilterKey);
+                    m_recordFilterHashesAddedDuringSynchronization.clear();
+
+                    for (auto& hash : m_blobFilterHashesAddedDuringSynchronization)
+                        loadedIndex.blobFilter->add(hash);
+                    m_blobFilterHashesAddedDuringSynchronization.clear();
+
+                    m_recordFilter = WTFMove(loadedIndex.recordFilter);
+                    m_blobFilter = WTFMove(loadedIndex.blobFilter);
+                    m_approximateRecordsSize = loadedIndex.approximateRecordsSize;
+                    m_synchronizationInProgress = false;
+                });
+                return;
+            }
+        }
+
         auto recordFilter = makeUnique<ContentsFilter>();
         auto blobFilter = makeUnique<ContentsFilter>();
 
@@ -392,6 +529,8 @@ void Storage::synchronize()
             m_synchronizationInProgress = false;
             if (m_mode == Mode::AvoidRandomness)
                 dispatchPendingWriteOperations();
+            else
+                scheduleIndexWrite();
         });
 
     });
@@ -407,6 +546,8 @@ void Storage::addToRecordFilter(const Key& key)
     // If we get new entries during filter synchronization take care to add them to the new filter as well.
     if (m_synchronizationInProgress)
         m_recordFilterHashesAddedDuringSynchronization.append(key.hash());
+
+    scheduleIndexWrite();
 }
 
 bool Storage::mayContain(const Key& key) const
@@ -616,6 +757,7 @@ std::optional<BlobStorage::Blob> Storage::storeBodyAsBlob(WriteOperation& writeO
             m_blobFilter->add(writeOperation.record.key.hash());
         if (m_synchronizationInProgress)
             m_blobFilterHashesAddedDuringSynchronization.append(writeOperation.record.key.hash());
+        scheduleIndexWrite();
 
         if (writeOperation.mappedBodyHandler)
             writeOperation.mappedBodyHandler(blob.data);
@@ -1079,6 +1221,9 @@ void Storage::clear(String&& type, WallTime modifiedSinceTime, CompletionHandler
     m_approximateRecordsSize = 0;
 
     ioQueue().dispatch([this, protectedThis = Ref { *this }, modifiedSinceTime, completionHandler = WTFMove(completionHandler), type = WTFMove(type).isolatedCopy()] () mutable {
+        // The persisted index no longer matches the cleared filters; the next synchronize rebuilds it.
+        FileSystem::deleteFile(indexFilePathIsolatedCopy());
+
         auto recordsPath = this->recordsPathIsolatedCopy();
         traverseRecordsFiles(recordsPath, type, [modifiedSinceTime](const String& fileName, const String& hashString, const String& type, bool isBlob, const String& recordDirectoryPath) {
             auto filePath = FileSystem::pathByAppendingComponent(recordDirectoryPath, fileName);
@@ -132,6 +132,15 @@ private:
     void shrinkIfNeeded();
     void shrink();
 
+    // 2^18 bit filter can support up to 26000 entries with false positive rate < 1%.
+    using ContentsFilter = BloomFilter<18>;
+
+    struct LoadedIndex;
+    std::optional<LoadedIndex> readIndexFile();
+    String indexFilePathIsolatedCopy() const;
+    void scheduleIndexWrite();
+    void writeIndex();
+
     struct ReadOperation;
     void dispatchReadOperation(std::unique_ptr<ReadOperation>);
     void dispatchPendingReadOperations();
@@ -176,11 +185,10 @@ private:
     size_t m_approximateRecordsSize { 0 };
     mutable std::optional<uint32_t> m_volumeBlockSize;
 
-    // 2^18 bit filter can support up to 26000 entries with false positive rate < 1%.
-    using ContentsFilter = BloomFilter<18>;
     std::unique_ptr<ContentsFilter> m_recordFilter;
     std::unique_ptr<ContentsFilter> m_blobFilter;
 
+    bool m_hasTriedLoadingIndex { false };
     bool m_synchronizationInProgress { false };
     bool m_shrinkInProgress { false };
     size_t m_readOperationDispatchCount { 0 };
@@ -195,6 +203,7 @@ private:
     Deque<std::unique_ptr<WriteOperation>> m_pendingWriteOperations;
     HashSet<std::unique_ptr<WriteOperation>> m_activeWriteOperations;
     WebCore::Timer m_writeOperationDispatchTimer;
+    WebCore::Timer m_indexWriteTimer;
 
     struct TraverseOperation;
     HashSet<std::unique_ptr<TraverseOperation>> m_activeTraverseOperations;
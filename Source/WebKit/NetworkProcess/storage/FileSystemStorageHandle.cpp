@@ -177,6 +177,12 @@ Expected<Vector<String>, FileSystemStorageError> FileSystemStorageHandle::resolv
     return restPath.split(pathSeparator);
 }
 
+// The sync access handle hands the web process the platform file handle itself
+// through IPC::SharedFileHandle, so reads and writes after this point go straight
+// to the kernel from the worker thread without any per-operation IPC. High-rate
+// writers should use this path; FileSystemWritableFileStream is not implemented
+// yet, and when it is, its writes should be funneled through the same donated
+// handle rather than per-chunk messages.
 Expected<FileSystemStorageHandle::AccessHandleInfo, FileSystemStorageError> FileSystemStorageHandle::createSyncAccessHandle()
 {
     if (!m_manager)
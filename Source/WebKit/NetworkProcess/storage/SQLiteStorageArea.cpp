@@ -299,6 +299,13 @@ HashMap<String, String> SQLiteStorageArea::allItems()
     return items;
 }
 
+// Writes arrive here asynchronously (StorageAreaMap mirrors the map in the web
+// process and filters same-value stores), land inside a transaction that stays
+// open for transactionDuration, and the database runs in WAL mode, so bursts of
+// setItem() calls amortize to one fsync per transaction window. The remaining
+// per-write cost is the old-value lookup below: values larger than
+// maximumSizeForValuesKeptInMemory are not cached, so each overwrite of a large
+// value issues a SELECT to recover the previous value for storage events.
 Expected<void, StorageError> SQLiteStorageArea::setItem(IPC::Connection::UniqueID connection, StorageAreaImplIdentifier storageAreaImplID, String&& key, String&& value, const String& urlString)
 {
     ASSERT(!isMainRunLoop());
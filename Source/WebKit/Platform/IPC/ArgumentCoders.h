@@ -481,6 +481,13 @@ template<typename T, size_t inlineCapacity, typename OverflowHandler, size_t min
     }
 };
 
+// Vectors of arithmetic elements encode as one span memcpy into the message buffer rather than
+// element by element. Payloads large enough for even that single copy to matter (image pixels,
+// font data) should be sent as IPC::SharedBufferReference at the message level, which carries
+// the bytes out of line in shared memory and maps them on the receiving side. That cannot be
+// done here: this coder is also instantiated for stream encoders, which have no attachment or
+// shared-memory support, and out-of-line decode would have to hand out mapped spans instead of
+// Vectors to avoid reintroducing the copy.
 template<typename T, size_t inlineCapacity, typename OverflowHandler, size_t minCapacity> struct VectorArgumentCoder<true, T, inlineCapacity, OverflowHandler, minCapacity> {
     template<typename Encoder>
     static void encode(Encoder& encoder, const Vector<T, inlineCapacity, OverflowHandler, minCapacity>& vector)
@@ -29,6 +29,7 @@
 #include "Logging.h"
 #include "MessageFlags.h"
 #include "MessageReceiveQueues.h"
+#include "MessageStatistics.h"
 #include "WorkQueueMessageReceiver.h"
 #include <memory>
 #include <wtf/ArgumentCoder.h>
@@ -549,9 +550,14 @@ bool Connection::sendMessage(UniqueRef<Encoder>&& encoder, OptionSet<SendOption>
     {
         Locker locker { m_outgoingMessagesLock };
         m_outgoingMessages.append(WTFMove(encoder));
+        // A scheduled drain covers every message queued before it observes an empty queue, so a
+        // burst of small messages wakes the connection queue once instead of once per message.
+        // A QOS override still dispatches so the drain can be boosted to the requested priority.
+        if (m_isSendingOutgoingMessagesScheduled && !qos)
+            return true;
+        m_isSendingOutgoingMessagesScheduled = true;
     }
 
-    // FIXME: We should add a boolean flag so we don't call this when work has already been scheduled.
     auto sendOutgoingMessages = [protectedThis = Ref { *this }]() mutable {
         protectedThis->sendOutgoingMessages();
     };
@@ -1018,22 +1024,32 @@ bool Connection::canSendOutgoingMessages() const
 
 void Connection::sendOutgoingMessages()
 {
-    if (!canSendOutgoingMessages())
+    if (!canSendOutgoingMessages()) {
+        Locker locker { m_outgoingMessagesLock };
+        m_isSendingOutgoingMessagesScheduled = false;
         return;
+    }
 
     while (true) {
         std::unique_ptr<Encoder> message;
 
         {
             Locker locker { m_outgoingMessagesLock };
-            if (m_outgoingMessages.isEmpty())
+            if (m_outgoingMessages.isEmpty()) {
+                m_isSendingOutgoingMessagesScheduled = false;
                 break;
+            }
             message = m_outgoingMessages.takeFirst().moveToUniquePtr();
         }
         ASSERT(message);
 
-        if (!sendOutgoingMessage(makeUniqueRefFromNonNullUniquePtr(WTFMove(message))))
+        if (!sendOutgoingMessage(makeUniqueRefFromNonNullUniquePtr(WTFMove(message)))) {
+            // The platform layer resumes draining once the channel can accept writes again;
+            // until then senders go back to scheduling their own drains.
+            Locker locker { m_outgoingMessagesLock };
+            m_isSendingOutgoingMessagesScheduled = false;
             break;
+        }
     }
 }
 
@@ -1142,6 +1158,8 @@ void Connection::enqueueIncomingMessage(std::unique_ptr<Decoder> incomingMessage
         }
 #endif
 
+        incomingMessage->setTimeOfEnqueue(MonotonicTime::now());
+        MessageStatistics::singleton().didEnqueueMessage(incomingMessage->messageReceiverName(), m_incomingMessages.size() + 1);
         m_incomingMessages.append(WTFMove(incomingMessage));
 
         if (isIncomingMessagesThrottlingEnabled() && m_incomingMessages.size() != 1)
@@ -1165,6 +1183,10 @@ void Connection::dispatchMessage(Decoder& decoder)
 {
     assertIsCurrent(dispatcher());
     RELEASE_ASSERT(m_client);
+
+    auto timeOfEnqueue = decoder.timeOfEnqueue();
+    MessageStatistics::singleton().didDispatchMessage(decoder.messageReceiverName(), timeOfEnqueue ? MonotonicTime::now() - timeOfEnqueue : Seconds { }, decoder.length());
+
     if (decoder.messageReceiverName() == ReceiverName::AsyncReply) {
         auto handler = takeAsyncReplyHandler(makeObjectIdentifier<AsyncReplyIDType>(decoder.destinationID()));
         if (!handler) {
@@ -482,6 +482,7 @@ private:
     // Outgoing messages.
     Lock m_outgoingMessagesLock;
     Deque<UniqueRef<Encoder>> m_outgoingMessages WTF_GUARDED_BY_LOCK(m_outgoingMessagesLock);
+    bool m_isSendingOutgoingMessagesScheduled WTF_GUARDED_BY_LOCK(m_outgoingMessagesLock) { false };
 
     Condition m_waitForMessageCondition;
     Lock m_waitForMessageLock;
@@ -30,6 +30,7 @@
 #include "ReceiverMatcher.h"
 #include <wtf/ArgumentCoder.h>
 #include <wtf/Function.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/OptionSet.h>
 #include <wtf/Vector.h>
 
@@ -155,6 +156,10 @@ public:
 
     std::optional<Attachment> takeLastAttachment();
 
+    // Set when the message is queued for dispatch; used to attribute dispatch latency.
+    void setTimeOfEnqueue(MonotonicTime time) { m_timeOfEnqueue = time; }
+    MonotonicTime timeOfEnqueue() const { return m_timeOfEnqueue; }
+
     static constexpr bool isIPCDecoder = true;
 
 private:
@@ -174,6 +179,7 @@ private:
     MessageName m_messageName;
 
     uint64_t m_destinationID;
+    MonotonicTime m_timeOfEnqueue;
     bool m_isAllowedWhenWaitingForSyncReplyOverride { false };
 
 #if PLATFORM(MAC)
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "MessageStatistics.h"
+
+#include <wtf/MathExtras.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace IPC {
+
+MessageStatistics& MessageStatistics::singleton()
+{
+    static NeverDestroyed<MessageStatistics> statistics;
+    return statistics;
+}
+
+static size_t bucketForValue(uint64_t value, size_t bucketCount)
+{
+    if (!value)
+        return 0;
+    return std::min<size_t>(bucketCount - 1, 64 - clz(value));
+}
+
+void MessageStatistics::didEnqueueMessage(ReceiverName receiverName, size_t queueDepth)
+{
+    auto& statistics = m_statistics[static_cast<size_t>(receiverName) % receiverTableSize];
+    statistics.queueDepth[bucketForValue(queueDepth, bucketCount)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void MessageStatistics::didDispatchMessage(ReceiverName receiverName, Seconds dispatchLatency, size_t payloadSize)
+{
+    auto& statistics = m_statistics[static_cast<size_t>(receiverName) % receiverTableSize];
+    statistics.messageCount.fetch_add(1, std::memory_order_relaxed);
+    statistics.dispatchLatencyMicroseconds[bucketForValue(static_cast<uint64_t>(dispatchLatency.microseconds()), bucketCount)].fetch_add(1, std::memory_order_relaxed);
+    statistics.payloadBytes[bucketForValue(payloadSize, bucketCount)].fetch_add(1, std::memory_order_relaxed);
+}
+
+// The generated metadata has no receiver-name string table, so derive one from the first
+// message description carrying this receiver, which is of the form "Receiver_Message".
+static String displayNameForReceiver(ReceiverName targetName)
+{
+    for (size_t i = 0; i < static_cast<size_t>(MessageName::Count); ++i) {
+        auto messageName = static_cast<MessageName>(i);
+        if (receiverName(messageName) != targetName)
+            continue;
+        String fullDescription = String::fromLatin1(description(messageName));
+        auto underscorePosition = fullDescription.find('_');
+        if (underscorePosition != notFound)
+            return fullDescription.left(underscorePosition);
+        return fullDescription;
+    }
+    return makeString("Receiver"_s, static_cast<unsigned>(targetName));
+}
+
+static void appendHistogram(StringBuilder& builder, ASCIILiteral label, std::array<std::atomic<uint64_t>, 24>& histogram)
+{
+    builder.append("  "_s, label, ':');
+    for (auto& bucket : histogram)
+        builder.append(' ', bucket.exchange(0, std::memory_order_relaxed));
+    builder.append('\n');
+}
+
+String MessageStatistics::drainAndReset()
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < receiverTableSize; ++i) {
+        auto& statistics = m_statistics[i];
+        auto messageCount = statistics.messageCount.exchange(0, std::memory_order_relaxed);
+        if (!messageCount)
+            continue;
+        builder.append(displayNameForReceiver(static_cast<ReceiverName>(i)), " messages="_s, messageCount, '\n');
+        appendHistogram(builder, "dispatch_latency_us_log2"_s, statistics.dispatchLatencyMicroseconds);
+        appendHistogram(builder, "queue_depth_log2"_s, statistics.queueDepth);
+        appendHistogram(builder, "payload_bytes_log2"_s, statistics.payloadBytes);
+    }
+    return builder.toString();
+}
+
+} // namespace IPC
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "MessageNames.h"
+#include <array>
+#include <atomic>
+#include <wtf/Seconds.h>
+#include <wtf/text/WTFString.h>
+
+namespace IPC {
+
+// Always-on counters for incoming message traffic, indexed by receiver name. Recording a
+// message costs an array index and an atomic increment per value, so it is cheap enough to
+// leave enabled in production; draining formats the tables as text and resets them.
+class MessageStatistics {
+public:
+    static MessageStatistics& singleton();
+
+    void didEnqueueMessage(ReceiverName, size_t queueDepth);
+    void didDispatchMessage(ReceiverName, Seconds dispatchLatency, size_t payloadSize);
+
+    String drainAndReset();
+
+private:
+    static constexpr size_t receiverTableSize = static_cast<size_t>(ReceiverName::Invalid) + 1;
+    static constexpr size_t bucketCount = 24;
+
+    // Power-of-two bucketed histograms: bucket n counts values in [2^(n-1), 2^n).
+    using Histogram = std::array<std::atomic<uint64_t>, bucketCount>;
+
+    struct ReceiverStatistics {
+        std::atomic<uint64_t> messageCount;
+        Histogram dispatchLatencyMicroseconds;
+        Histogram queueDepth;
+        Histogram payloadBytes;
+    };
+
+    std::array<ReceiverStatistics, receiverTableSize> m_statistics;
+};
+
+} // namespace IPC
@@ -36,10 +36,32 @@ namespace IPC {
 using namespace WebCore;
 using namespace WebKit;
 
+#if USE(UNIX_DOMAIN_SOCKETS)
+// Below this size, serializing the bytes inline is cheaper than setting up and mapping
+// a shared-memory segment for a single transfer.
+static constexpr size_t minimumSizeForOutOfLineTransfer = 128 * KB;
+#endif
+
 void SharedBufferReference::encode(Encoder& encoder) const
 {
 #if USE(UNIX_DOMAIN_SOCKETS)
-    encoder << m_buffer;
+    // Large payloads, typically response bodies for sizable assets, go out of line in a
+    // read-only shared-memory segment; sending them inline would copy every byte through
+    // the socket in both processes.
+    bool isOutOfLine = m_buffer && m_buffer->size() >= minimumSizeForOutOfLineTransfer;
+    encoder << isOutOfLine;
+    if (!isOutOfLine) {
+        encoder << m_buffer;
+        return;
+    }
+    encoder << m_buffer->size();
+
+    SharedMemory::Handle handle;
+    if (auto sharedMemoryBuffer = SharedMemory::copyBuffer(*m_buffer)) {
+        if (auto memoryHandle = sharedMemoryBuffer->createHandle(SharedMemory::Protection::ReadOnly))
+            handle = WTFMove(*memoryHandle);
+    }
+    encoder << handle;
 #else
     encoder << isNull();
     if (isNull())
@@ -62,9 +84,30 @@ std::optional<SharedBufferReference> SharedBufferReference::decode(Decoder& deco
 {
     RefPtr<SharedBuffer> buffer;
 #if USE(UNIX_DOMAIN_SOCKETS)
-    if (!decoder.decode(buffer))
+    std::optional<bool> isOutOfLine;
+    decoder >> isOutOfLine;
+    if (!isOutOfLine)
         return std::nullopt;
-    return { IPC::SharedBufferReference(WTFMove(buffer)) };
+
+    if (!*isOutOfLine) {
+        if (!decoder.decode(buffer))
+            return std::nullopt;
+        return { IPC::SharedBufferReference(WTFMove(buffer)) };
+    }
+
+    size_t bufferSize = 0;
+    if (!decoder.decode(bufferSize))
+        return std::nullopt;
+
+    SharedMemory::Handle handle;
+    if (!decoder.decode(handle))
+        return std::nullopt;
+
+    auto sharedMemoryBuffer = SharedMemory::map(handle, SharedMemory::Protection::ReadOnly);
+    if (!sharedMemoryBuffer || sharedMemoryBuffer->size() < bufferSize)
+        return std::nullopt;
+
+    return { IPC::SharedBufferReference { sharedMemoryBuffer.releaseNonNull(), bufferSize } };
 #else
     std::optional<bool> isNull;
     decoder >> isNull;
@@ -102,10 +145,9 @@ RefPtr<WebCore::SharedBuffer> SharedBufferReference::unsafeBuffer() const
 {
 #if !USE(UNIX_DOMAIN_SOCKETS)
     RELEASE_ASSERT_WITH_MESSAGE(isEmpty() || (!m_buffer && m_memory), "Must only be called on IPC's receiver side");
-
+#endif
     if (m_memory)
         return m_memory->createSharedBuffer(m_size);
-#endif
     if (m_buffer)
         return m_buffer->makeContiguous();
     return nullptr;
@@ -115,10 +157,9 @@ const uint8_t* SharedBufferReference::data() const
 {
 #if !USE(UNIX_DOMAIN_SOCKETS)
     RELEASE_ASSERT_WITH_MESSAGE(isEmpty() || (!m_buffer && m_memory), "Must only be called on IPC's receiver side");
-
+#endif
     if (m_memory)
         return static_cast<uint8_t*>(m_memory->data());
-#endif
     if (!m_buffer || !m_buffer->isContiguous())
         return nullptr;
     return downcast<SharedBuffer>(m_buffer.get())->data();
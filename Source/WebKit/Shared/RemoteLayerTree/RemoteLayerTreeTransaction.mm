@@ -570,8 +570,17 @@ bool RemoteLayerTreeTransaction::LayerProperties::decode(IPC::Decoder& decoder,
 RemoteLayerTreeTransaction::RemoteLayerTreeTransaction() = default;
 RemoteLayerTreeTransaction::~RemoteLayerTreeTransaction() = default;
 
+// FIXME: Commits are still serialized into a regular message. Moving the per-layer property
+// deltas into a StreamClientConnection ring, as the GPU process does for media and WebGL,
+// would avoid the copy through the encoder buffer entirely, but needs a stream server in the
+// UI process and stream-compatible coders for the OOL pieces (backing store, fences).
 void RemoteLayerTreeTransaction::encode(IPC::Encoder& encoder) const
 {
+    // Reserve a size-based estimate up front; otherwise a commit touching hundreds of layers
+    // repeatedly doubles the encoder buffer, copying it on every growth.
+    constexpr size_t estimatedBytesPerChangedLayer = 256;
+    encoder.reserve(4096 + m_changedLayers.size() * estimatedBytesPerChangedLayer);
+
     encoder << m_rootLayerID;
     encoder << m_createdLayers;
 
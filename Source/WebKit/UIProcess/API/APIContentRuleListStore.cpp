@@ -227,6 +227,10 @@ struct MappedData {
     WebKit::NetworkCache::Data data;
 };
 
+// Compiled rule lists are never read into anonymous memory: the file is mapped
+// here, and WebCompiledContentRuleListData hands other processes a read-only
+// handle to the same file-backed pages, so the kernel can evict cold bytecode
+// and action data and every process shares one physical copy.
 static std::optional<MappedData> openAndMapContentRuleList(const WTF::String& path)
 {
     if (!FileSystem::makeSafeToUseMemoryMapForPath(path))
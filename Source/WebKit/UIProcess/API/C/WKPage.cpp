@@ -2659,6 +2659,12 @@ void WKPageGetSamplingProfilerOutput(WKPageRef pageRef, void* context, WKPageGet
     toImpl(pageRef)->getSamplingProfilerOutput(toStringCallback(context, callback));
 }
 
+void WKPageGetResourceUsage(WKPageRef pageRef, void* context, WKPageGetResourceUsageFunction callback)
+{
+    CRASH_IF_SUSPENDED;
+    toImpl(pageRef)->getResourceUsage(toStringCallback(context, callback));
+}
+
 void WKPageGetSelectionAsWebArchiveData(WKPageRef pageRef, void* context, WKPageGetSelectionAsWebArchiveDataFunction callback)
 {
     CRASH_IF_SUSPENDED;
@@ -103,6 +103,13 @@ WK_EXPORT void WKPageGetBytecodeProfile(WKPageRef page, void* context, WKPageGet
 typedef void (*WKPageGetSamplingProfilerOutputFunction)(WKStringRef, WKErrorRef, void*);
 WK_EXPORT void WKPageGetSamplingProfilerOutput(WKPageRef page, void* context, WKPageGetSamplingProfilerOutputFunction function);
 
+// Asynchronously samples CPU, memory category, and GC scheduling data for the page's web
+// process and returns it as a JSON string. The result is empty when the web process was
+// built without ENABLE(RESOURCE_USAGE). Callers wanting a time series should invoke this
+// at their desired frequency; sample collection only runs while a request is in flight.
+typedef void (*WKPageGetResourceUsageFunction)(WKStringRef, WKErrorRef, void*);
+WK_EXPORT void WKPageGetResourceUsage(WKPageRef page, void* context, WKPageGetResourceUsageFunction function);
+
 WK_EXPORT WKArrayRef WKPageCopyRelatedPages(WKPageRef page);
 
 WK_EXPORT WKFrameRef WKPageLookUpFrameFromHandle(WKPageRef page, WKFrameHandleRef handle);
@@ -101,6 +101,17 @@ ProvisionalPageProxy::ProvisionalPageProxy(WebPageProxy& page, Ref<WebProcessPro
 
     initializeWebPage(websitePolicies);
 
+    // FIXME: Most of a cross-process navigation's latency relative to a
+    // same-process one is the gap before the destination's subresource warm-up
+    // begins: SpeculativeLoadManager only starts revalidating the destination's
+    // recorded subresources once the provisional process's main-resource request
+    // reaches the network cache, i.e. after process launch and WebPage creation.
+    // There is no point pushing payloads into the new process earlier than that
+    // — cache hits already arrive as mmap'd ShareableResource handles with no
+    // copy, and the process has no document to consume them — but the cache
+    // warm-up itself could be kicked off from here, overlapping it with process
+    // initialization. Doing so needs a NetworkProcess message carrying the
+    // request before a main-frame identifier exists for the provisional page.
     m_page.inspectorController().didCreateProvisionalPage(*this);
 }
 
@@ -46,6 +46,7 @@
 #include "LegacyGlobalSettings.h"
 #include "LoadedWebArchive.h"
 #include "Logging.h"
+#include "MessageStatistics.h"
 #include "NetworkProcessCreationParameters.h"
 #include "NetworkProcessMessages.h"
 #include "NetworkProcessProxy.h"
@@ -1245,6 +1246,11 @@ WebProcessPool::Statistics& WebProcessPool::statistics()
     return statistics;
 }
 
+String WebProcessPool::drainIPCMessageStatistics()
+{
+    return IPC::MessageStatistics::singleton().drainAndReset();
+}
+
 void WebProcessPool::handleMemoryPressureWarning(Critical)
 {
     WEBPROCESSPOOL_RELEASE_LOG(PerformanceLogging, "handleMemoryPressureWarning:");
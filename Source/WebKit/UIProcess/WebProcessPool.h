@@ -306,7 +306,10 @@ public:
         unsigned wkPageCount;
         unsigned wkFrameCount;
     };
-    static Statistics& statistics();    
+    static Statistics& statistics();
+
+    // Formats and resets this process's per-receiver IPC dispatch histograms.
+    static String drainIPCMessageStatistics();
 
     void clearCachedCredentials(PAL::SessionID);
     void terminateAllWebContentProcesses();
@@ -130,6 +130,13 @@ void RemoteDisplayListRecorderProxy::recordSetStrokeThickness(float thickness)
     send(Messages::RemoteDisplayListRecorder::SetStrokeThickness(thickness));
 }
 
+// State traffic is already delta-encoded before it reaches this point: the base Recorder defers
+// state emission until a drawing item needs it, drops properties whose values match the last
+// emitted drawing state, and GraphicsContextState serializes only the flagged properties. What
+// still crosses the wire redundantly is balanced save/restore and clip pairs with no drawing
+// between them; eliding those needs a flush hook before every recorded item, not just drawing
+// items, since clips take effect immediately on the receiver.
+// FIXME: Consider deferring Save until the next recorded item so empty save/restore pairs cancel.
 void RemoteDisplayListRecorderProxy::recordSetState(const GraphicsContextState& state)
 {
     send(Messages::RemoteDisplayListRecorder::SetState(DisplayList::SetState { state }));
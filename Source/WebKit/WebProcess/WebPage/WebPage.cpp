@@ -247,6 +247,7 @@
 #include <WebCore/ResourceLoadStatistics.h>
 #include <WebCore/ResourceRequest.h>
 #include <WebCore/ResourceResponse.h>
+#include <WebCore/ResourceUsageThread.h>
 #include <WebCore/RunJavaScriptParameters.h>
 #include <WebCore/SWClientConnection.h>
 #include <WebCore/ScriptController.h>
@@ -276,6 +277,7 @@
 #include <WebCore/WritingDirection.h>
 #include <WebCore/markup.h>
 #include <pal/SessionID.h>
+#include <wtf/JSONValues.h>
 #include <wtf/ProcessID.h>
 #include <wtf/RunLoop.h>
 #include <wtf/Scope.h>
@@ -2634,6 +2636,15 @@ void WebPage::setFooterBannerHeightForTesting(int height)
 
 #endif // !PLATFORM(IOS_FAMILY)
 
+// Snapshots paint synchronously through FrameView on purpose: most
+// SnapshotOptions ask for renderings that never existed in the committed layer
+// tree (selection excluded, black text, transparent background, printing
+// layout), so a compositor-side readback could not honor them — it can only
+// reproduce the last commit, up to a frame stale and clipped to what was
+// composited. An async path that replays committed layers into a
+// ShareableBitmap out of process would suit options-free thumbnailing, but it
+// belongs in the drawing area, keyed off a commit, with this entry point kept
+// for the option combinations that genuinely require repainting the document.
 void WebPage::takeSnapshot(IntRect snapshotRect, IntSize bitmapSize, uint32_t options, CompletionHandler<void(const WebKit::ShareableBitmapHandle&)>&& completionHandler)
 {
     ShareableBitmapHandle handle;
@@ -7198,6 +7209,77 @@ void WebPage::getSamplingProfilerOutput(CompletionHandler<void(const String&)>&&
 #endif
 }
 
+#if ENABLE(RESOURCE_USAGE)
+static ASCIILiteral memoryCategoryName(unsigned category)
+{
+    switch (category) {
+#define WEBKIT_MEMORY_CATEGORY_NAME(name, id, subcategory) case WebCore::MemoryCategory::name: return #name ""_s;
+WEBCORE_EACH_MEMORY_CATEGORIES(WEBKIT_MEMORY_CATEGORY_NAME)
+#undef WEBKIT_MEMORY_CATEGORY_NAME
+    }
+    ASSERT_NOT_REACHED();
+    return ""_s;
+}
+
+static String resourceUsageDataToJSON(const ResourceUsageData& data)
+{
+    auto result = JSON::Object::create();
+    result->setDouble("timestamp"_s, data.timestamp.secondsSinceEpoch().seconds());
+    result->setDouble("cpu"_s, data.cpu);
+    result->setDouble("cpuExcludingDebuggerThreads"_s, data.cpuExcludingDebuggerThreads);
+    result->setDouble("totalDirtySize"_s, data.totalDirtySize);
+    result->setDouble("totalExternalSize"_s, data.totalExternalSize);
+
+    auto categories = JSON::Array::create();
+    for (auto& category : data.categories) {
+        auto categoryObject = JSON::Object::create();
+        categoryObject->setString("name"_s, memoryCategoryName(category.type));
+        categoryObject->setBoolean("isSubcategory"_s, category.isSubcategory);
+        categoryObject->setDouble("dirtySize"_s, category.dirtySize);
+        categoryObject->setDouble("reclaimableSize"_s, category.reclaimableSize);
+        categoryObject->setDouble("externalSize"_s, category.externalSize);
+        categories->pushObject(WTFMove(categoryObject));
+    }
+    result->setArray("categories"_s, WTFMove(categories));
+
+    auto threads = JSON::Array::create();
+    for (auto& thread : data.cpuThreads) {
+        auto threadObject = JSON::Object::create();
+        threadObject->setString("name"_s, thread.name);
+        threadObject->setString("identifier"_s, thread.identifier);
+        threadObject->setDouble("cpu"_s, thread.cpu);
+        threads->pushObject(WTFMove(threadObject));
+    }
+    result->setArray("cpuThreads"_s, WTFMove(threads));
+
+    if (!std::isnan(data.timeOfNextEdenCollection))
+        result->setDouble("timeOfNextEdenCollection"_s, data.timeOfNextEdenCollection.secondsSinceEpoch().seconds());
+    if (!std::isnan(data.timeOfNextFullCollection))
+        result->setDouble("timeOfNextFullCollection"_s, data.timeOfNextFullCollection.secondsSinceEpoch().seconds());
+
+    return result->toJSONString();
+}
+#endif // ENABLE(RESOURCE_USAGE)
+
+void WebPage::getResourceUsage(CompletionHandler<void(const String&)>&& callback)
+{
+#if ENABLE(RESOURCE_USAGE)
+    // One-shot sample from the same collector that feeds ResourceUsageOverlay and the
+    // inspector timelines. The observer removes itself after the first delivery, so the
+    // collection thread goes back to sleep when no overlay or inspector is active;
+    // callers control the sampling frequency by deciding how often to ask.
+    auto sharedCallback = std::make_shared<CompletionHandler<void(const String&)>>(WTFMove(callback));
+    void* key = sharedCallback.get();
+    ResourceUsageThread::addObserver(key, All, [key, sharedCallback] (const ResourceUsageData& data) {
+        if (auto callback = WTFMove(*sharedCallback))
+            callback(resourceUsageDataToJSON(data));
+        ResourceUsageThread::removeObserver(key);
+    });
+#else
+    callback({ });
+#endif
+}
+
 void WebPage::didChangeScrollOffsetForFrame(Frame* frame)
 {
     if (!frame->isMainFrame())
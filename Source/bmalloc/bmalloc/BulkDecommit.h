@@ -36,6 +36,8 @@ class BulkDecommit {
     using Data = std::vector<std::pair<char*, size_t>>;
 
 public:
+    enum class Eagerness { Eager, Lazy };
+
     void addEager(void* ptr, size_t size)
     {
         add(m_eager, ptr, size);
@@ -46,13 +48,19 @@ public:
     }
     void processEager()
     {
-        process(m_eager);
+        m_processedEagerBytes = process(m_eager, Eagerness::Eager);
     }
-    void processLazy()
+    // The caller can escalate the lazy tier to an eager decommit, so that under memory
+    // pressure the pages come out of the footprint immediately instead of whenever the
+    // kernel gets around to reclaiming them.
+    void processLazy(Eagerness eagerness = Eagerness::Lazy)
     {
-        process(m_lazy);
+        m_processedLazyBytes = process(m_lazy, eagerness);
     }
 
+    size_t processedEagerBytes() const { return m_processedEagerBytes; }
+    size_t processedLazyBytes() const { return m_processedLazyBytes; }
+
 private:
     void add(Data& data, void* ptr, size_t size)
     {
@@ -63,7 +71,7 @@ private:
         data.push_back({begin, end - begin});
     }
 
-    void process(BulkDecommit::Data& decommits)
+    static size_t process(BulkDecommit::Data& decommits, Eagerness eagerness)
     {
         std::sort(
             decommits.begin(), decommits.end(),
@@ -71,13 +79,22 @@ private:
                 return a.first < b.first;
             });
 
+        size_t totalBytes = 0;
+        auto decommit = [&] (char* ptr, size_t size) {
+            if (eagerness == Eagerness::Eager)
+                vmDeallocatePhysicalPages(ptr, size);
+            else
+                vmDeallocatePhysicalPagesLazy(ptr, size);
+            totalBytes += size;
+        };
+
         char* run = nullptr;
         size_t runSize = 0;
         for (unsigned i = 0; i < decommits.size(); ++i) {
             auto& pair = decommits[i];
             if (run + runSize != pair.first) {
                 if (run)
-                    vmDeallocatePhysicalPages(run, runSize);
+                    decommit(run, runSize);
                 run = pair.first;
                 runSize = pair.second;
             } else {
@@ -87,11 +104,15 @@ private:
         }
 
         if (run)
-            vmDeallocatePhysicalPages(run, runSize);
+            decommit(run, runSize);
+
+        return totalBytes;
     }
 
     Data m_eager;
     Data m_lazy;
+    size_t m_processedEagerBytes { 0 };
+    size_t m_processedLazyBytes { 0 };
 };
 
 } // namespace bmalloc
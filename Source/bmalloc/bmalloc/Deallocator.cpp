@@ -33,6 +33,7 @@
 #include "PerProcess.h"
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <sys/mman.h>
 
 #if !BUSE(LIBPAS)
@@ -77,8 +78,18 @@ void Deallocator::deallocateSlowCase(void* object)
     }
 
     if (m_objectLog.size() == m_objectLog.capacity()) {
-        UniqueLockHolder lock(Heap::mutex());
-        processObjectLog(lock);
+        UniqueLockHolder lock(Heap::mutex(), std::try_to_lock);
+        if (lock.owns_lock())
+            processObjectLog(lock);
+        else {
+            // The lock is contended. Hand the full log to the heap's pending queue instead
+            // of blocking; whoever holds the lock will drain it.
+            Heap::ObjectLogSegment* segment = m_heap.takeObjectLogSegment();
+            segment->count = m_objectLog.size();
+            std::memcpy(segment->objects, m_objectLog.begin(), segment->count * sizeof(void*));
+            m_objectLog.clear();
+            m_heap.publishObjectLog(segment);
+        }
     }
 
     m_objectLog.push(object);
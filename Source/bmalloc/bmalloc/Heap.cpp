@@ -155,6 +155,8 @@ void Heap::decommitLargeRange(UniqueLockHolder& lock, LargeRange& range, BulkDec
 
 void Heap::scavenge(UniqueLockHolder& lock, BulkDecommit& decommitter, size_t& deferredDecommits)
 {
+    drainPendingObjectLogs(lock);
+
     for (auto& list : m_freePages) {
         for (auto* chunk : list) {
             for (auto* page : chunk->freePages()) {
@@ -207,6 +209,53 @@ void Heap::deallocateLineCache(UniqueLockHolder&, LineCache& lineCache)
     }
 }
 
+Heap::ObjectLogSegment* Heap::takeObjectLogSegment()
+{
+    {
+        LockHolder lock(m_objectLogPoolMutex);
+        if (ObjectLogSegment* segment = m_objectLogPool) {
+            m_objectLogPool = segment->next;
+            segment->next = nullptr;
+            segment->count = 0;
+            return segment;
+        }
+    }
+
+    auto* segment = static_cast<ObjectLogSegment*>(
+        vmAllocate(vmPageSize(), roundUpToMultipleOf(vmPageSize(), sizeof(ObjectLogSegment))));
+    segment->next = nullptr;
+    segment->count = 0;
+    return segment;
+}
+
+void Heap::publishObjectLog(ObjectLogSegment* segment)
+{
+    ObjectLogSegment* head = m_pendingObjectLogs.load(std::memory_order_relaxed);
+    do
+        segment->next = head;
+    while (!m_pendingObjectLogs.compare_exchange_weak(head, segment, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void Heap::drainPendingObjectLogs(UniqueLockHolder& lock)
+{
+    ObjectLogSegment* head = m_pendingObjectLogs.exchange(nullptr, std::memory_order_acquire);
+    if (!head)
+        return;
+
+    for (ObjectLogSegment* segment = head; segment; segment = segment->next) {
+        for (size_t i = 0; i < segment->count; ++i)
+            derefSmallLine(lock, Object(segment->objects[i]), m_lineCache);
+    }
+
+    LockHolder poolLock(m_objectLogPoolMutex);
+    while (head) {
+        ObjectLogSegment* next = head->next;
+        head->next = m_objectLogPool;
+        m_objectLogPool = head;
+        head = next;
+    }
+}
+
 void Heap::allocateSmallChunk(UniqueLockHolder& lock, size_t pageClass, FailureAction action)
 {
     RELEASE_BASSERT(isActiveHeapKind(m_kind));
@@ -282,6 +331,10 @@ SmallPage* Heap::allocateSmallPage(UniqueLockHolder& lock, size_t sizeClass, Lin
     if (!lineCache[sizeClass].isEmpty())
         return lineCache[sizeClass].popFront();
 
+    // Published deallocator logs refill our line cache, so drain them before reaching
+    // for a fresh page.
+    drainPendingObjectLogs(lock);
+
     if (!m_lineCache[sizeClass].isEmpty())
         return m_lineCache[sizeClass].popFront();
 
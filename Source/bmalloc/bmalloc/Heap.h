@@ -41,6 +41,7 @@
 #include "SmallLine.h"
 #include "SmallPage.h"
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <vector>
@@ -67,6 +68,18 @@ public:
     void derefSmallLine(UniqueLockHolder&, Object, LineCache&);
     void deallocateLineCache(UniqueLockHolder&, LineCache&);
 
+    // A full deallocator log handed over by a thread that found the heap lock contended.
+    // Publishing is a lock-free push; whoever next holds the lock drains the queue.
+    struct ObjectLogSegment {
+        ObjectLogSegment* next;
+        size_t count;
+        void* objects[deallocatorLogCapacity];
+    };
+
+    ObjectLogSegment* takeObjectLogSegment();
+    void publishObjectLog(ObjectLogSegment*);
+    void drainPendingObjectLogs(UniqueLockHolder&);
+
     void* allocateLarge(UniqueLockHolder&, size_t alignment, size_t, FailureAction);
     void deallocateLarge(UniqueLockHolder&, void*);
 
@@ -140,6 +153,10 @@ private:
 
     Scavenger* m_scavenger { nullptr };
 
+    std::atomic<ObjectLogSegment*> m_pendingObjectLogs { nullptr };
+    Mutex m_objectLogPoolMutex;
+    ObjectLogSegment* m_objectLogPool { nullptr };
+
     size_t m_footprint { 0 };
     size_t m_freeableMemory { 0 };
 
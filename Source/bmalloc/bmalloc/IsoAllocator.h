@@ -43,6 +43,7 @@ public:
     ~IsoAllocator();
     
     void* allocate(IsoHeapImpl<Config>&, bool abortOnFailure);
+    void allocateBatch(IsoHeapImpl<Config>&, void** results, size_t count);
     void scavenge(IsoHeapImpl<Config>&);
     
 private:
@@ -58,6 +58,21 @@ void* IsoAllocator<Config>::allocate(IsoHeapImpl<Config>& heap, bool abortOnFail
     return result;
 }
 
+template<typename Config>
+void IsoAllocator<Config>::allocateBatch(IsoHeapImpl<Config>& heap, void** results, size_t count)
+{
+    // Draining the free list in one go amortizes the per-call dispatch, and when the list
+    // runs dry the single eligible-page scan in allocateSlow refills it for the remainder
+    // of the span.
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = m_freeList.allocate<Config>(
+            [&] () -> void* {
+                bool abortOnFailure = true;
+                return allocateSlow(heap, abortOnFailure);
+            });
+    }
+}
+
 template<typename Config>
 BNO_INLINE void* IsoAllocator<Config>::allocateSlow(IsoHeapImpl<Config>& heap, bool abortOnFailure)
 {
@@ -67,7 +67,13 @@ struct IsoHeap {
     {
         return isoTryAllocate(provideHeap());
     }
-    
+
+    void allocateBatch(void** results, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            results[i] = isoAllocate(provideHeap());
+    }
+
     void deallocate(void* p)
     {
         isoDeallocate(p);
@@ -106,6 +112,8 @@ struct IsoHeap {
 
     void* allocate();
     void* tryAllocate();
+    // Fills results[0..count) from this heap; each pointer is deallocated individually.
+    void allocateBatch(void** results, size_t count);
     void deallocate(void* p);
     
     void scavenge();
@@ -70,6 +70,12 @@ void* IsoHeap<Type>::tryAllocate()
     return IsoTLS::allocate(*this, abortOnFailure);
 }
 
+template<typename Type>
+void IsoHeap<Type>::allocateBatch(void** results, size_t count)
+{
+    IsoTLS::allocateBatch(*this, results, count);
+}
+
 template<typename Type>
 void IsoHeap<Type>::deallocate(void* p)
 {
@@ -44,7 +44,10 @@ class IsoTLS {
 public:
     template<typename Type>
     static void* allocate(api::IsoHeap<Type>&, bool abortOnFailure);
-    
+
+    template<typename Type>
+    static void allocateBatch(api::IsoHeap<Type>&, void** results, size_t count);
+
     template<typename Type>
     static void deallocate(api::IsoHeap<Type>&, void* p);
     
@@ -67,7 +70,16 @@ private:
     
     template<typename Config, typename Type>
     static void* allocateSlow(api::IsoHeap<Type>&, bool abortOnFailure);
-    
+
+    template<typename Config, typename Type>
+    static void allocateBatchImpl(api::IsoHeap<Type>&, void** results, size_t count);
+
+    template<typename Config, typename Type>
+    void allocateBatchFast(api::IsoHeap<Type>&, unsigned offset, void** results, size_t count);
+
+    template<typename Config, typename Type>
+    static void allocateBatchSlow(api::IsoHeap<Type>&, void** results, size_t count);
+
     template<typename Config, typename Type>
     static void deallocateImpl(api::IsoHeap<Type>&, void* p);
     
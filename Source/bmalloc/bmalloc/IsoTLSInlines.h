@@ -45,6 +45,12 @@ void* IsoTLS::allocate(api::IsoHeap<Type>& handle, bool abortOnFailure)
     return allocateImpl<typename api::IsoHeap<Type>::Config>(handle, abortOnFailure);
 }
 
+template<typename Type>
+void IsoTLS::allocateBatch(api::IsoHeap<Type>& handle, void** results, size_t count)
+{
+    allocateBatchImpl<typename api::IsoHeap<Type>::Config>(handle, results, count);
+}
+
 template<typename Type>
 void IsoTLS::deallocate(api::IsoHeap<Type>& handle, void* p)
 {
@@ -106,6 +112,33 @@ BNO_INLINE void* IsoTLS::allocateSlow(api::IsoHeap<Type>& handle, bool abortOnFa
     return tls->allocateFast<Config>(handle, handle.allocatorOffset(), abortOnFailure);
 }
 
+template<typename Config, typename Type>
+void IsoTLS::allocateBatchImpl(api::IsoHeap<Type>& handle, void** results, size_t count)
+{
+    unsigned offset = handle.allocatorOffset();
+    IsoTLS* tls = get();
+    if (!tls || offset >= tls->m_extent) {
+        allocateBatchSlow<Config>(handle, results, count);
+        return;
+    }
+    tls->allocateBatchFast<Config>(handle, offset, results, count);
+}
+
+template<typename Config, typename Type>
+void IsoTLS::allocateBatchFast(api::IsoHeap<Type>& handle, unsigned offset, void** results, size_t count)
+{
+    reinterpret_cast<IsoAllocator<Config>*>(m_data + offset)->allocateBatch(handle.impl(), results, count);
+}
+
+template<typename Config, typename Type>
+BNO_INLINE void IsoTLS::allocateBatchSlow(api::IsoHeap<Type>& handle, void** results, size_t count)
+{
+    // The first allocation either sets up the heap and TLS entries or engages the malloc
+    // fallback; the remaining ones take whichever path it established.
+    for (size_t i = 0; i < count; ++i)
+        results[i] = allocateImpl<Config>(handle, true);
+}
+
 template<typename Config, typename Type>
 void IsoTLS::deallocateImpl(api::IsoHeap<Type>& handle, void* p)
 {
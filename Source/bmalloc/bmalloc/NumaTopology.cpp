@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "NumaTopology.h"
+
+#if BOS(LINUX)
+#include <array>
+#include <fcntl.h>
+#include <mutex>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+namespace bmalloc {
+
+#if BOS(LINUX)
+static unsigned computeNumberOfNumaNodes()
+{
+    int fd = open("/sys/devices/system/node/online", O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return 1;
+
+    std::array<char, 256> buffer;
+    ssize_t numBytes = read(fd, buffer.data(), buffer.size() - 1);
+    close(fd);
+    if (numBytes <= 0)
+        return 1;
+    buffer[numBytes] = '\0';
+
+    // The node list has the same form as a cpu list: comma-separated decimal
+    // ranges, e.g. "0", "0-1" or "0,2-3".
+    unsigned nodeCount = 0;
+    const char* position = buffer.data();
+    while (true) {
+        char* end;
+        unsigned long first = strtoul(position, &end, 10);
+        if (end == position)
+            break;
+        unsigned long last = first;
+        if (*end == '-') {
+            position = end + 1;
+            last = strtoul(position, &end, 10);
+            if (end == position || last < first)
+                break;
+        }
+        nodeCount += last - first + 1;
+        if (*end != ',')
+            break;
+        position = end + 1;
+    }
+    return nodeCount ? nodeCount : 1;
+}
+#endif
+
+unsigned numberOfNumaNodes()
+{
+#if BOS(LINUX)
+    static unsigned numberOfNodes;
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        numberOfNodes = computeNumberOfNumaNodes();
+    });
+    return numberOfNodes;
+#else
+    return 1;
+#endif
+}
+
+} // namespace bmalloc
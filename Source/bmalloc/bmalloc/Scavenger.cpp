@@ -31,6 +31,7 @@
 #include "Environment.h"
 #include "Heap.h"
 #include "IsoHeapImplInlines.h"
+#include "NumaTopology.h"
 #if BOS(DARWIN)
 #import <dispatch/dispatch.h>
 #import <mach/host_info.h>
@@ -89,6 +90,12 @@ Scavenger::Scavenger(const LockHolder&)
 #endif
     m_waitTime = std::chrono::milliseconds(10);
 
+    // Free memory that idles in our caches on a multi-node machine is liable to be handed
+    // back to a thread on a different node than the one that first touched its pages.
+    // Decommitting cold memory sooner lets the kernel's first-touch policy re-home those
+    // pages on the node of whichever thread uses them next, so cap the adaptive wait lower.
+    m_maxWaitTimeMilliseconds = numberOfNumaNodes() > 1 ? s_maxWaitTimeMillisecondsMultiNode : s_maxWaitTimeMilliseconds;
+
     m_thread = std::thread(&threadEntryPoint, this);
 }
 
@@ -169,6 +176,8 @@ inline void dumpStats()
 
     dump("bmalloc-freeable", Scavenger::get()->freeableMemory());
     dump("bmalloc-footprint", Scavenger::get()->footprint());
+    dump("bmalloc-eager-decommitted", Scavenger::get()->eagerDecommitBytes());
+    dump("bmalloc-lazy-decommitted", Scavenger::get()->lazyDecommitBytes());
 }
 
 std::chrono::milliseconds Scavenger::timeSinceLastFullScavenge()
@@ -199,6 +208,7 @@ void Scavenger::scavenge()
 
     {
         BulkDecommit decommitter;
+        bool underMemoryPressure = isUnderMemoryPressure();
 
         {
             PrintTime printTime("\nfull scavenge under lock time");
@@ -217,9 +227,12 @@ void Scavenger::scavenge()
 
         {
             PrintTime printTime("full scavenge lazy decommit time");
-            decommitter.processLazy();
+            decommitter.processLazy(underMemoryPressure ? BulkDecommit::Eagerness::Eager : BulkDecommit::Eagerness::Lazy);
         }
 
+        m_eagerDecommitBytes += decommitter.processedEagerBytes();
+        m_lazyDecommitBytes += decommitter.processedLazyBytes();
+
         {
             PrintTime printTime("full scavenge mark all as eligible time");
             LockHolder lock(Heap::mutex());
@@ -350,7 +363,7 @@ void Scavenger::threadRunLoop()
         if (!m_isInMiniMode) {
             timeSpentScavenging *= s_newWaitMultiplier;
             std::chrono::milliseconds newWaitTime = std::chrono::duration_cast<std::chrono::milliseconds>(timeSpentScavenging);
-            m_waitTime = std::min(std::max(newWaitTime, std::chrono::milliseconds(s_minWaitTimeMilliseconds)), std::chrono::milliseconds(s_maxWaitTimeMilliseconds));
+            m_waitTime = std::min(std::max(newWaitTime, std::chrono::milliseconds(s_minWaitTimeMilliseconds)), std::chrono::milliseconds(m_maxWaitTimeMilliseconds));
         }
 
         if (verbose)
@@ -73,6 +73,10 @@ public:
     // It's unlikely, but possible.
     size_t footprint();
 
+    // Cumulative bytes handed to each decommit tier, for tuning the policy from the outside.
+    size_t eagerDecommitBytes() const { return m_eagerDecommitBytes; }
+    size_t lazyDecommitBytes() const { return m_lazyDecommitBytes; }
+
     void enableMiniMode();
 
     // Used for debugging only.
@@ -97,7 +101,10 @@ private:
     std::atomic<State> m_state { State::Sleep };
     size_t m_scavengerBytes { 0 };
     std::chrono::milliseconds m_waitTime;
+    unsigned m_maxWaitTimeMilliseconds { 0 };
     bool m_isInMiniMode { false };
+    std::atomic<size_t> m_eagerDecommitBytes { 0 };
+    std::atomic<size_t> m_lazyDecommitBytes { 0 };
     
     Mutex m_scavengingMutex;
     std::condition_variable_any m_condition;
@@ -114,10 +121,12 @@ private:
     const unsigned s_newWaitMultiplier = 300;
     const unsigned s_minWaitTimeMilliseconds = 750;
     const unsigned s_maxWaitTimeMilliseconds = 20000;
+    const unsigned s_maxWaitTimeMillisecondsMultiNode = 4000;
 #else
     const unsigned s_newWaitMultiplier = 150;
     const unsigned s_minWaitTimeMilliseconds = 100;
     const unsigned s_maxWaitTimeMilliseconds = 10000;
+    const unsigned s_maxWaitTimeMillisecondsMultiNode = 2000;
 #endif
 
     Vector<DeferredDecommit> m_deferredDecommits;
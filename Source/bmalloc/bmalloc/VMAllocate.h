@@ -210,6 +210,20 @@ inline void vmDeallocatePhysicalPages(void* p, size_t vmSize)
 #endif
 }
 
+// Lazy flavor of vmDeallocatePhysicalPages: the kernel reclaims the pages only once it
+// is actually under memory pressure, and re-touching them before that costs nothing.
+// Only valid for pages whose contents are dead, since reclaim discards them.
+inline void vmDeallocatePhysicalPagesLazy(void* p, size_t vmSize)
+{
+    vmValidatePhysical(p, vmSize);
+#if BOS(LINUX) && defined(MADV_FREE)
+    SYSCALL(madvise(p, vmSize, MADV_FREE));
+    SYSCALL(madvise(p, vmSize, MADV_DONTDUMP));
+#else
+    vmDeallocatePhysicalPages(p, vmSize);
+#endif
+}
+
 inline void vmAllocatePhysicalPages(void* p, size_t vmSize)
 {
     vmValidatePhysical(p, vmSize);
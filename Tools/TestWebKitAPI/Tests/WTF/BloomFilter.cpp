@@ -247,4 +247,57 @@ TEST(WTF_BloomFilter, Combine)
         EXPECT_TRUE(filter.mayContain(hash));
 }
 
+TEST(WTF_BloomFilter, BasicCountingBlocked)
+{
+    const unsigned hashCount = 1000;
+    auto hashes = generateRandomHashes(hashCount);
+
+    CountingBlockedBloomFilter filter(1024);
+    for (auto hash : hashes)
+        filter.add(hash);
+
+    for (auto hash : hashes)
+        EXPECT_TRUE(filter.mayContain(hash));
+
+    auto moreHashes = generateRandomHashes(hashCount);
+    unsigned mayContainCount = 0;
+    for (auto hash : moreHashes)
+        mayContainCount += filter.mayContain(hash) ? 1 : 0;
+    // False positive rate is well below 1% so this should always be true.
+    EXPECT_TRUE(mayContainCount < hashCount / 10);
+
+    for (auto hash : hashes)
+        filter.remove(hash);
+
+    for (auto hash : hashes)
+        EXPECT_TRUE(!filter.mayContain(hash));
+}
+
+TEST(WTF_BloomFilter, CountingBlockedReset)
+{
+    const unsigned hashCount = 1000;
+    auto hashes = generateRandomHashes(hashCount);
+
+    CountingBlockedBloomFilter filter(64);
+    for (auto hash : hashes)
+        filter.add(hash);
+
+    EXPECT_EQ(64u, filter.blockCount());
+    filter.resetWithBlockCount(256);
+    EXPECT_EQ(256u, filter.blockCount());
+
+    for (auto hash : hashes)
+        EXPECT_TRUE(!filter.mayContain(hash));
+
+    // Re-adding after a reset behaves like a freshly constructed filter.
+    for (auto hash : hashes)
+        filter.add(hash);
+    for (auto hash : hashes)
+        EXPECT_TRUE(filter.mayContain(hash));
+    for (auto hash : hashes)
+        filter.remove(hash);
+    for (auto hash : hashes)
+        EXPECT_TRUE(!filter.mayContain(hash));
+}
+
 }
@@ -137,6 +137,35 @@ TEST_F(CompletionHandlerTest, ConstructWithSpecificThreadLikeAssertion)
     EXPECT_TRUE(didCall);
 }
 
+TEST_F(CompletionHandlerTest, ThenChainsContinuation)
+{
+    bool didCallHandler = false;
+    bool didCallContinuation = false;
+    CompletionHandler<void()> ch { [&] {
+        EXPECT_FALSE(didCallContinuation);
+        didCallHandler = true;
+    } };
+    auto chained = WTFMove(ch).then([&] {
+        EXPECT_TRUE(didCallHandler);
+        didCallContinuation = true;
+    });
+    EXPECT_FALSE(ch);
+    chained();
+    EXPECT_TRUE(didCallHandler);
+    EXPECT_TRUE(didCallContinuation);
+}
+
+TEST_F(CompletionHandlerTest, ThenForwardsResult)
+{
+    CompletionHandler<int(int)> ch { [](int value) {
+        return value + 1;
+    } };
+    auto chained = WTFMove(ch).then([](int value) {
+        return value * 2;
+    });
+    EXPECT_EQ(42, chained(20));
+}
+
 TEST(CompletionHandlerDeathTest, MAYBE_ASSERT_ENABLED_DEATH_TEST(UncalledHandlerAsserts))
 {
     ::testing::FLAGS_gtest_death_test_style = "threadsafe";
@@ -260,4 +260,41 @@ TEST(WTF_Function, AssignFunctionPointer)
     EXPECT_FALSE(static_cast<bool>(f2));
 }
 
+static unsigned smallCallableStateDestructions = 0;
+
+struct SmallCallableState {
+    SmallCallableState() = default;
+    SmallCallableState(SmallCallableState&&) noexcept { }
+    ~SmallCallableState() { ++smallCallableStateDestructions; }
+};
+
+TEST(WTF_Function, SmallCallableStoredInline)
+{
+    smallCallableStateDestructions = 0;
+    {
+        unsigned value = 42;
+        Function<unsigned()> a = [state = SmallCallableState { }, value] { return value; };
+        EXPECT_EQ(42U, a());
+
+        // Moving an inline callable moves it into the destination's storage.
+        Function<unsigned()> b = WTFMove(a);
+        EXPECT_FALSE(static_cast<bool>(a));
+        EXPECT_EQ(42U, b());
+
+        a = WTFMove(b);
+        EXPECT_EQ(42U, a());
+    }
+    EXPECT_TRUE(smallCallableStateDestructions);
+}
+
+TEST(WTF_Function, LeakAndAdoptInlineCallable)
+{
+    unsigned value = 7;
+    Function<unsigned()> a = [value] { return value; };
+    auto* impl = a.leak();
+    EXPECT_FALSE(static_cast<bool>(a));
+    auto b = WTF::adopt(impl);
+    EXPECT_EQ(7U, b());
+}
+
 } // namespace TestWebKitAPI
@@ -1215,4 +1215,32 @@ TEST(WTF_HashMap, Clear_Reenter)
     EXPECT_TRUE(map.isEmpty());
 }
 
+TEST(WTF_HashMap, GetMany)
+{
+    HashMap<unsigned, unsigned> map;
+    for (unsigned i = 1; i <= 100; ++i)
+        map.add(i, i * 10);
+
+    Vector<unsigned> keys;
+    for (unsigned i = 1; i <= 120; ++i)
+        keys.append(i);
+
+    Vector<unsigned> results;
+    map.getMany(Span<const unsigned> { keys.data(), keys.size() }, [&](unsigned value) {
+        results.append(value);
+    });
+
+    EXPECT_EQ(120U, results.size());
+    for (unsigned i = 1; i <= 120; ++i)
+        EXPECT_EQ(i <= 100 ? i * 10 : 0U, results[i - 1]);
+
+    HashMap<unsigned, unsigned> emptyMap;
+    unsigned callCount = 0;
+    emptyMap.getMany(Span<const unsigned> { keys.data(), keys.size() }, [&](unsigned value) {
+        EXPECT_EQ(0U, value);
+        ++callCount;
+    });
+    EXPECT_EQ(120U, callCount);
+}
+
 } // namespace TestWebKitAPI
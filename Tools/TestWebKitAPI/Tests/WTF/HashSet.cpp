@@ -850,4 +850,24 @@ TEST(WTF_HashSet, FormSymmetricDifference)
     }
 }
 
+TEST(WTF_HashSet, ContainsMany)
+{
+    HashSet<unsigned> set;
+    for (unsigned i = 1; i <= 100; ++i)
+        set.add(i);
+
+    Vector<unsigned> values;
+    for (unsigned i = 1; i <= 120; ++i)
+        values.append(i);
+
+    Vector<bool> results;
+    set.containsMany(Span<const unsigned> { values.data(), values.size() }, [&](bool contains) {
+        results.append(contains);
+    });
+
+    EXPECT_EQ(120U, results.size());
+    for (unsigned i = 1; i <= 120; ++i)
+        EXPECT_EQ(i <= 100, results[i - 1]);
+}
+
 } // namespace TestWebKitAPI
@@ -315,6 +315,27 @@ TEST(WTF, StringViewSplitWithConsecutiveSeparators)
         EXPECT_STREQ(expected[i].utf8().data(), actual[i].utf8().data()) << "Vectors differ at index " << i;
 }
 
+TEST(WTF, StringViewSplitStrippingMatchedCharacters)
+{
+    String referenceHolder;
+    StringView a = stringViewFromUTF8(referenceHolder, " gzip ,, deflate\t,  ,br , ");
+
+    Vector<String> actual = vectorFromSplitResult(a.splitStrippingMatchedCharacters(',', isASCIISpace<UChar>));
+    Vector<String> expected({ "gzip"_s, "deflate"_s, "br"_s });
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+        EXPECT_STREQ(expected[i].utf8().data(), actual[i].utf8().data()) << "Vectors differ at index " << i;
+
+    StringView allWhiteSpace = stringViewFromUTF8(referenceHolder, " , ,\t");
+    actual = vectorFromSplitResult(allWhiteSpace.splitStrippingMatchedCharacters(',', isASCIISpace<UChar>));
+    EXPECT_TRUE(actual.isEmpty());
+
+    StringView noSeparator = stringViewFromUTF8(referenceHolder, "  identity  ");
+    actual = vectorFromSplitResult(noSeparator.splitStrippingMatchedCharacters(',', isASCIISpace<UChar>));
+    ASSERT_EQ(1u, actual.size());
+    EXPECT_STREQ("identity", actual[0].utf8().data());
+}
+
 TEST(WTF, StringViewEqualBasic)
 {
     String referenceHolder;
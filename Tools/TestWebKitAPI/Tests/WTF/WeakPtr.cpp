@@ -759,6 +759,49 @@ TEST(WTF_WeakPtr, WeakHashSetExpansion)
     }
 }
 
+TEST(WTF_WeakPtr, WeakHashSetMutationDuringForEach)
+{
+    {
+        WeakHashSet<Base> weakHashSet;
+        Base object1;
+        Base object2;
+        Base object3;
+        weakHashSet.add(object1);
+        weakHashSet.add(object2);
+        unsigned visited = 0;
+        weakHashSet.forEach([&](Base& object) {
+            ++visited;
+            // Deferred addition: must not be visited by this iteration.
+            weakHashSet.add(object3);
+            // Deferred removal of an unvisited entry prevents its callback.
+            weakHashSet.remove(&object == &object1 ? object2 : object1);
+        });
+        EXPECT_EQ(visited, 1u);
+        EXPECT_TRUE(weakHashSet.contains(object3));
+        EXPECT_EQ(weakHashSet.computeSize(), 2u);
+        weakHashSet.checkConsistency();
+    }
+
+    {
+        WeakHashSet<Base> weakHashSet;
+        Base object1;
+        Base object2;
+        weakHashSet.add(object1);
+        weakHashSet.add(object2);
+        unsigned visited = 0;
+        weakHashSet.forEach([&](Base&) {
+            ++visited;
+            weakHashSet.clear();
+            EXPECT_TRUE(weakHashSet.computeSize() == 0u);
+        });
+        EXPECT_EQ(visited, 1u);
+        EXPECT_FALSE(weakHashSet.contains(object1));
+        EXPECT_FALSE(weakHashSet.contains(object2));
+        EXPECT_EQ(weakHashSet.computeSize(), 0u);
+        weakHashSet.checkConsistency();
+    }
+}
+
 TEST(WTF_WeakPtr, WeakHashSetComputesEmpty)
 {
     {
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2023 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#include <wtf/WorkStealingDeque.h>
+
+namespace TestWebKitAPI {
+
+TEST(WTF_WorkStealingDeque, OwnerOnlyLIFO)
+{
+    WorkStealingDeque<unsigned> deque;
+    EXPECT_TRUE(deque.isEmpty());
+
+    for (unsigned i = 0; i < 1000; ++i)
+        deque.push(i);
+    EXPECT_EQ(1000, deque.size());
+
+    unsigned value;
+    for (unsigned i = 1000; i--;) {
+        EXPECT_TRUE(deque.pop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(deque.pop(value));
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+TEST(WTF_WorkStealingDeque, StealFIFO)
+{
+    WorkStealingDeque<unsigned> deque;
+    for (unsigned i = 0; i < 100; ++i)
+        deque.push(i);
+
+    unsigned value;
+    for (unsigned i = 0; i < 50; ++i) {
+        EXPECT_TRUE(deque.steal(value));
+        EXPECT_EQ(i, value);
+    }
+    for (unsigned i = 100; i-- > 50;) {
+        EXPECT_TRUE(deque.pop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(deque.steal(value));
+}
+
+TEST(WTF_WorkStealingDeque, ConcurrentStealers)
+{
+    constexpr unsigned itemCount = 100000;
+    constexpr unsigned stealerCount = 4;
+
+    WorkStealingDeque<unsigned> deque;
+    std::atomic<uint64_t> stolenSum { 0 };
+    std::atomic<unsigned> stolenCount { 0 };
+    std::atomic<bool> done { false };
+
+    Vector<Ref<Thread>> stealers;
+    for (unsigned i = 0; i < stealerCount; ++i) {
+        stealers.append(Thread::create("WorkStealingDeque stealer", [&] {
+            unsigned value;
+            while (!done.load(std::memory_order_relaxed)) {
+                if (deque.steal(value)) {
+                    stolenSum += value;
+                    ++stolenCount;
+                }
+            }
+        }));
+    }
+
+    uint64_t poppedSum = 0;
+    unsigned poppedCount = 0;
+    for (unsigned i = 0; i < itemCount; ++i) {
+        deque.push(i);
+        // Interleave some pops so the owner contends with the stealers.
+        if (!(i % 3)) {
+            unsigned value;
+            if (deque.pop(value)) {
+                poppedSum += value;
+                ++poppedCount;
+            }
+        }
+    }
+    unsigned value;
+    while (deque.pop(value)) {
+        poppedSum += value;
+        ++poppedCount;
+    }
+
+    while (stolenCount + poppedCount < itemCount && !deque.isEmpty()) { }
+    done = true;
+    for (auto& stealer : stealers)
+        stealer->waitForCompletion();
+
+    EXPECT_EQ(itemCount, stolenCount + poppedCount);
+    EXPECT_EQ(static_cast<uint64_t>(itemCount) * (itemCount - 1) / 2, stolenSum + poppedSum);
+}
+
+} // namespace TestWebKitAPI